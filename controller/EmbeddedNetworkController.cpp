@@ -106,6 +106,10 @@ static json _renderRule(ZT_VirtualNetworkRule &rule)
 		case ZT_NETWORK_RULE_ACTION_BREAK:
 			r["type"] = "ACTION_BREAK";
 			break;
+		case ZT_NETWORK_RULE_ACTION_PRIORITY:
+			r["type"] = "ACTION_PRIORITY";
+			r["qosBucket"] = (unsigned int)rule.v.qosBucket;
+			break;
 		default:
 			break;
 	}
@@ -302,6 +306,10 @@ static bool _parseRule(json &r,ZT_VirtualNetworkRule &rule)
 	} else if (t == "ACTION_BREAK") {
 		rule.t |= ZT_NETWORK_RULE_ACTION_BREAK;
 		return true;
+	} else if (t == "ACTION_PRIORITY") {
+		rule.t |= ZT_NETWORK_RULE_ACTION_PRIORITY;
+		rule.v.qosBucket = (uint8_t)(OSUtils::jsonInt(r["qosBucket"],(uint64_t)ZT_QOS_DEFAULT_BUCKET) & 0xffULL);
+		return true;
 	} else if (t == "MATCH_SOURCE_ZEROTIER_ADDRESS") {
 		rule.t |= ZT_NETWORK_RULE_MATCH_SOURCE_ZEROTIER_ADDRESS;
 		rule.v.zt = Utils::hexStrToU64(OSUtils::jsonString(r["zt"],"0").c_str()) & 0xffffffffffULL;
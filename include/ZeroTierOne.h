@@ -653,6 +653,16 @@ typedef struct
 	 * True if some kind of connectivity appears available
 	 */
 	int online;
+
+	/**
+	 * Packets dropped from the receive reassembly queue to make room for new ones
+	 */
+	uint64_t rxQueueEvicted;
+
+	/**
+	 * Packets dropped from the receive reassembly queue after timing out
+	 */
+	uint64_t rxQueueExpired;
 } ZT_NodeStatus;
 
 /**
@@ -1211,6 +1221,17 @@ typedef struct
 		uint64_t mac; /* MAC in lower 48 bits */
 		uint32_t adi; /* Additional distinguishing information, usually zero except for IPv4 ARP groups */
 	} multicastSubscriptions[ZT_MAX_MULTICAST_SUBSCRIPTIONS];
+
+	/**
+	 * QoS (FQ-CoDel) scheduler state, all zero unless the network's rules contain PRIORITY actions
+	 */
+	struct {
+		int enabled; /* Nonzero if outgoing frames on this network are scheduled by QoS rules */
+		unsigned int queuedPackets; /* Packets currently held by the scheduler */
+		unsigned int activeFlows; /* Flow queues currently scheduled */
+		uint64_t overflowDrops; /* Packets dropped because the scheduler was full */
+		uint64_t codelDrops; /* Packets dropped by CoDel due to excess queueing delay */
+	} qos;
 } ZT_VirtualNetworkConfig;
 
 /**
@@ -16,6 +16,7 @@ DESTDIR?=
 
 include objects.mk
 ONE_OBJS+=osdep/LinuxEthernetTap.o
+ONE_OBJS+=osdep/LinuxXdpSocket.o
 ONE_OBJS+=osdep/LinuxNetLink.o
 
 NLTEST_OBJS+=osdep/LinuxNetLink.o node/InetAddress.o node/Utils.o node/Salsa20.o
@@ -107,6 +108,11 @@ ifeq ($(ZT_USE_TEST_TAP),1)
 	override DEFS+=-DZT_USE_TEST_TAP
 endif
 
+# Use the portable select() loop in Phy instead of epoll
+ifeq ($(ZT_PHY_SELECT),1)
+	override DEFS+=-DZT_PHY_USE_SELECT
+endif
+
 ifeq ($(ZT_VAULT_SUPPORT),1)
 	override DEFS+=-DZT_VAULT_SUPPORT=1
 	override LDLIBS+=-lcurl
@@ -0,0 +1,695 @@
+/*
+ * ZeroTier One - Network Virtualization Everywhere
+ * Copyright (C) 2011-2019  ZeroTier, Inc.  https://www.zerotier.com/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * --
+ *
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial closed-source software that incorporates or links
+ * directly against ZeroTier software without disclosing the source code
+ * of your own application.
+ */
+
+#include <string.h>
+
+#include "Constants.hpp"
+#include "AES.hpp"
+
+#ifdef ZT_AES_AESNI
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+namespace ZeroTier {
+
+namespace {
+
+/************************************************************************** */
+
+/* Portable constant-time kernel
+ *
+ * AES state and round keys are kept as little-endian 32-bit columns. The
+ * S-box is the Boyar-Peralta circuit (as used in BearSSL) applied to bit
+ * planes of all 16 state bytes at once, and POLYVAL multiplies are built
+ * from integer multiplies with "holes" between the bits so that carries
+ * can't spill into bits that are kept. */
+
+static inline uint32_t _aesLoad32(const uint8_t *p) { return ((uint32_t)p[0]) | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+static inline void _aesStore32(uint8_t *p,const uint32_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24); }
+static inline uint64_t _aesLoad64(const uint8_t *p) { return ((uint64_t)_aesLoad32(p)) | ((uint64_t)_aesLoad32(p + 4) << 32); }
+static inline void _aesStore64(uint8_t *p,const uint64_t v) { _aesStore32(p,(uint32_t)v); _aesStore32(p + 4,(uint32_t)(v >> 32)); }
+
+// Transpose an 8x8 bit matrix: bit j of byte i <-> bit i of byte j
+static inline uint64_t _aesT8x8(uint64_t x)
+{
+	uint64_t t;
+	t = (x ^ (x >> 7)) & 0x00aa00aa00aa00aaULL; x ^= t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000cccc0000ccccULL; x ^= t ^ (t << 14);
+	t = (x ^ (x >> 28)) & 0x00000000f0f0f0f0ULL; x ^= t ^ (t << 28);
+	return x;
+}
+
+// S-box on bit planes, q[0] holds the least significant bit of each byte
+static void _aesSboxPlanes(uint32_t *q)
+{
+	uint32_t x0,x1,x2,x3,x4,x5,x6,x7;
+	uint32_t y1,y2,y3,y4,y5,y6,y7,y8,y9,y10,y11,y12,y13,y14,y15,y16,y17,y18,y19,y20,y21;
+	uint32_t z0,z1,z2,z3,z4,z5,z6,z7,z8,z9,z10,z11,z12,z13,z14,z15,z16,z17;
+	uint32_t t0,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19;
+	uint32_t t20,t21,t22,t23,t24,t25,t26,t27,t28,t29,t30,t31,t32,t33,t34,t35,t36,t37,t38,t39;
+	uint32_t t40,t41,t42,t43,t44,t45,t46,t47,t48,t49,t50,t51,t52,t53,t54,t55,t56,t57,t58,t59;
+	uint32_t t60,t61,t62,t63,t64,t65,t66,t67;
+	uint32_t s0,s1,s2,s3,s4,s5,s6,s7;
+
+	x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4];
+	x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+	// Top linear transformation
+	y14 = x3 ^ x5;
+	y13 = x0 ^ x6;
+	y9 = x0 ^ x3;
+	y8 = x0 ^ x5;
+	t0 = x1 ^ x2;
+	y1 = t0 ^ x7;
+	y4 = y1 ^ x3;
+	y12 = y13 ^ y14;
+	y2 = y1 ^ x0;
+	y5 = y1 ^ x6;
+	y3 = y5 ^ y8;
+	t1 = x4 ^ y12;
+	y15 = t1 ^ x5;
+	y20 = t1 ^ x1;
+	y6 = y15 ^ x7;
+	y10 = y15 ^ t0;
+	y11 = y20 ^ y9;
+	y7 = x7 ^ y11;
+	y17 = y10 ^ y11;
+	y19 = y10 ^ y8;
+	y16 = t0 ^ y11;
+	y21 = y13 ^ y16;
+	y18 = x0 ^ y16;
+
+	// Non-linear section
+	t2 = y12 & y15;
+	t3 = y3 & y6;
+	t4 = t3 ^ t2;
+	t5 = y4 & x7;
+	t6 = t5 ^ t2;
+	t7 = y13 & y16;
+	t8 = y5 & y1;
+	t9 = t8 ^ t7;
+	t10 = y2 & y7;
+	t11 = t10 ^ t7;
+	t12 = y9 & y11;
+	t13 = y14 & y17;
+	t14 = t13 ^ t12;
+	t15 = y8 & y10;
+	t16 = t15 ^ t12;
+	t17 = t4 ^ t14;
+	t18 = t6 ^ t16;
+	t19 = t9 ^ t14;
+	t20 = t11 ^ t16;
+	t21 = t17 ^ y20;
+	t22 = t18 ^ y19;
+	t23 = t19 ^ y21;
+	t24 = t20 ^ y18;
+
+	t25 = t21 ^ t22;
+	t26 = t21 & t23;
+	t27 = t24 ^ t26;
+	t28 = t25 & t27;
+	t29 = t28 ^ t22;
+	t30 = t23 ^ t24;
+	t31 = t22 ^ t26;
+	t32 = t31 & t30;
+	t33 = t32 ^ t24;
+	t34 = t23 ^ t33;
+	t35 = t27 ^ t33;
+	t36 = t24 & t35;
+	t37 = t36 ^ t34;
+	t38 = t27 ^ t36;
+	t39 = t29 & t38;
+	t40 = t25 ^ t39;
+
+	t41 = t40 ^ t37;
+	t42 = t29 ^ t33;
+	t43 = t29 ^ t40;
+	t44 = t33 ^ t37;
+	t45 = t42 ^ t41;
+	z0 = t44 & y15;
+	z1 = t37 & y6;
+	z2 = t33 & x7;
+	z3 = t43 & y16;
+	z4 = t40 & y1;
+	z5 = t29 & y7;
+	z6 = t42 & y11;
+	z7 = t45 & y17;
+	z8 = t41 & y10;
+	z9 = t44 & y12;
+	z10 = t37 & y3;
+	z11 = t33 & y4;
+	z12 = t43 & y13;
+	z13 = t40 & y5;
+	z14 = t29 & y2;
+	z15 = t42 & y9;
+	z16 = t45 & y14;
+	z17 = t41 & y8;
+
+	// Bottom linear transformation
+	t46 = z15 ^ z16;
+	t47 = z10 ^ z11;
+	t48 = z5 ^ z13;
+	t49 = z9 ^ z10;
+	t50 = z2 ^ z12;
+	t51 = z2 ^ z5;
+	t52 = z7 ^ z8;
+	t53 = z0 ^ z3;
+	t54 = z6 ^ z7;
+	t55 = z16 ^ z17;
+	t56 = z12 ^ t48;
+	t57 = t50 ^ t53;
+	t58 = z4 ^ t46;
+	t59 = z3 ^ t54;
+	t60 = t46 ^ t57;
+	t61 = z14 ^ t57;
+	t62 = t52 ^ t58;
+	t63 = t49 ^ t58;
+	t64 = z4 ^ t59;
+	t65 = t61 ^ t62;
+	t66 = z1 ^ t63;
+	s0 = t59 ^ t63;
+	s6 = t56 ^ ~t62;
+	s7 = t48 ^ ~t60;
+	t67 = t64 ^ t65;
+	s3 = t53 ^ t66;
+	s4 = t51 ^ t66;
+	s5 = t47 ^ t65;
+	s1 = t64 ^ ~s3;
+	s2 = t55 ^ ~t67;
+
+	q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+	q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+}
+
+// SubBytes on all 16 bytes of a state held as four little-endian columns
+static inline void _aesSubBytes(uint32_t *s)
+{
+	uint64_t a = _aesT8x8((uint64_t)s[0] | ((uint64_t)s[1] << 32));
+	uint64_t b = _aesT8x8((uint64_t)s[2] | ((uint64_t)s[3] << 32));
+	uint32_t q[8];
+	for(unsigned int p=0;p<8;++p)
+		q[p] = (uint32_t)((a >> (p * 8)) & 0xff) | ((uint32_t)((b >> (p * 8)) & 0xff) << 8);
+	_aesSboxPlanes(q);
+	a = 0;
+	b = 0;
+	for(unsigned int p=0;p<8;++p) {
+		a |= (uint64_t)(q[p] & 0xff) << (p * 8);
+		b |= (uint64_t)((q[p] >> 8) & 0xff) << (p * 8);
+	}
+	a = _aesT8x8(a);
+	b = _aesT8x8(b);
+	s[0] = (uint32_t)a;
+	s[1] = (uint32_t)(a >> 32);
+	s[2] = (uint32_t)b;
+	s[3] = (uint32_t)(b >> 32);
+}
+
+static inline uint32_t _aesSubWord(const uint32_t w)
+{
+	uint32_t s[4] = { w,0,0,0 };
+	_aesSubBytes(s);
+	return s[0];
+}
+
+static inline uint32_t _aesRot8(const uint32_t w) { return ((w >> 8) | (w << 24)); }
+static inline uint32_t _aesXtime4(const uint32_t w) { return (((w & 0x7f7f7f7fU) << 1) ^ (((w >> 7) & 0x01010101U) * 0x1bU)); }
+
+static void _aesExpandSW(const uint8_t *key,uint32_t *w)
+{
+	for(unsigned int i=0;i<8;++i)
+		w[i] = _aesLoad32(key + (i * 4));
+	uint32_t rcon = 1;
+	for(unsigned int i=8;i<60;++i) {
+		uint32_t t = w[i - 1];
+		if ((i & 7) == 0) {
+			t = _aesSubWord(_aesRot8(t)) ^ rcon;
+			rcon <<= 1;
+		} else if ((i & 7) == 4) {
+			t = _aesSubWord(t);
+		}
+		w[i] = w[i - 8] ^ t;
+	}
+}
+
+static void _aesEncryptSW(const uint32_t *rk,const uint8_t *in,uint8_t *out)
+{
+	uint32_t s[4],t[4];
+	for(unsigned int c=0;c<4;++c)
+		s[c] = _aesLoad32(in + (c * 4)) ^ rk[c];
+	for(unsigned int r=1;r<=14;++r) {
+		_aesSubBytes(s);
+		for(unsigned int c=0;c<4;++c) // ShiftRows
+			t[c] = (s[c] & 0x000000ffU) | (s[(c + 1) & 3] & 0x0000ff00U) | (s[(c + 2) & 3] & 0x00ff0000U) | (s[(c + 3) & 3] & 0xff000000U);
+		if (r == 14) {
+			for(unsigned int c=0;c<4;++c)
+				s[c] = t[c] ^ rk[56 + c];
+		} else {
+			for(unsigned int c=0;c<4;++c) { // MixColumns
+				const uint32_t r1 = _aesRot8(t[c]);
+				s[c] = _aesXtime4(t[c] ^ r1) ^ r1 ^ _aesRot8(r1) ^ _aesRot8(_aesRot8(r1)) ^ rk[(r * 4) + c];
+			}
+		}
+	}
+	for(unsigned int c=0;c<4;++c)
+		_aesStore32(out + (c * 4),s[c]);
+}
+
+// 32x32 -> 64 carry-less multiply, each partial product has at most 8 terms per 4-bit digit
+static inline uint64_t _aesBmul32(const uint32_t x,const uint32_t y)
+{
+	const uint64_t x0 = x & 0x11111111U,x1 = x & 0x22222222U,x2 = x & 0x44444444U,x3 = x & 0x88888888U;
+	const uint64_t y0 = y & 0x11111111U,y1 = y & 0x22222222U,y2 = y & 0x44444444U,y3 = y & 0x88888888U;
+	uint64_t z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+	uint64_t z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+	uint64_t z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+	uint64_t z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+	z0 &= 0x1111111111111111ULL;
+	z1 &= 0x2222222222222222ULL;
+	z2 &= 0x4444444444444444ULL;
+	z3 &= 0x8888888888888888ULL;
+	return (z0 | z1 | z2 | z3);
+}
+
+// 64x64 -> 128 carry-less multiply (Karatsuba)
+static inline void _aesClmul64(const uint64_t a,const uint64_t b,uint64_t &lo,uint64_t &hi)
+{
+	const uint32_t a0 = (uint32_t)a,a1 = (uint32_t)(a >> 32),b0 = (uint32_t)b,b1 = (uint32_t)(b >> 32);
+	const uint64_t l = _aesBmul32(a0,b0);
+	const uint64_t h = _aesBmul32(a1,b1);
+	const uint64_t m = _aesBmul32(a0 ^ a1,b0 ^ b1) ^ l ^ h;
+	lo = l ^ (m << 32);
+	hi = h ^ (m >> 32);
+}
+
+// POLYVAL dot product: r = a * b * x^-128 in GF(2^128) mod x^128 + x^127 + x^126 + x^121 + 1
+static void _aesPolyvalDotSW(uint64_t *r,const uint64_t *a,const uint64_t *b)
+{
+	uint64_t l0,l1,h0,h1,m0,m1;
+	_aesClmul64(a[0],b[0],l0,l1);
+	_aesClmul64(a[1],b[1],h0,h1);
+	_aesClmul64(a[0] ^ a[1],b[0] ^ b[1],m0,m1);
+	m0 ^= l0 ^ h0;
+	m1 ^= l1 ^ h1;
+	l1 ^= m0;
+	h0 ^= m1;
+
+	// Two Montgomery-style folds of the low half, as in the PCLMULQDQ code below
+	uint64_t t0,t1,x0,x1;
+	_aesClmul64(l0,0xc200000000000000ULL,t0,t1);
+	x0 = l1 ^ t0;
+	x1 = l0 ^ t1;
+	_aesClmul64(x0,0xc200000000000000ULL,t0,t1);
+	r[0] = h0 ^ x1 ^ t0;
+	r[1] = h1 ^ x0 ^ t1;
+}
+
+static void _aesPolyvalSW(uint64_t *acc,const uint64_t *h,const uint8_t *p,unsigned int len)
+{
+	uint64_t x[2];
+	while (len >= 16) {
+		x[0] = acc[0] ^ _aesLoad64(p);
+		x[1] = acc[1] ^ _aesLoad64(p + 8);
+		_aesPolyvalDotSW(acc,x,h);
+		p += 16;
+		len -= 16;
+	}
+	if (len) {
+		uint8_t last[16];
+		memset(last,0,sizeof(last));
+		memcpy(last,p,len);
+		x[0] = acc[0] ^ _aesLoad64(last);
+		x[1] = acc[1] ^ _aesLoad64(last + 8);
+		_aesPolyvalDotSW(acc,x,h);
+	}
+}
+
+// Derive the per-message POLYVAL key and expanded encryption key from the nonce
+static void _aesGcmSivKeysSW(const uint32_t *rk,const uint8_t *nonce,uint64_t *h,uint32_t *encRk)
+{
+	uint8_t b[16],o[16],k[48];
+	memcpy(b + 4,nonce,12);
+	for(unsigned int i=0;i<6;++i) {
+		_aesStore32(b,i);
+		_aesEncryptSW(rk,b,o);
+		memcpy(k + (i * 8),o,8);
+	}
+	h[0] = _aesLoad64(k);
+	h[1] = _aesLoad64(k + 8);
+	_aesExpandSW(k + 16,encRk);
+	Utils::burn(k,sizeof(k));
+	Utils::burn(o,sizeof(o));
+}
+
+static void _aesGcmSivTagSW(const uint32_t *encRk,const uint64_t *h,const uint8_t *nonce,const uint8_t *aad,unsigned int aadLen,const uint8_t *m,unsigned int len,uint8_t *tag)
+{
+	uint64_t acc[2] = { 0,0 };
+	_aesPolyvalSW(acc,h,aad,aadLen);
+	_aesPolyvalSW(acc,h,m,len);
+	uint8_t s[16];
+	_aesStore64(s,(uint64_t)aadLen * 8);
+	_aesStore64(s + 8,(uint64_t)len * 8);
+	_aesPolyvalSW(acc,h,s,16);
+	_aesStore64(s,acc[0]);
+	_aesStore64(s + 8,acc[1]);
+	for(unsigned int i=0;i<12;++i)
+		s[i] ^= nonce[i];
+	s[15] &= 0x7f;
+	_aesEncryptSW(encRk,s,tag);
+}
+
+static void _aesCtrSW(const uint32_t *encRk,const uint8_t *tag,const uint8_t *in,uint8_t *out,unsigned int len)
+{
+	uint8_t ctr[16],ks[16];
+	memcpy(ctr,tag,16);
+	ctr[15] |= 0x80;
+	uint32_t c = _aesLoad32(ctr);
+	while (len) {
+		_aesStore32(ctr,c++);
+		_aesEncryptSW(encRk,ctr,ks);
+		const unsigned int n = (len < 16) ? len : 16;
+		for(unsigned int i=0;i<n;++i)
+			out[i] = in[i] ^ ks[i];
+		in += n;
+		out += n;
+		len -= n;
+	}
+}
+
+/************************************************************************** */
+
+/* AES-NI and PCLMULQDQ kernel
+ *
+ * CTR runs 8 blocks at a time to cover aesenc latency, and POLYVAL folds
+ * 4 blocks per reduction using H^1..H^4 once a message is long enough to
+ * pay for computing them. The POLYVAL reduction follows Gueron's
+ * reference AES-GCM-SIV implementation. */
+
+#ifdef ZT_AES_AESNI
+
+#define ZT_AESNI_TARGET __attribute__((target("sse2,aes,pclmul")))
+
+ZT_AESNI_TARGET static inline __m128i _aesniExpandA(__m128i t1,__m128i t2)
+{
+	t2 = _mm_shuffle_epi32(t2,0xff);
+	__m128i t4 = _mm_slli_si128(t1,4);
+	t1 = _mm_xor_si128(t1,t4);
+	t4 = _mm_slli_si128(t4,4);
+	t1 = _mm_xor_si128(t1,t4);
+	t4 = _mm_slli_si128(t4,4);
+	t1 = _mm_xor_si128(t1,t4);
+	return _mm_xor_si128(t1,t2);
+}
+
+ZT_AESNI_TARGET static inline __m128i _aesniExpandB(__m128i t1,__m128i t3)
+{
+	const __m128i t2 = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(t1,0x00),0xaa);
+	__m128i t4 = _mm_slli_si128(t3,4);
+	t3 = _mm_xor_si128(t3,t4);
+	t4 = _mm_slli_si128(t4,4);
+	t3 = _mm_xor_si128(t3,t4);
+	t4 = _mm_slli_si128(t4,4);
+	t3 = _mm_xor_si128(t3,t4);
+	return _mm_xor_si128(t3,t2);
+}
+
+ZT_AESNI_TARGET static void _aesniExpand(__m128i t1,__m128i t3,__m128i *k)
+{
+	k[0] = t1;
+	k[1] = t3;
+	k[2] = t1 = _aesniExpandA(t1,_mm_aeskeygenassist_si128(t3,0x01));
+	k[3] = t3 = _aesniExpandB(t1,t3);
+	k[4] = t1 = _aesniExpandA(t1,_mm_aeskeygenassist_si128(t3,0x02));
+	k[5] = t3 = _aesniExpandB(t1,t3);
+	k[6] = t1 = _aesniExpandA(t1,_mm_aeskeygenassist_si128(t3,0x04));
+	k[7] = t3 = _aesniExpandB(t1,t3);
+	k[8] = t1 = _aesniExpandA(t1,_mm_aeskeygenassist_si128(t3,0x08));
+	k[9] = t3 = _aesniExpandB(t1,t3);
+	k[10] = t1 = _aesniExpandA(t1,_mm_aeskeygenassist_si128(t3,0x10));
+	k[11] = t3 = _aesniExpandB(t1,t3);
+	k[12] = t1 = _aesniExpandA(t1,_mm_aeskeygenassist_si128(t3,0x20));
+	k[13] = t3 = _aesniExpandB(t1,t3);
+	k[14] = _aesniExpandA(t1,_mm_aeskeygenassist_si128(t3,0x40));
+}
+
+ZT_AESNI_TARGET static inline __m128i _aesniEncrypt(const __m128i *k,__m128i b)
+{
+	b = _mm_xor_si128(b,k[0]);
+	for(unsigned int r=1;r<14;++r)
+		b = _mm_aesenc_si128(b,k[r]);
+	return _mm_aesenclast_si128(b,k[14]);
+}
+
+ZT_AESNI_TARGET static void _aesniCtr(const __m128i *k,__m128i ctr,const uint8_t *in,uint8_t *out,unsigned int len)
+{
+	while (len >= 128) {
+		__m128i b[8];
+		for(int i=0;i<8;++i)
+			b[i] = _mm_xor_si128(_mm_add_epi32(ctr,_mm_set_epi32(0,0,0,i)),k[0]);
+		ctr = _mm_add_epi32(ctr,_mm_set_epi32(0,0,0,8));
+		for(unsigned int r=1;r<14;++r) {
+			for(int i=0;i<8;++i)
+				b[i] = _mm_aesenc_si128(b[i],k[r]);
+		}
+		for(int i=0;i<8;++i) {
+			b[i] = _mm_aesenclast_si128(b[i],k[14]);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out + (i * 16)),_mm_xor_si128(b[i],_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + (i * 16)))));
+		}
+		in += 128;
+		out += 128;
+		len -= 128;
+	}
+	while (len >= 16) {
+		const __m128i ks = _aesniEncrypt(k,ctr);
+		ctr = _mm_add_epi32(ctr,_mm_set_epi32(0,0,0,1));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(out),_mm_xor_si128(ks,_mm_loadu_si128(reinterpret_cast<const __m128i *>(in))));
+		in += 16;
+		out += 16;
+		len -= 16;
+	}
+	if (len) {
+		uint8_t ks[16];
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(ks),_aesniEncrypt(k,ctr));
+		for(unsigned int i=0;i<len;++i)
+			out[i] = in[i] ^ ks[i];
+	}
+}
+
+// Accumulate an unreduced 256-bit carry-less product a * b
+ZT_AESNI_TARGET static inline void _aesniClmul(const __m128i a,const __m128i b,__m128i &lo,__m128i &mid,__m128i &hi)
+{
+	lo = _mm_xor_si128(lo,_mm_clmulepi64_si128(a,b,0x00));
+	hi = _mm_xor_si128(hi,_mm_clmulepi64_si128(a,b,0x11));
+	mid = _mm_xor_si128(mid,_mm_xor_si128(_mm_clmulepi64_si128(a,b,0x10),_mm_clmulepi64_si128(a,b,0x01)));
+}
+
+// Reduce an accumulated product, multiplying it by x^-128
+ZT_AESNI_TARGET static inline __m128i _aesniPolyvalReduce(__m128i lo,const __m128i mid,const __m128i hi)
+{
+	const __m128i poly = _mm_set_epi32((int)0xc2000000,0,0,1);
+	lo = _mm_xor_si128(lo,_mm_slli_si128(mid,8));
+	const __m128i h = _mm_xor_si128(hi,_mm_srli_si128(mid,8));
+	lo = _mm_xor_si128(_mm_shuffle_epi32(lo,78),_mm_clmulepi64_si128(lo,poly,0x10));
+	lo = _mm_xor_si128(_mm_shuffle_epi32(lo,78),_mm_clmulepi64_si128(lo,poly,0x10));
+	return _mm_xor_si128(h,lo);
+}
+
+ZT_AESNI_TARGET static inline __m128i _aesniPolyvalDot(const __m128i a,const __m128i b)
+{
+	__m128i lo = _mm_setzero_si128(),mid = _mm_setzero_si128(),hi = _mm_setzero_si128();
+	_aesniClmul(a,b,lo,mid,hi);
+	return _aesniPolyvalReduce(lo,mid,hi);
+}
+
+// hp[] holds H, H^2, H^3, H^4 (only H is needed if wide is false)
+ZT_AESNI_TARGET static __m128i _aesniPolyval(__m128i acc,const __m128i *hp,const bool wide,const uint8_t *p,unsigned int len)
+{
+	if (wide) {
+		while (len >= 64) {
+			__m128i lo = _mm_setzero_si128(),mid = _mm_setzero_si128(),hi = _mm_setzero_si128();
+			_aesniClmul(_mm_xor_si128(acc,_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))),hp[3],lo,mid,hi);
+			_aesniClmul(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16)),hp[2],lo,mid,hi);
+			_aesniClmul(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 32)),hp[1],lo,mid,hi);
+			_aesniClmul(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 48)),hp[0],lo,mid,hi);
+			acc = _aesniPolyvalReduce(lo,mid,hi);
+			p += 64;
+			len -= 64;
+		}
+	}
+	while (len >= 16) {
+		acc = _aesniPolyvalDot(_mm_xor_si128(acc,_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))),hp[0]);
+		p += 16;
+		len -= 16;
+	}
+	if (len) {
+		uint8_t last[16];
+		memset(last,0,sizeof(last));
+		memcpy(last,p,len);
+		acc = _aesniPolyvalDot(_mm_xor_si128(acc,_mm_loadu_si128(reinterpret_cast<const __m128i *>(last))),hp[0]);
+	}
+	return acc;
+}
+
+ZT_AESNI_TARGET static void _aesniGcmSivKeys(const uint32_t *rk,const uint8_t *nonce,__m128i &h,__m128i *encK)
+{
+	__m128i k[15];
+	for(unsigned int r=0;r<15;++r)
+		k[r] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rk + (r * 4)));
+	uint8_t nb[16];
+	memset(nb,0,4);
+	memcpy(nb + 4,nonce,12);
+	const __m128i n = _mm_loadu_si128(reinterpret_cast<const __m128i *>(nb));
+	__m128i b[6];
+	for(int i=0;i<6;++i)
+		b[i] = _mm_xor_si128(_mm_xor_si128(n,_mm_set_epi32(0,0,0,i)),k[0]);
+	for(unsigned int r=1;r<14;++r) {
+		for(int i=0;i<6;++i)
+			b[i] = _mm_aesenc_si128(b[i],k[r]);
+	}
+	for(int i=0;i<6;++i)
+		b[i] = _mm_aesenclast_si128(b[i],k[14]);
+	h = _mm_unpacklo_epi64(b[0],b[1]);
+	_aesniExpand(_mm_unpacklo_epi64(b[2],b[3]),_mm_unpacklo_epi64(b[4],b[5]),encK);
+}
+
+ZT_AESNI_TARGET static __m128i _aesniGcmSivTag(const __m128i *encK,const __m128i h,const uint8_t *nonce,const uint8_t *aad,unsigned int aadLen,const uint8_t *m,unsigned int len)
+{
+	__m128i hp[4];
+	hp[0] = h;
+	const bool wide = ((aadLen >= 64)||(len >= 64));
+	if (wide) {
+		hp[1] = _aesniPolyvalDot(h,h);
+		hp[2] = _aesniPolyvalDot(hp[1],h);
+		hp[3] = _aesniPolyvalDot(hp[2],h);
+	}
+	__m128i acc = _aesniPolyval(_mm_setzero_si128(),hp,wide,aad,aadLen);
+	acc = _aesniPolyval(acc,hp,wide,m,len);
+	acc = _aesniPolyvalDot(_mm_xor_si128(acc,_mm_set_epi64x((long long)((uint64_t)len * 8),(long long)((uint64_t)aadLen * 8))),h);
+	uint8_t nb[16];
+	memcpy(nb,nonce,12);
+	memset(nb + 12,0,4);
+	acc = _mm_xor_si128(acc,_mm_loadu_si128(reinterpret_cast<const __m128i *>(nb)));
+	acc = _mm_and_si128(acc,_mm_set_epi32(0x7fffffff,-1,-1,-1));
+	return _aesniEncrypt(encK,acc);
+}
+
+ZT_AESNI_TARGET static void _aesniGcmSivEncrypt(const uint32_t *rk,const uint8_t *nonce,const uint8_t *aad,unsigned int aadLen,const uint8_t *in,uint8_t *out,unsigned int len,uint8_t *tag)
+{
+	__m128i h,encK[15];
+	_aesniGcmSivKeys(rk,nonce,h,encK);
+	const __m128i t = _aesniGcmSivTag(encK,h,nonce,aad,aadLen,in,len);
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(tag),t);
+	_aesniCtr(encK,_mm_or_si128(t,_mm_set_epi32((int)0x80000000,0,0,0)),in,out,len);
+}
+
+ZT_AESNI_TARGET static bool _aesniGcmSivDecrypt(const uint32_t *rk,const uint8_t *nonce,const uint8_t *aad,unsigned int aadLen,const uint8_t *in,uint8_t *out,unsigned int len,const uint8_t *tag)
+{
+	__m128i h,encK[15];
+	_aesniGcmSivKeys(rk,nonce,h,encK);
+	const __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i *>(tag));
+	_aesniCtr(encK,_mm_or_si128(t,_mm_set_epi32((int)0x80000000,0,0,0)),in,out,len);
+	const __m128i expected = _aesniGcmSivTag(encK,h,nonce,aad,aadLen,out,len);
+	return (_mm_movemask_epi8(_mm_cmpeq_epi8(t,expected)) == 0xffff);
+}
+
+#endif // ZT_AES_AESNI
+
+/************************************************************************** */
+
+static AES::Kernel _aesBestKernel()
+{
+#ifdef ZT_AES_AESNI
+	__builtin_cpu_init();
+	if ((__builtin_cpu_supports("aes"))&&(__builtin_cpu_supports("pclmul")))
+		return AES::KERNEL_AESNI;
+#endif
+	return AES::KERNEL_SOFTWARE;
+}
+
+} // anonymous namespace
+
+// Anything that runs before this initializer sees KERNEL_SOFTWARE, which is always safe
+AES::Kernel AES::_kernel = _aesBestKernel();
+
+bool AES::kernelSupported(Kernel k)
+{
+	return ((unsigned int)k <= (unsigned int)_aesBestKernel());
+}
+
+bool AES::setKernel(Kernel k)
+{
+	if (!kernelSupported(k))
+		return false;
+	_kernel = k;
+	return true;
+}
+
+void AES::init(const void *key)
+{
+	// Done once per key so the constant-time code is fine for both kernels
+	_aesExpandSW(reinterpret_cast<const uint8_t *>(key),_k);
+}
+
+void AES::encrypt(const void *in,void *out) const
+{
+	_aesEncryptSW(_k,reinterpret_cast<const uint8_t *>(in),reinterpret_cast<uint8_t *>(out));
+}
+
+void AES::gcmSivEncrypt(const void *nonce,const void *aad,unsigned int aadLen,const void *in,void *out,unsigned int len,void *tag) const
+{
+#ifdef ZT_AES_AESNI
+	if (_kernel == KERNEL_AESNI) {
+		_aesniGcmSivEncrypt(_k,reinterpret_cast<const uint8_t *>(nonce),reinterpret_cast<const uint8_t *>(aad),aadLen,reinterpret_cast<const uint8_t *>(in),reinterpret_cast<uint8_t *>(out),len,reinterpret_cast<uint8_t *>(tag));
+		return;
+	}
+#endif
+	uint64_t h[2];
+	uint32_t encRk[60];
+	_aesGcmSivKeysSW(_k,reinterpret_cast<const uint8_t *>(nonce),h,encRk);
+	_aesGcmSivTagSW(encRk,h,reinterpret_cast<const uint8_t *>(nonce),reinterpret_cast<const uint8_t *>(aad),aadLen,reinterpret_cast<const uint8_t *>(in),len,reinterpret_cast<uint8_t *>(tag));
+	_aesCtrSW(encRk,reinterpret_cast<const uint8_t *>(tag),reinterpret_cast<const uint8_t *>(in),reinterpret_cast<uint8_t *>(out),len);
+	Utils::burn(encRk,sizeof(encRk));
+	Utils::burn(h,sizeof(h));
+}
+
+bool AES::gcmSivDecrypt(const void *nonce,const void *aad,unsigned int aadLen,const void *in,void *out,unsigned int len,const void *tag) const
+{
+#ifdef ZT_AES_AESNI
+	if (_kernel == KERNEL_AESNI)
+		return _aesniGcmSivDecrypt(_k,reinterpret_cast<const uint8_t *>(nonce),reinterpret_cast<const uint8_t *>(aad),aadLen,reinterpret_cast<const uint8_t *>(in),reinterpret_cast<uint8_t *>(out),len,reinterpret_cast<const uint8_t *>(tag));
+#endif
+	uint64_t h[2];
+	uint32_t encRk[60];
+	uint8_t expected[16];
+	_aesGcmSivKeysSW(_k,reinterpret_cast<const uint8_t *>(nonce),h,encRk);
+	_aesCtrSW(encRk,reinterpret_cast<const uint8_t *>(tag),reinterpret_cast<const uint8_t *>(in),reinterpret_cast<uint8_t *>(out),len);
+	_aesGcmSivTagSW(encRk,h,reinterpret_cast<const uint8_t *>(nonce),reinterpret_cast<const uint8_t *>(aad),aadLen,reinterpret_cast<const uint8_t *>(out),len,expected);
+	Utils::burn(encRk,sizeof(encRk));
+	Utils::burn(h,sizeof(h));
+	return Utils::secureEq(expected,tag,16);
+}
+
+} // namespace ZeroTier
@@ -0,0 +1,151 @@
+/*
+ * ZeroTier One - Network Virtualization Everywhere
+ * Copyright (C) 2011-2019  ZeroTier, Inc.  https://www.zerotier.com/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * --
+ *
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial closed-source software that incorporates or links
+ * directly against ZeroTier software without disclosing the source code
+ * of your own application.
+ */
+
+#ifndef ZT_AES_HPP
+#define ZT_AES_HPP
+
+#include <stdint.h>
+
+#include "Constants.hpp"
+#include "Utils.hpp"
+
+// AES-NI and PCLMULQDQ code is compiled with per-function target attributes and picked at runtime
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && (!defined(ZT_AES_NO_AESNI))
+#define ZT_AES_AESNI 1
+#endif
+
+#define ZT_AES_KEY_LEN 32
+#define ZT_AES_BLOCK_LEN 16
+#define ZT_AES_GCM_SIV_NONCE_LEN 12
+#define ZT_AES_GCM_SIV_TAG_LEN 16
+
+namespace ZeroTier {
+
+/**
+ * AES-256 and AES-256-GCM-SIV (RFC 8452) authenticated encryption
+ *
+ * An instance holds the key schedule for a 256-bit key. GCM-SIV derives
+ * fresh per-message keys from it and the nonce, and is resistant to
+ * nonce reuse (which only reveals whether two messages are identical).
+ *
+ * The software kernel uses a bitsliced S-box and carry-less multiplies
+ * built from integer multiplies, so it has no secret-dependent table
+ * lookups or branches. It is much slower than the AES-NI kernel and is
+ * there for correctness, not speed.
+ */
+class AES
+{
+public:
+	/**
+	 * Kernels, in order of preference
+	 */
+	enum Kernel
+	{
+		KERNEL_SOFTWARE = 0,   // constant-time portable C
+		KERNEL_AESNI = 1       // AES-NI and PCLMULQDQ
+	};
+
+	AES() {}
+	~AES() { Utils::burn(_k,sizeof(_k)); }
+
+	/**
+	 * @param key 256-bit (32 byte) key
+	 */
+	AES(const void *key) { init(key); }
+
+	/**
+	 * Set key
+	 *
+	 * @param key 256-bit (32 byte) key
+	 */
+	void init(const void *key);
+
+	/**
+	 * Encrypt a single block
+	 *
+	 * @param in 16-byte input block
+	 * @param out 16-byte output block (may be the same as in)
+	 */
+	void encrypt(const void *in,void *out) const;
+
+	/**
+	 * Encrypt and authenticate with AES-GCM-SIV
+	 *
+	 * @param nonce 12-byte nonce
+	 * @param aad Additional data to authenticate but not encrypt
+	 * @param aadLen Length of additional data
+	 * @param in Plaintext
+	 * @param out Ciphertext output (may be the same as in)
+	 * @param len Length of plaintext and ciphertext
+	 * @param tag Buffer to receive 16-byte tag
+	 */
+	void gcmSivEncrypt(const void *nonce,const void *aad,unsigned int aadLen,const void *in,void *out,unsigned int len,void *tag) const;
+
+	/**
+	 * Decrypt and verify with AES-GCM-SIV
+	 *
+	 * The plaintext is written to out before it is verified, so out must
+	 * be discarded if this returns false.
+	 *
+	 * @param nonce 12-byte nonce
+	 * @param aad Additional authenticated data
+	 * @param aadLen Length of additional data
+	 * @param in Ciphertext
+	 * @param out Plaintext output (may be the same as in)
+	 * @param len Length of ciphertext and plaintext
+	 * @param tag 16-byte tag to check
+	 * @return True if tag is valid
+	 */
+	bool gcmSivDecrypt(const void *nonce,const void *aad,unsigned int aadLen,const void *in,void *out,unsigned int len,const void *tag) const;
+
+	/**
+	 * @return Kernel currently in use, selected from CPU features at startup
+	 */
+	static inline Kernel kernel() { return _kernel; }
+
+	/**
+	 * @param k Kernel to check
+	 * @return True if this build and this CPU can run k
+	 */
+	static bool kernelSupported(Kernel k);
+
+	/**
+	 * Override the kernel selected at startup (used by self-test and benchmarks)
+	 *
+	 * @param k Kernel to use
+	 * @return False if k is not supported (in which case nothing changes)
+	 */
+	static bool setKernel(Kernel k);
+
+private:
+	static Kernel _kernel;
+
+	uint32_t _k[60]; // expanded key, round key bytes in order (little-endian words)
+};
+
+} // namespace ZeroTier
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * ZeroTier One - Network Virtualization Everywhere
+ * Copyright (C) 2011-2019  ZeroTier, Inc.  https://www.zerotier.com/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * --
+ *
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial closed-source software that incorporates or links
+ * directly against ZeroTier software without disclosing the source code
+ * of your own application.
+ */
+
+#ifndef ZT_BORROWEDPTR_HPP
+#define ZT_BORROWEDPTR_HPP
+
+#include "Constants.hpp"
+#include "SharedPtr.hpp"
+
+namespace ZeroTier {
+
+/**
+ * Non-owning pointer to a reference counted object
+ *
+ * A BorrowedPtr doesn't hold a reference, so creating and copying one never
+ * touches the object's reference count. It is only valid while something
+ * else is known to hold a reference, such as an entry in a table read under
+ * an Epoch::Guard or a SharedPtr in an enclosing scope. Use promote() to
+ * keep the object beyond that.
+ */
+template<typename T>
+class BorrowedPtr
+{
+public:
+	BorrowedPtr() : _ptr((T *)0) {}
+	BorrowedPtr(const SharedPtr<T> &sp) : _ptr(sp.ptr()) {}
+	explicit BorrowedPtr(T *obj) : _ptr(obj) {}
+
+	inline operator bool() const { return (_ptr != (T *)0); }
+	inline T &operator*() const { return *_ptr; }
+	inline T *operator->() const { return _ptr; }
+
+	/**
+	 * @return Raw pointer to borrowed object
+	 */
+	inline T *ptr() const { return _ptr; }
+
+	/**
+	 * Take a reference to the borrowed object
+	 *
+	 * This must be called while the borrow is still valid.
+	 *
+	 * @return Owning pointer to the same object, or NULL if this is NULL
+	 */
+	inline SharedPtr<T> promote() const { return (_ptr) ? SharedPtr<T>(_ptr) : SharedPtr<T>(); }
+
+	inline bool operator==(const BorrowedPtr &bp) const { return (_ptr == bp._ptr); }
+	inline bool operator!=(const BorrowedPtr &bp) const { return (_ptr != bp._ptr); }
+	inline bool operator==(const SharedPtr<T> &sp) const { return (_ptr == sp.ptr()); }
+	inline bool operator!=(const SharedPtr<T> &sp) const { return (_ptr != sp.ptr()); }
+
+private:
+	T *_ptr;
+};
+
+} // namespace ZeroTier
+
+#endif
@@ -26,6 +26,13 @@ Derived from public domain code by D. J. Bernstein.
 #pragma GCC diagnostic ignored "-Wunused-function"
 #endif
 
+// Use radix 2^51 field arithmetic (five 64-bit limbs, 128-bit products)
+// where the compiler has a 128-bit integer type, which in practice means
+// 64-bit GCC and Clang targets. Otherwise use the portable reference code.
+#if defined(__SIZEOF_INT128__) && (!defined(ZT_C25519_NO_RADIX51))
+#define ZT_C25519_RADIX51 1
+#endif
+
 namespace {
 
 #define crypto_int32 int32_t
@@ -37,6 +44,8 @@ namespace {
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
+#ifndef ZT_C25519_RADIX51
+
 typedef uint8_t u8;
 typedef int32_t s32;
 typedef int64_t limb;
@@ -749,16 +758,26 @@ static inline void crypto_scalarmult_base(unsigned char *q,const unsigned char *
 	crypto_scalarmult(q,n,base);
 }
 
+#endif // !ZT_C25519_RADIX51
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
 // Ed25519 ref from: http://bench.cr.yp.to/supercop.html
 
+#ifdef ZT_C25519_RADIX51
+typedef struct
+{
+	crypto_uint64 v[5];
+}
+fe25519;
+#else
 typedef struct
 {
 	crypto_uint32 v[32];
 }
 fe25519;
+#endif
 
 typedef struct
 {
@@ -822,6 +841,211 @@ static inline crypto_uint32 ge(crypto_uint32 a,crypto_uint32 b) /* 16-bit inputs
 	return x;
 }
 
+#ifdef ZT_C25519_RADIX51
+
+// Radix 2^51: v[0] + v[1]*2^51 + v[2]*2^102 + v[3]*2^153 + v[4]*2^204. Every
+// operation leaves limbs below 2^52, which keeps all intermediate products of
+// mul and square within 128 bits.
+
+typedef unsigned __int128 fe25519_uint128;
+
+#define ZT_FE25519_MASK51 0x7ffffffffffffULL
+
+static inline crypto_uint64 fe25519_load64(const unsigned char *x)
+{
+	crypto_uint64 r = 0;
+	for(int i=7;i>=0;--i)
+		r = (r << 8) | (crypto_uint64)x[i];
+	return r;
+}
+
+static inline void fe25519_store64(unsigned char *r,crypto_uint64 x)
+{
+	for(int i=0;i<8;++i) {
+		r[i] = (unsigned char)x;
+		x >>= 8;
+	}
+}
+
+/* one carry pass, limbs end up below 2^51 (v[0] slightly above at most) */
+static inline void fe25519_carry(fe25519 *r)
+{
+	crypto_uint64 c;
+	c = r->v[0] >> 51; r->v[0] &= ZT_FE25519_MASK51; r->v[1] += c;
+	c = r->v[1] >> 51; r->v[1] &= ZT_FE25519_MASK51; r->v[2] += c;
+	c = r->v[2] >> 51; r->v[2] &= ZT_FE25519_MASK51; r->v[3] += c;
+	c = r->v[3] >> 51; r->v[3] &= ZT_FE25519_MASK51; r->v[4] += c;
+	c = r->v[4] >> 51; r->v[4] &= ZT_FE25519_MASK51; r->v[0] += c * 19;
+}
+
+/* reduction modulo 2^255-19 */
+static inline void fe25519_freeze(fe25519 *r)
+{
+	crypto_uint64 c;
+	fe25519_carry(r);
+	fe25519_carry(r);
+
+	/* now r < 2^255; add 19 and see whether it reaches 2^255, i.e. r >= p */
+	r->v[0] += 19;
+	fe25519_carry(r);
+
+	/* subtract the 19 again by adding 2^255-19 and dropping 2^255 */
+	r->v[0] += 0x8000000000000ULL - 19;
+	r->v[1] += 0x8000000000000ULL - 1;
+	r->v[2] += 0x8000000000000ULL - 1;
+	r->v[3] += 0x8000000000000ULL - 1;
+	r->v[4] += 0x8000000000000ULL - 1;
+	c = r->v[0] >> 51; r->v[0] &= ZT_FE25519_MASK51; r->v[1] += c;
+	c = r->v[1] >> 51; r->v[1] &= ZT_FE25519_MASK51; r->v[2] += c;
+	c = r->v[2] >> 51; r->v[2] &= ZT_FE25519_MASK51; r->v[3] += c;
+	c = r->v[3] >> 51; r->v[3] &= ZT_FE25519_MASK51; r->v[4] += c;
+	r->v[4] &= ZT_FE25519_MASK51;
+}
+
+static inline void fe25519_unpack(fe25519 *r, const unsigned char x[32])
+{
+	r->v[0] = fe25519_load64(x) & ZT_FE25519_MASK51;
+	r->v[1] = (fe25519_load64(x + 6) >> 3) & ZT_FE25519_MASK51;
+	r->v[2] = (fe25519_load64(x + 12) >> 6) & ZT_FE25519_MASK51;
+	r->v[3] = (fe25519_load64(x + 19) >> 1) & ZT_FE25519_MASK51;
+	r->v[4] = (fe25519_load64(x + 24) >> 12) & ZT_FE25519_MASK51;
+}
+
+static inline void fe25519_pack(unsigned char r[32], const fe25519 *x)
+{
+	fe25519 y = *x;
+	fe25519_freeze(&y);
+	fe25519_store64(r,y.v[0] | (y.v[1] << 51));
+	fe25519_store64(r + 8,(y.v[1] >> 13) | (y.v[2] << 38));
+	fe25519_store64(r + 16,(y.v[2] >> 26) | (y.v[3] << 25));
+	fe25519_store64(r + 24,(y.v[3] >> 39) | (y.v[4] << 12));
+}
+
+static inline int fe25519_iseq_vartime(const fe25519 *x, const fe25519 *y)
+{
+	unsigned char t1[32],t2[32];
+	fe25519_pack(t1,x);
+	fe25519_pack(t2,y);
+	return (memcmp(t1,t2,32) == 0) ? 1 : 0;
+}
+
+static inline void fe25519_cmov(fe25519 *r, const fe25519 *x, unsigned char b)
+{
+	const crypto_uint64 mask = -((crypto_uint64)b);
+	for(int i=0;i<5;i++) r->v[i] ^= mask & (x->v[i] ^ r->v[i]);
+}
+
+/* Constant-time version of: if(b) swap(p,q) */
+static inline void fe25519_cswap(fe25519 *p, fe25519 *q, unsigned int b)
+{
+	const crypto_uint64 mask = -((crypto_uint64)b);
+	for(int i=0;i<5;i++) {
+		const crypto_uint64 t = mask & (p->v[i] ^ q->v[i]);
+		p->v[i] ^= t;
+		q->v[i] ^= t;
+	}
+}
+
+static inline unsigned char fe25519_getparity(const fe25519 *x)
+{
+	fe25519 t = *x;
+	fe25519_freeze(&t);
+	return (unsigned char)(t.v[0] & 1);
+}
+
+static inline void fe25519_setone(fe25519 *r)
+{
+	r->v[0] = 1;
+	r->v[1] = 0;
+	r->v[2] = 0;
+	r->v[3] = 0;
+	r->v[4] = 0;
+}
+
+static inline void fe25519_setzero(fe25519 *r)
+{
+	for(int i=0;i<5;i++) r->v[i] = 0;
+}
+
+static inline void fe25519_add(fe25519 *r, const fe25519 *x, const fe25519 *y)
+{
+	for(int i=0;i<5;i++) r->v[i] = x->v[i] + y->v[i];
+	fe25519_carry(r);
+}
+
+/* x + 4p - y, which can't go negative since limbs stay below 2^52 */
+static inline void fe25519_sub(fe25519 *r, const fe25519 *x, const fe25519 *y)
+{
+	r->v[0] = (x->v[0] + 0x1fffffffffffb4ULL) - y->v[0];
+	r->v[1] = (x->v[1] + 0x1ffffffffffffcULL) - y->v[1];
+	r->v[2] = (x->v[2] + 0x1ffffffffffffcULL) - y->v[2];
+	r->v[3] = (x->v[3] + 0x1ffffffffffffcULL) - y->v[3];
+	r->v[4] = (x->v[4] + 0x1ffffffffffffcULL) - y->v[4];
+	fe25519_carry(r);
+}
+
+static inline void fe25519_neg(fe25519 *r, const fe25519 *x)
+{
+	fe25519 t;
+	fe25519_setzero(&t);
+	fe25519_sub(r, &t, x);
+}
+
+/* propagate carries out of 128-bit column sums into r */
+static inline void fe25519_carry128(fe25519 *r, fe25519_uint128 t0, fe25519_uint128 t1, fe25519_uint128 t2, fe25519_uint128 t3, fe25519_uint128 t4)
+{
+	t1 += (crypto_uint64)(t0 >> 51);
+	t2 += (crypto_uint64)(t1 >> 51);
+	t3 += (crypto_uint64)(t2 >> 51);
+	t4 += (crypto_uint64)(t3 >> 51);
+	crypto_uint64 r0 = ((crypto_uint64)t0 & ZT_FE25519_MASK51) + ((crypto_uint64)(t4 >> 51) * 19);
+	crypto_uint64 r1 = (crypto_uint64)t1 & ZT_FE25519_MASK51;
+	r1 += r0 >> 51;
+	r->v[0] = r0 & ZT_FE25519_MASK51;
+	r->v[1] = r1;
+	r->v[2] = (crypto_uint64)t2 & ZT_FE25519_MASK51;
+	r->v[3] = (crypto_uint64)t3 & ZT_FE25519_MASK51;
+	r->v[4] = (crypto_uint64)t4 & ZT_FE25519_MASK51;
+}
+
+static inline void fe25519_mul(fe25519 *r, const fe25519 *x, const fe25519 *y)
+{
+	const crypto_uint64 x0 = x->v[0], x1 = x->v[1], x2 = x->v[2], x3 = x->v[3], x4 = x->v[4];
+	const crypto_uint64 y0 = y->v[0], y1 = y->v[1], y2 = y->v[2], y3 = y->v[3], y4 = y->v[4];
+	const crypto_uint64 y1_19 = y1 * 19, y2_19 = y2 * 19, y3_19 = y3 * 19, y4_19 = y4 * 19;
+	fe25519_carry128(r,
+		(fe25519_uint128)x0 * y0 + (fe25519_uint128)x1 * y4_19 + (fe25519_uint128)x2 * y3_19 + (fe25519_uint128)x3 * y2_19 + (fe25519_uint128)x4 * y1_19,
+		(fe25519_uint128)x0 * y1 + (fe25519_uint128)x1 * y0 + (fe25519_uint128)x2 * y4_19 + (fe25519_uint128)x3 * y3_19 + (fe25519_uint128)x4 * y2_19,
+		(fe25519_uint128)x0 * y2 + (fe25519_uint128)x1 * y1 + (fe25519_uint128)x2 * y0 + (fe25519_uint128)x3 * y4_19 + (fe25519_uint128)x4 * y3_19,
+		(fe25519_uint128)x0 * y3 + (fe25519_uint128)x1 * y2 + (fe25519_uint128)x2 * y1 + (fe25519_uint128)x3 * y0 + (fe25519_uint128)x4 * y4_19,
+		(fe25519_uint128)x0 * y4 + (fe25519_uint128)x1 * y3 + (fe25519_uint128)x2 * y2 + (fe25519_uint128)x3 * y1 + (fe25519_uint128)x4 * y0);
+}
+
+static inline void fe25519_square(fe25519 *r, const fe25519 *x)
+{
+	const crypto_uint64 x0 = x->v[0], x1 = x->v[1], x2 = x->v[2], x3 = x->v[3], x4 = x->v[4];
+	const crypto_uint64 x0_2 = x0 * 2, x1_2 = x1 * 2, x2_2 = x2 * 2, x3_2 = x3 * 2;
+	const crypto_uint64 x3_19 = x3 * 19, x4_19 = x4 * 19;
+	fe25519_carry128(r,
+		(fe25519_uint128)x0 * x0 + (fe25519_uint128)x1_2 * x4_19 + (fe25519_uint128)x2_2 * x3_19,
+		(fe25519_uint128)x0_2 * x1 + (fe25519_uint128)x2_2 * x4_19 + (fe25519_uint128)x3 * x3_19,
+		(fe25519_uint128)x0_2 * x2 + (fe25519_uint128)x1 * x1 + (fe25519_uint128)x3_2 * x4_19,
+		(fe25519_uint128)x0_2 * x3 + (fe25519_uint128)x1_2 * x2 + (fe25519_uint128)x4 * x4_19,
+		(fe25519_uint128)x0_2 * x4 + (fe25519_uint128)x1_2 * x3 + (fe25519_uint128)x2 * x2);
+}
+
+static inline void fe25519_mul121665(fe25519 *r, const fe25519 *x)
+{
+	fe25519_carry128(r,
+		(fe25519_uint128)x->v[0] * 121665,
+		(fe25519_uint128)x->v[1] * 121665,
+		(fe25519_uint128)x->v[2] * 121665,
+		(fe25519_uint128)x->v[3] * 121665,
+		(fe25519_uint128)x->v[4] * 121665);
+}
+
+#else // !ZT_C25519_RADIX51
+
 static inline crypto_uint32 times19(crypto_uint32 a)
 {
 	return (a << 4) + (a << 1) + a;
@@ -995,6 +1219,8 @@ static inline void fe25519_square(fe25519 *r, const fe25519 *x)
 	fe25519_mul(r, x, x);
 }
 
+#endif // ZT_C25519_RADIX51
+
 static inline void fe25519_invert(fe25519 *r, const fe25519 *x)
 {
 	fe25519 z2;
@@ -1116,6 +1342,70 @@ static inline void fe25519_pow2523(fe25519 *r, const fe25519 *x)
 	/* 2^252 - 3 */ fe25519_mul(r,&t,x);
 }
 
+#ifdef ZT_C25519_RADIX51
+
+/* X25519 Montgomery ladder (RFC 7748) over the radix 2^51 field code above */
+static void crypto_scalarmult(unsigned char *mypublic, const unsigned char *secret, const unsigned char *basepoint)
+{
+	unsigned char e[32];
+	fe25519 x1, x2, z2, x3, z3, a, aa, b, bb, c, d, da, cb, ee, t;
+	unsigned int swap = 0;
+	int pos;
+
+	for(pos=0;pos<32;++pos) e[pos] = secret[pos];
+	e[0] &= 248;
+	e[31] &= 127;
+	e[31] |= 64;
+
+	fe25519_unpack(&x1, basepoint);
+	fe25519_setone(&x2);
+	fe25519_setzero(&z2);
+	x3 = x1;
+	fe25519_setone(&z3);
+
+	for(pos=254;pos>=0;--pos) {
+		const unsigned int bit = (e[pos >> 3] >> (pos & 7)) & 1;
+		swap ^= bit;
+		fe25519_cswap(&x2, &x3, swap);
+		fe25519_cswap(&z2, &z3, swap);
+		swap = bit;
+
+		fe25519_add(&a, &x2, &z2);
+		fe25519_sub(&b, &x2, &z2);
+		fe25519_add(&c, &x3, &z3);
+		fe25519_sub(&d, &x3, &z3);
+		fe25519_square(&aa, &a);
+		fe25519_square(&bb, &b);
+		fe25519_mul(&da, &d, &a);
+		fe25519_mul(&cb, &c, &b);
+		fe25519_sub(&ee, &aa, &bb);
+
+		fe25519_add(&t, &da, &cb);
+		fe25519_square(&x3, &t); /* x3 = (DA+CB)^2 */
+		fe25519_sub(&t, &da, &cb);
+		fe25519_square(&t, &t);
+		fe25519_mul(&z3, &x1, &t); /* z3 = x1*(DA-CB)^2 */
+		fe25519_mul(&x2, &aa, &bb); /* x2 = AA*BB */
+		fe25519_mul121665(&t, &ee);
+		fe25519_add(&t, &t, &aa);
+		fe25519_mul(&z2, &ee, &t); /* z2 = E*(AA+a24*E) */
+	}
+	fe25519_cswap(&x2, &x3, swap);
+	fe25519_cswap(&z2, &z3, swap);
+
+	fe25519_invert(&z2, &z2);
+	fe25519_mul(&x2, &x2, &z2);
+	fe25519_pack(mypublic, &x2);
+}
+
+static const unsigned char base[32] = {9};
+static inline void crypto_scalarmult_base(unsigned char *q,const unsigned char *n)
+{
+	crypto_scalarmult(q,n,base);
+}
+
+#endif // ZT_C25519_RADIX51
+
 static const crypto_uint32 m[32] = {0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 0xD6, 0x9C, 0xF7, 0xA2, 0xDE, 0xF9, 0xDE, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10};
 static const crypto_uint32 mu[33] = {0x1B, 0x13, 0x2C, 0x0A, 0xA3, 0xE5, 0x9C, 0xED, 0xA7, 0x29, 0x63, 0x08, 0x5D, 0x21, 0x06, 0x21, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F};
 
@@ -1308,6 +1598,877 @@ static inline void sc25519_2interleave2(unsigned char r[127], const sc25519 *s1,
 	r[126] = ((s1->v[31] >> 4) & 3) ^ (((s2->v[31] >> 4) & 3) << 2);
 }
 
+#ifdef ZT_C25519_RADIX51
+
+/* d */
+static const fe25519 ge25519_ecd = {{0x34dca135978a3ULL, 0x1a8283b156ebdULL, 0x5e7a26001c029ULL, 0x739c663a03cbbULL, 0x52036cee2b6ffULL}};
+/* 2*d */
+static const fe25519 ge25519_ec2d = {{0x69b9426b2f159ULL, 0x35050762add7aULL, 0x3cf44c0038052ULL, 0x6738cc7407977ULL, 0x2406d9dc56dffULL}};
+/* sqrt(-1) */
+static const fe25519 ge25519_sqrtm1 = {{0x61b274a0ea0b0ULL, 0x0d5a5fc8f189dULL, 0x7ef5e9cbd0c60ULL, 0x78595a6804c9eULL, 0x2b8324804fc1dULL}};
+
+/* Packed coordinates of the base point */
+static const ge25519 ge25519_base = {{{0x62d608f25d51aULL, 0x412a4b4f6592aULL, 0x75b7171a4b31dULL, 0x1ff60527118feULL, 0x216936d3cd6e5ULL}},
+															{{0x6666666666658ULL, 0x4ccccccccccccULL, 0x1999999999999ULL, 0x3333333333333ULL, 0x6666666666666ULL}},
+															{{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+															{{0x68ab3a5b7dda3ULL, 0x00eea2a5eadbbULL, 0x2af8df483c27eULL, 0x332b375274732ULL, 0x67875f0fd78b7ULL}}};
+
+/* Multiples of the base point in affine representation */
+static const ge25519_aff ge25519_base_multiples_affine[425] = {
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x62d608f25d51aULL, 0x412a4b4f6592aULL, 0x75b7171a4b31dULL, 0x1ff60527118feULL, 0x216936d3cd6e5ULL}} ,
+ {{0x6666666666658ULL, 0x4ccccccccccccULL, 0x1999999999999ULL, 0x3333333333333ULL, 0x6666666666666ULL}}},
+{{{0x5a14e2843ce0eULL, 0x0a2baf48bf078ULL, 0x0cf9eb0203639ULL, 0x2361e821dbe8cULL, 0x36ab384c9f5a0ULL}} ,
+ {{0x746ae6af8a3c9ULL, 0x22c870a2ac1cbULL, 0x6887d5a5ce43dULL, 0x4e10ed12f7464ULL, 0x2260cdf309232ULL}}},
+{{{0x2485fd3f8e25cULL, 0x3302c4910d58cULL, 0x36b20e98d0e60ULL, 0x7a48ffa573a1fULL, 0x67ae9c4a22928ULL}} ,
+ {{0x3684878f5b4d4ULL, 0x2ece480608058ULL, 0x09a7bde7c5bb0ULL, 0x4d5d09350c730ULL, 0x1267b1d177ee6ULL}}},
+{{{0x2a657c4c9f870ULL, 0x03279c2a8e927ULL, 0x0d483e469ce7bULL, 0x0a34192ea5c3dULL, 0x203da8db56cffULL}} ,
+ {{0x0ab61ca32112fULL, 0x65d45e1fe1be7ULL, 0x355c5b133c8a0ULL, 0x2f0a3875c42c0ULL, 0x47d0e827cb159ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x7fdbc08a584c8ULL, 0x7700d31732770ULL, 0x13b3e4faceb19ULL, 0x0db214316ae7cULL, 0x6742e15f97d77ULL}} ,
+ {{0x75ba9fc37b9b4ULL, 0x78c43dc9263c5ULL, 0x22bce3e05e0f3ULL, 0x1bcb756b784b3ULL, 0x21d30600c9e57ULL}}},
+{{{0x2596d6c28f9f8ULL, 0x67cf7e46e8b36ULL, 0x0927244255e34ULL, 0x5775c71158a84ULL, 0x23a4860627e53ULL}} ,
+ {{0x2ab37c16727ebULL, 0x7f1c0f384fb0fULL, 0x2b5b9e2c1a847ULL, 0x1b94fcc07971dULL, 0x709696f2827fcULL}}},
+{{{0x7c71ee8886b81ULL, 0x40a553421d2ceULL, 0x4b5e679843b63ULL, 0x003704b46ce4aULL, 0x70985f28875d4ULL}} ,
+ {{0x2444fed7b79f1ULL, 0x2411841a11cf6ULL, 0x0824f377e7f48ULL, 0x4c4b6e519e7c5ULL, 0x604e1b93c877bULL}}},
+{{{0x540f6977e4f26ULL, 0x21f2f0a5f89fbULL, 0x4e559f7980cc6ULL, 0x57cc2c12b0e85ULL, 0x39cf6c6917421ULL}} ,
+ {{0x5394f3a06d269ULL, 0x4e99188071f25ULL, 0x3e22de2d04817ULL, 0x735bd6f49f660ULL, 0x4434a90ee12ccULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x17a0fb03ca40bULL, 0x7ad5b3acf1e2aULL, 0x475e6a2e3a11bULL, 0x489ce79487cc3ULL, 0x05fa64200bf82ULL}} ,
+ {{0x695af17da0926ULL, 0x3cdc1a32d5f7aULL, 0x6a2a93267c449ULL, 0x014397a433cb7ULL, 0x3d199eeaf9260ULL}}},
+{{{0x2495bf0cfdd87ULL, 0x484c46f480bb4ULL, 0x34a2ede2a0deaULL, 0x7841201755f8dULL, 0x379dbeb1a97b5ULL}} ,
+ {{0x0e7ee084b86fcULL, 0x0268128a43fb4ULL, 0x1566ff08cc987ULL, 0x4e831fbcca9a4ULL, 0x28eb9fe001ce9ULL}}},
+{{{0x5f0175aabfc47ULL, 0x50410c6074ad0ULL, 0x1b8e9d112392cULL, 0x41fcfc7997881ULL, 0x6e5f16cae9350ULL}} ,
+ {{0x4345d651c591cULL, 0x7ae138279a134ULL, 0x02ebe2314aac5ULL, 0x3eb469a4fe3b0ULL, 0x778d6578ea7fbULL}}},
+{{{0x0bcdd0cc2a556ULL, 0x776ac2aeda417ULL, 0x241512752d5e3ULL, 0x65ff374e5e093ULL, 0x5e7e07ed4e1deULL}} ,
+ {{0x42031566cf6c7ULL, 0x35824fb3501c2ULL, 0x74c9839f46cf6ULL, 0x13cb5faf5d540ULL, 0x0f55755c51f10ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x1333c82cd340aULL, 0x366072c3a4a81ULL, 0x1c3509887bff6ULL, 0x2399998fcf77dULL, 0x2eecbf81b3d08ULL}} ,
+ {{0x4f764008b93e8ULL, 0x1093cdc0e9713ULL, 0x28466d9213535ULL, 0x13e20996cdba0ULL, 0x54d2dc2da1378ULL}}},
+{{{0x1c7d55b4a2b68ULL, 0x089655c23b22aULL, 0x32ecdeaf3c51fULL, 0x682c8563e5b64ULL, 0x6b113a52f9f3fULL}} ,
+ {{0x54359f327c13dULL, 0x69eaf32d8b212ULL, 0x5467018a59657ULL, 0x73c975c6d0c02ULL, 0x1aeb017159697ULL}}},
+{{{0x23c8ab6490615ULL, 0x55862840685fdULL, 0x196f4f8b2bf5aULL, 0x7f59da5a6f110ULL, 0x603ba4adc34a9ULL}} ,
+ {{0x22a95c0e658bcULL, 0x0da5e6f535025ULL, 0x11b1432f122f8ULL, 0x66c87d66a3570ULL, 0x1fdbaf2c3482cULL}}},
+{{{0x2bcfbbd1317f7ULL, 0x52622b668bd9aULL, 0x318a0f6120abfULL, 0x1c5daa0fa88feULL, 0x3c1ae7527612dULL}} ,
+ {{0x015a20711364eULL, 0x16c5865588a24ULL, 0x517e43e99fd7aULL, 0x2bf5bc308b642ULL, 0x051c91c3f9d7eULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x1003a29ded6eaULL, 0x75884d96b2057ULL, 0x00238be5ec666ULL, 0x5a3f5a9279349ULL, 0x7d13c0248b891ULL}} ,
+ {{0x080a6805b20d5ULL, 0x0f1d3fd3872a4ULL, 0x7331dea787a7aULL, 0x40d48f8d2b63aULL, 0x59a976ab2c01aULL}}},
+{{{0x2161031b1c9deULL, 0x696ba8d4286b5ULL, 0x669752b49c608ULL, 0x6c7729e13298fULL, 0x17d5a9ff7f338ULL}} ,
+ {{0x0d564a4f6af89ULL, 0x7a89df5a3bc02ULL, 0x3c2a1eab20f6aULL, 0x7b621e1fc838eULL, 0x73022287d3b73ULL}}},
+{{{0x4712f13491d64ULL, 0x27dc85a10ed3dULL, 0x6fded5bb78fb0ULL, 0x44ebdbe97c65eULL, 0x086f2f768eec2ULL}} ,
+ {{0x4ef154d5ff522ULL, 0x61126c06ae9dfULL, 0x72b8b5a456fafULL, 0x6507629775280ULL, 0x72945a90338f3ULL}}},
+{{{0x2dabc38e74b8aULL, 0x5bfc95c30b618ULL, 0x4b5ac832e1110ULL, 0x769df6bce08dfULL, 0x07a8bc68bf5f3ULL}} ,
+ {{0x2786a22288901ULL, 0x072ae99006535ULL, 0x2a04c1ef770f8ULL, 0x1380c59969051ULL, 0x7249d7c47afd4ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x4935c2b32ff02ULL, 0x1634a8afd064aULL, 0x6919f4d9580ceULL, 0x58f9a52621360ULL, 0x5b4fd9f4a9a79ULL}} ,
+ {{0x3265433b08d46ULL, 0x05d98b77bed0bULL, 0x63b04dd68f3e7ULL, 0x5fc2d24d52393ULL, 0x40ebd1230468fULL}}},
+{{{0x5678a8411a565ULL, 0x68f4d089a33d3ULL, 0x01f35528e7f84ULL, 0x00997aa0fbce5ULL, 0x5de7faa2ee4e7ULL}} ,
+ {{0x5e4cef854ec36ULL, 0x11203adfedbf0ULL, 0x50cb64b03a2f0ULL, 0x70555c754c935ULL, 0x2c9f23641e1c2ULL}}},
+{{{0x3d4ccd52ed6a7ULL, 0x068df34e76b59ULL, 0x240c4d0aeb474ULL, 0x0620a41042300ULL, 0x314355e3f09ceULL}} ,
+ {{0x2d4e678ddd660ULL, 0x5563f2003e844ULL, 0x46b45664b898dULL, 0x360e494aa005bULL, 0x655f3cc57a6ffULL}}},
+{{{0x411b172d04f27ULL, 0x7d0291282a4e2ULL, 0x0474754cb61d1ULL, 0x29b991b31b014ULL, 0x74e337a01c13bULL}} ,
+ {{0x66796114e25f1ULL, 0x35c4a7658439cULL, 0x3cd667ecbba17ULL, 0x57cb767fd5eddULL, 0x08648f02b3a4dULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x7475464f29434ULL, 0x15744114800e6ULL, 0x496e91cff5d55ULL, 0x42af416580a11ULL, 0x6a6fbd51efa6aULL}} ,
+ {{0x206b27616d671ULL, 0x7ca58789eaf3dULL, 0x5e1c2b7874585ULL, 0x615be7c088b0eULL, 0x16f5f8529f55fULL}}},
+{{{0x4e0c5f69a9634ULL, 0x3d5a981c48062ULL, 0x3c6ca588dc26aULL, 0x2aa4d9961ce97ULL, 0x243eb188de73aULL}} ,
+ {{0x7b25b1f4ce2f6ULL, 0x0821039f4b055ULL, 0x2c893328b6fbcULL, 0x16c00f5bd05bfULL, 0x3779298951f45ULL}}},
+{{{0x6b768f312de74ULL, 0x6b03b8d1dd86cULL, 0x58ca366ae6556ULL, 0x6b63ab4a045b6ULL, 0x297b327e2a5ccULL}} ,
+ {{0x7194d7422cc02ULL, 0x54a2ed6bb5800ULL, 0x350997c2a9aa8ULL, 0x6013fc42457deULL, 0x15dde9cfe1f2bULL}}},
+{{{0x7dd9a8c9ab5edULL, 0x4ea5b28effe84ULL, 0x3b488c6959736ULL, 0x6d6a5402db1d3ULL, 0x06b349eebfed4ULL}} ,
+ {{0x6e990608b64f8ULL, 0x646c0f72ee89bULL, 0x1237d97d54308ULL, 0x7cd55b4551ba6ULL, 0x07a09289ff3e1ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x14ac0199c4f7dULL, 0x2d65d755f3d86ULL, 0x753457d9a8e70ULL, 0x56d558e495c76ULL, 0x482a4cdf57d9eULL}} ,
+ {{0x13b116e4eb04bULL, 0x4a4bc9fad57aaULL, 0x1464a60fc457eULL, 0x3d4059e2fe30aULL, 0x7391de4381c2fULL}}},
+{{{0x31f2a339f8f3cULL, 0x7a3ffed11e668ULL, 0x5f731a2fdadccULL, 0x226e625923609ULL, 0x3bad86defe0d2ULL}} ,
+ {{0x373dc01815179ULL, 0x7ed1d536ddc0aULL, 0x12e354e105170ULL, 0x54615c4cfcfe0ULL, 0x2de3cdf2fa86bULL}}},
+{{{0x43ddb5a29f906ULL, 0x3ac0d79956a50ULL, 0x6458cd8392adeULL, 0x744cbd84ad056ULL, 0x287ce53c7dcf4ULL}} ,
+ {{0x4bdc6fd98692eULL, 0x3afc8935bf959ULL, 0x3089efdb6272aULL, 0x45a95802366fcULL, 0x2de90989b74e5ULL}}},
+{{{0x4b005cb75be54ULL, 0x78950c4dcf6eaULL, 0x08b51189f3c67ULL, 0x68deaf408ad4bULL, 0x45afc85dc571eULL}} ,
+ {{0x09e4957777b40ULL, 0x441703dc46730ULL, 0x6e050bdeb6f3cULL, 0x63b8f1cd0c7abULL, 0x6c0c8abfa60bfULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x0cf27d8d43a77ULL, 0x1bbb953ae543dULL, 0x5095bb5e76a58ULL, 0x013358e63b00aULL, 0x0af367956af63ULL}} ,
+ {{0x1bd2f2ba408c5ULL, 0x01c96d4c55026ULL, 0x25ac2c8f76a44ULL, 0x1d9b846e94567ULL, 0x21108d900134dULL}}},
+{{{0x7074fbae70d33ULL, 0x2d8b40fbd51bbULL, 0x56c6d5f96c2c7ULL, 0x5ad320a09a2faULL, 0x2b760154fc5ceULL}} ,
+ {{0x63696afc20c02ULL, 0x56d440a9c495fULL, 0x68b3b5d8a7ecbULL, 0x1701b9a08901fULL, 0x7dc81af96fed4ULL}}},
+{{{0x23f36e811b9d8ULL, 0x11e3a7b995828ULL, 0x675ed453cf48fULL, 0x279d550726c46ULL, 0x4535c89311d60ULL}} ,
+ {{0x7bf9008d63661ULL, 0x2b081ed92ef54ULL, 0x201ab24dcb4cfULL, 0x470d551051ec8ULL, 0x69dd3661ba84bULL}}},
+{{{0x492c69c5bdb6bULL, 0x70eb718b5e477ULL, 0x65212db5be90bULL, 0x69c3c2449cc31ULL, 0x67dbc33418bbcULL}} ,
+ {{0x7b056093af396ULL, 0x1072363ca2f8dULL, 0x1ea88943327a9ULL, 0x1982cfe4973e5ULL, 0x38436fdf8589aULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x4e9bd19448479ULL, 0x515054dd8188aULL, 0x17c89c7550e6eULL, 0x3dc59effd00eeULL, 0x29ea44a50a4b4ULL}} ,
+ {{0x55f63af509005ULL, 0x3f2e713bc33d3ULL, 0x5aac918c2b1b0ULL, 0x5465deda5e88cULL, 0x6c775ac8ab2edULL}}},
+{{{0x32f6da1afbe2bULL, 0x1a71c1c71f621ULL, 0x41c55286d042fULL, 0x16f74dc6e37f9ULL, 0x1e45a60140a3bULL}} ,
+ {{0x7072c8dda0a76ULL, 0x20875a08fb127ULL, 0x79a2b2d1f49b9ULL, 0x6b06979920d42ULL, 0x0e730da473dffULL}}},
+{{{0x3819b716b67fdULL, 0x07ab71e87272aULL, 0x3c28df0ee6cc3ULL, 0x65bdfeb10c268ULL, 0x55a72d4513874ULL}} ,
+ {{0x5952840b3045dULL, 0x7fc8bdd906605ULL, 0x0767499e7f9d7ULL, 0x212690a85669bULL, 0x041b8ad771771ULL}}},
+{{{0x590aabec9935dULL, 0x4960fce7f7379ULL, 0x6c50509115e61ULL, 0x07f9161e0f557ULL, 0x61708161cb466ULL}} ,
+ {{0x4cd21feb9820dULL, 0x5ce49c1931eb8ULL, 0x77e5687e1261fULL, 0x2be0310de96c7ULL, 0x38d6936d12e81ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x27defd951f791ULL, 0x4cff71d226028ULL, 0x20e0085905d26ULL, 0x0ac84b0263196ULL, 0x48f4513977929ULL}} ,
+ {{0x72f088322d560ULL, 0x3510dad27d33fULL, 0x4a8c499496f9fULL, 0x15b48346f44f2ULL, 0x315385d3bd5a2ULL}}},
+{{{0x24b3cf9dcced8ULL, 0x757c6c5e583b4ULL, 0x4c3e772f337f1ULL, 0x3c7726382ffdeULL, 0x7956a04df8621ULL}} ,
+ {{0x28453baf6e782ULL, 0x554679fe69461ULL, 0x656db77a8de85ULL, 0x7aa8f3b0cbc59ULL, 0x5eeac17f2e772ULL}}},
+{{{0x63307a96ee183ULL, 0x633e3997ff067ULL, 0x65c1f8726d28eULL, 0x6a0674791fc7fULL, 0x2d4316db5e2efULL}} ,
+ {{0x34381f70238baULL, 0x1476029e41470ULL, 0x7203f18c4e012ULL, 0x61fc417fd6befULL, 0x7245a6c4760cfULL}}},
+{{{0x797a46abc0cbbULL, 0x20e5bcde5b262ULL, 0x0ca003cb02070ULL, 0x462eed5ea13b4ULL, 0x4d1e116d13615ULL}} ,
+ {{0x61efb10c9b91aULL, 0x76bd149709e89ULL, 0x4023e310fa12dULL, 0x2db2e6289aa5aULL, 0x6d415be49d4e3ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2148248127d15ULL, 0x658297a8659a8ULL, 0x3e38bb230a985ULL, 0x3eedf71ca2292ULL, 0x4b5bae5a77a86ULL}} ,
+ {{0x3b8de209a77cbULL, 0x4af7181f41b24ULL, 0x19d0bb2dabb2eULL, 0x090cc3ad22c07ULL, 0x739476e0b3847ULL}}},
+{{{0x33f232869fcdfULL, 0x3be66e4877f0bULL, 0x2a26341ac8b54ULL, 0x789f0837fe7b6ULL, 0x33bfa90cc1b9dULL}} ,
+ {{0x5824fb2da81d9ULL, 0x03a5e21302873ULL, 0x405f4b7d2b3bcULL, 0x572cfd2fff884ULL, 0x53b120db6327cULL}}},
+{{{0x434a9ade80267ULL, 0x1b8f55022be1aULL, 0x1339dd7aa521dULL, 0x0f3c3b487024aULL, 0x56bec70310915ULL}} ,
+ {{0x66b33ec86fb32ULL, 0x60d9f59056a25ULL, 0x5c4301739f91dULL, 0x4666e532b5a79ULL, 0x6ab2ddd075077ULL}}},
+{{{0x0222bc0b9efc6ULL, 0x386b66e0e23c1ULL, 0x3da69124805eaULL, 0x6814de0caac58ULL, 0x444929347c2deULL}} ,
+ {{0x42aff2e1d6245ULL, 0x181af64b48423ULL, 0x695f23ff0e456ULL, 0x5eb22d1928f3eULL, 0x77785ec5cbbdaULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x4001ded42d3d0ULL, 0x2502ef38582a7ULL, 0x1ff13541b45cfULL, 0x2a59616c95dcaULL, 0x2b6b892ae94b4ULL}} ,
+ {{0x24d48c5880cd2ULL, 0x42d4a592941bdULL, 0x14a17cddba5e5ULL, 0x7e26b70960daeULL, 0x7f1cf64e0e180ULL}}},
+{{{0x31fcb422e04b4ULL, 0x555810f6a2225ULL, 0x70add814a78faULL, 0x30c6ac2462bb0ULL, 0x1b9175b7fc19aULL}} ,
+ {{0x038c844ca68e8ULL, 0x186a6414a7987ULL, 0x39f17dc3b2d4bULL, 0x3f12c66429ef6ULL, 0x1730a59fff471ULL}}},
+{{{0x17571c1c8aee3ULL, 0x721cb8826e006ULL, 0x0da5f1e81cf68ULL, 0x6853277792db6ULL, 0x378c491d1e893ULL}} ,
+ {{0x22aa5c1b0e64cULL, 0x2d38f35a10130ULL, 0x4e5f35f07e7d9ULL, 0x3dfaa88e549bfULL, 0x5c956929821b0ULL}}},
+{{{0x2c29e56a6ee87ULL, 0x309b0a8448ad3ULL, 0x2161d358078c6ULL, 0x7c77c89235702ULL, 0x01371cf67fe47ULL}} ,
+ {{0x4e9c4c5b64c73ULL, 0x3358b494910adULL, 0x3b96d8be10c7fULL, 0x0e73cc719954cULL, 0x71cad7d835066ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x58fcaa6aed372ULL, 0x4e9a331cf1999ULL, 0x458f293a49f4aULL, 0x566687cc0422dULL, 0x63bd671eca1e6ULL}} ,
+ {{0x74887d22a6e7bULL, 0x390a2bd39543fULL, 0x2a64448e4b36fULL, 0x50afa14a7d510ULL, 0x0460cc32f5d27ULL}}},
+{{{0x490fa3b4710e5ULL, 0x1eacdfd56a61fULL, 0x6cb20ee9c3beeULL, 0x549ca19bd017fULL, 0x0f6c3a96e0032ULL}} ,
+ {{0x0479be167635aULL, 0x4d2f58f2713efULL, 0x10893b9457875ULL, 0x33a81c525ac74ULL, 0x3d4e97e286378ULL}}},
+{{{0x5d8ffb48e753fULL, 0x76db3aae6fadbULL, 0x66996218356f4ULL, 0x6b3d14234255cULL, 0x5e8b04972517dULL}} ,
+ {{0x59216bc5e40bbULL, 0x1d20e49d81880ULL, 0x6e7bfb62b3eacULL, 0x6dd2da1fc1d96ULL, 0x5ad1d2522feb2ULL}}},
+{{{0x69fade6abb440ULL, 0x55551d6694d28ULL, 0x6317458822a73ULL, 0x692628efb5e89ULL, 0x3b13c71c2a90bULL}} ,
+ {{0x5be180d16dc54ULL, 0x5f0004a4c2c86ULL, 0x23f4d0a9bdc16ULL, 0x3d95dd4133c97ULL, 0x14890a7ab2481ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x6c091e388a820ULL, 0x06a3044f1576dULL, 0x69bae0ea4a2caULL, 0x02a112c8ba6d4ULL, 0x184b48cb45500ULL}} ,
+ {{0x24dba26e77c33ULL, 0x4707f5e8a7fc6ULL, 0x603bdcd99e697ULL, 0x1d4eeb0613411ULL, 0x3ee0e07a03dc3ULL}}},
+{{{0x0e3c0fb135c34ULL, 0x6d3644b0a856fULL, 0x0f096724dfe05ULL, 0x2841310cb74e9ULL, 0x5a04ae1195edfULL}} ,
+ {{0x31f9712c5e8b9ULL, 0x5ba933287dfd0ULL, 0x29a0971654be4ULL, 0x66676743f3af8ULL, 0x676667092118aULL}}},
+{{{0x01bcbd12940b3ULL, 0x7772a76f393c1ULL, 0x560684a5421c4ULL, 0x0a7a1a9413f57ULL, 0x05261a93f4391ULL}} ,
+ {{0x7af64f9a3446eULL, 0x09583dbefadbcULL, 0x493a26d7cefa8ULL, 0x4ef9f1772874eULL, 0x78f07150d4f7aULL}}},
+{{{0x25657c238a83eULL, 0x548bf1c563348ULL, 0x553105d7d2046ULL, 0x620eed52eee13ULL, 0x52ee53b981dfbULL}} ,
+ {{0x25fb36da7f1c3ULL, 0x0b2b712398df2ULL, 0x584e55d90f37cULL, 0x7643d9c4656a8ULL, 0x7eb0a1be3400dULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x620678a1d2425ULL, 0x1617da71d685dULL, 0x079ad7a751b36ULL, 0x2e60d02894e92ULL, 0x501fe138924e0ULL}} ,
+ {{0x511e6911cee4eULL, 0x4cea3034ab1d7ULL, 0x5b6b83ded36bdULL, 0x44e10ac416542ULL, 0x2f8022ecede01ULL}}},
+{{{0x56a1d390a3b68ULL, 0x36a8c7e1f8ae2ULL, 0x3fd9173a36ce7ULL, 0x0195b9da784d0ULL, 0x2d8294fd94996ULL}} ,
+ {{0x455f1445af624ULL, 0x02f908f9d5b65ULL, 0x3049f27f78eb0ULL, 0x6c82d27ef5cadULL, 0x3a8a6faa67c6dULL}}},
+{{{0x16397c9875278ULL, 0x63f182bea9bb6ULL, 0x20a228ea2981bULL, 0x0e8ee8cd365eaULL, 0x2a374c1708871ULL}} ,
+ {{0x4d94308f30ca1ULL, 0x1523bf4f063c4ULL, 0x7886e351da6f7ULL, 0x659bb70daa75cULL, 0x5ab35fce03931ULL}}},
+{{{0x1500361e4da1dULL, 0x3965de30d1175ULL, 0x28e551288ee10ULL, 0x357804ceb1d82ULL, 0x56857d0267427ULL}} ,
+ {{0x5b284290e72ceULL, 0x5a0caf7c8ba4fULL, 0x067bf37b73dffULL, 0x469323c8ade6bULL, 0x0b543a6720e31ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x799fbc504fd52ULL, 0x0685c319f7d1cULL, 0x3dd367b6677bcULL, 0x4a2cde61767c0ULL, 0x52a837bc7a7bcULL}} ,
+ {{0x691478a411196ULL, 0x22c6a8f5b56dfULL, 0x2a6321814d453ULL, 0x1272a42f91f9bULL, 0x50d6460185d89ULL}}},
+{{{0x1e64086f3cd53ULL, 0x348b97ad2a847ULL, 0x1a4c92d172080ULL, 0x5e3a31057d882ULL, 0x3f30ee695b236ULL}} ,
+ {{0x055dbc0478370ULL, 0x09eada30f7501ULL, 0x1823128308168ULL, 0x72aaab207d757ULL, 0x414231531dd52ULL}}},
+{{{0x278966b88fccaULL, 0x015f79b907161ULL, 0x746d3bdfe36d9ULL, 0x16164ba51661fULL, 0x4fbfdbab00559ULL}} ,
+ {{0x265662d061c93ULL, 0x4e01fa312f480ULL, 0x6ff073bb00eafULL, 0x672d2a989fc1bULL, 0x68ffb955a83a0ULL}}},
+{{{0x5307d306de6e4ULL, 0x57f9f30ef1846ULL, 0x4bb6196df0d69ULL, 0x5096e630652e3ULL, 0x0ebc38c54fd6aULL}} ,
+ {{0x3f23886763ce2ULL, 0x49eb1af02c58fULL, 0x282149b6f6856ULL, 0x07ed9f18eeeabULL, 0x04b3a1d9f2ef4ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x21058e60e49dbULL, 0x546efb6bb4a4fULL, 0x0731f39e284f9ULL, 0x6c67dbeed9192ULL, 0x3b75696730dc8ULL}} ,
+ {{0x46016166deaa9ULL, 0x151888330ec1eULL, 0x000005becfa2dULL, 0x4e7f7cfcf532aULL, 0x34d031744cd2dULL}}},
+{{{0x18f8ca404eba4ULL, 0x16aabb0b2a4eeULL, 0x5aabb20989ac5ULL, 0x59c676510d13eULL, 0x006b2bd5d00faULL}} ,
+ {{0x29a3af10c67e5ULL, 0x7861a3de7213dULL, 0x09f15aac6e8ceULL, 0x3559ec02a3f84ULL, 0x727340c27a15fULL}}},
+{{{0x77012b6825684ULL, 0x2b52b77be1eefULL, 0x6cdfefd657f17ULL, 0x3aaa26481112aULL, 0x156d6498968f8ULL}} ,
+ {{0x5c7ec1eaa8bb0ULL, 0x0b8c09243f1f4ULL, 0x6047f32877fd8ULL, 0x5f1ee2bce077aULL, 0x6c23fe1e8706bULL}}},
+{{{0x120ea165b2bd8ULL, 0x20b75d1ed1a7eULL, 0x7ecdaa0646aa7ULL, 0x36ac83ec42b95ULL, 0x1f4e8938dcf3aULL}} ,
+ {{0x0433b9bda19ccULL, 0x5c7a9a465c429ULL, 0x5d29b77f233e2ULL, 0x70c8d7765329bULL, 0x5a8b0c6f649f8ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x5b872f0c2b925ULL, 0x4ade791b982c2ULL, 0x58030b91bd3b4ULL, 0x4c4aa9a427107ULL, 0x08fe8df51b345ULL}} ,
+ {{0x3ba44bc93abf8ULL, 0x29a0de9296ea3ULL, 0x3b7aad6e98cb9ULL, 0x762ec4a648a19ULL, 0x2738e06810f4cULL}}},
+{{{0x164d49b141c74ULL, 0x1e66436cb4e2cULL, 0x6692296ea3bddULL, 0x6b15a784d7d63ULL, 0x1a2403cc5ef2aULL}} ,
+ {{0x3b9afe4fd76f5ULL, 0x3e77a4c79cb20ULL, 0x69512b4308734ULL, 0x64d8108c0564bULL, 0x7779fbcd8be50ULL}}},
+{{{0x238ba0d9abe15ULL, 0x26b37deb1440eULL, 0x4e031abdadde6ULL, 0x59dc37a300d13ULL, 0x7d21cea0005aaULL}} ,
+ {{0x612eac514ba6cULL, 0x15379cc7045d3ULL, 0x144bbc7b0779dULL, 0x6a10ab4e87a0eULL, 0x5ce9bf0e3fa39ULL}}},
+{{{0x031eebdf40de4ULL, 0x295b0c2597da2ULL, 0x42f0cc8de40bfULL, 0x600d242cbf639ULL, 0x71dd75fe35761ULL}} ,
+ {{0x1533e9f88a411ULL, 0x3775efc03676dULL, 0x172d57e053ab6ULL, 0x71a1bc333df57ULL, 0x39674a4532078ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x71e0320587090ULL, 0x638ab1379164cULL, 0x2320b7928b7aeULL, 0x730b85c0a6979ULL, 0x300d6b0bd6734ULL}} ,
+ {{0x4a7bf5c55fc81ULL, 0x531e97e1c57b8ULL, 0x6f2af4fea65f7ULL, 0x4863f8215c1e3ULL, 0x40ca073d03431ULL}}},
+{{{0x181168cbec8f9ULL, 0x6190b02fed2c7ULL, 0x349140f0bed60ULL, 0x6141335703b29ULL, 0x42545a6a59885ULL}} ,
+ {{0x315672c2eb507ULL, 0x341e3cd307f73ULL, 0x2cb8182c4a75bULL, 0x05edecf5134ddULL, 0x706406cdbd1ceULL}}},
+{{{0x78f89e18cfa41ULL, 0x2abedf1e4b904ULL, 0x1d4bdb6577be1ULL, 0x7437ea227158bULL, 0x7e97763970e96ULL}} ,
+ {{0x07ca1146b6217ULL, 0x5b4b15b0dcf3aULL, 0x513b0ff4a4e31ULL, 0x747c600c8b746ULL, 0x0e85b4c08f01eULL}}},
+{{{0x711e441703a02ULL, 0x7ca9f9cd5846aULL, 0x27ddb2c8b5f35ULL, 0x5a8bb39d06710ULL, 0x6c1262e3f8a43ULL}} ,
+ {{0x06f0d269c007fULL, 0x2d8bda0274fe9ULL, 0x5880aa13c7ec2ULL, 0x145cd46a84513ULL, 0x193841cf1e0f5ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x7690f2fd46cf5ULL, 0x6a3ccac27f0e1ULL, 0x6b0c00aea14d0ULL, 0x4e678b1711e92ULL, 0x57426aefc21beULL}} ,
+ {{0x4c7d1ac2e1f34ULL, 0x666764cc64a40ULL, 0x3b5c7dd50d085ULL, 0x537acd37fd803ULL, 0x6b45b002fb4e8ULL}}},
+{{{0x522c5030b48f5ULL, 0x6265fca61100fULL, 0x4fef5bdd22a86ULL, 0x0d7b07ae7fa42ULL, 0x205aa3463e7e4ULL}} ,
+ {{0x76663448735aaULL, 0x7c0818aaddf12ULL, 0x749a64efd40d4ULL, 0x1f15f4caa82c5ULL, 0x320b08e8ec615ULL}}},
+{{{0x65969024510b3ULL, 0x4bb7f0c9b32e5ULL, 0x4f18b57137200ULL, 0x0abe8d6c8b2f6ULL, 0x68fc29a1aa948ULL}} ,
+ {{0x1215aab7db5ddULL, 0x221af22f76a68ULL, 0x42620803032a3ULL, 0x5338892f44274ULL, 0x5de15de41a8b7ULL}}},
+{{{0x0253b65feea37ULL, 0x7d48058b85c3dULL, 0x26f0584ac2a62ULL, 0x7becf73496af1ULL, 0x592c8b8843ca1ULL}} ,
+ {{0x76f2a1d00b5e0ULL, 0x26b54c5f0cf35ULL, 0x36fb8eabbfb46ULL, 0x77c80be5f30beULL, 0x42a352d8dc52fULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x137bd3713af22ULL, 0x4958c68c0958eULL, 0x05780e097b5deULL, 0x0a8e706803254ULL, 0x041c030fbca90ULL}} ,
+ {{0x33fcf0780f989ULL, 0x547a888bcfd36ULL, 0x579705b93a5f0ULL, 0x5bd633ee38e32ULL, 0x72467625ee43fULL}}},
+{{{0x36b8ff4eda202ULL, 0x7daa346bd67c1ULL, 0x2822a5801e36dULL, 0x4eaea25b067daULL, 0x6222bd88bf2dfULL}} ,
+ {{0x6fa5782e45313ULL, 0x117520560d1e3ULL, 0x06df13d5042d8ULL, 0x012eeb5ed7693ULL, 0x0325bb42ea4edULL}}},
+{{{0x65dd57c501651ULL, 0x749ce4efd133eULL, 0x78831d5db2d8bULL, 0x7a2fd6ac94c38ULL, 0x69289e1e6f5cdULL}} ,
+ {{0x28bc36d66ac0dULL, 0x181b41c56a2d7ULL, 0x3c9b0623a92f4ULL, 0x292c3256e7ceeULL, 0x0f041ad8cb149ULL}}},
+{{{0x2aa2d8bdba597ULL, 0x337727e412228ULL, 0x682a0453a101bULL, 0x262572fd31592ULL, 0x023bc7abc84cbULL}} ,
+ {{0x511df0f29c9eeULL, 0x1e58c41b9ddb0ULL, 0x5c81ba413e52eULL, 0x58a64a8101b8eULL, 0x4d2b97a739eceULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x633fbbd39d169ULL, 0x2de1deb9e1897ULL, 0x1cb211e5ff1a1ULL, 0x252cc055229dbULL, 0x6d5066cf7137bULL}} ,
+ {{0x347115219a417ULL, 0x68445d52b6b96ULL, 0x2e0615fe54802ULL, 0x3e441d5f1ad5fULL, 0x54bb8cd82a0a8ULL}}},
+{{{0x3e8be859362a9ULL, 0x285b6b601c94eULL, 0x277aacb4ea942ULL, 0x6a71a039dbb31ULL, 0x6b66159ac8702ULL}} ,
+ {{0x61a22c8ca96c5ULL, 0x0644c063cebfdULL, 0x110cae7398c22ULL, 0x282724d9d2eacULL, 0x19dd4bef38efdULL}}},
+{{{0x568a17517c24dULL, 0x71c688078d879ULL, 0x3903cfd1e4425ULL, 0x2100fbefd2c49ULL, 0x6f0219bc5e589ULL}} ,
+ {{0x3a75491d8d620ULL, 0x61f40c689641eULL, 0x5d1944051bf20ULL, 0x7e71334f82709ULL, 0x64c8c5d0f490cULL}}},
+{{{0x172240250a226ULL, 0x11ab265a9de1eULL, 0x29463dce2bb9cULL, 0x4f65378611a19ULL, 0x71ac99647b61bULL}} ,
+ {{0x1aa1b5574cf25ULL, 0x2b2baa8082715ULL, 0x1f906f17872aeULL, 0x2fa4489df180aULL, 0x3a96c2c028ebeULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x27667ec45772bULL, 0x56644bbf72986ULL, 0x3b90d84539f2dULL, 0x2a46977b8cdddULL, 0x221b138a1bbb6ULL}} ,
+ {{0x25a38180cad84ULL, 0x606f7eb331a17ULL, 0x66ecc81825d3eULL, 0x5ffd236047b4bULL, 0x7951b295fab7fULL}}},
+{{{0x3186bdb3f5c28ULL, 0x0bbc5009a2b87ULL, 0x6a7daeed4c54aULL, 0x2bf59a7945f76ULL, 0x1c1b0d95db6a0ULL}} ,
+ {{0x1d00a9ac3c5d5ULL, 0x15811c6c0e7c6ULL, 0x4783b5b2ac58aULL, 0x65da6cc55f7ceULL, 0x57bd5de4e0056ULL}}},
+{{{0x4a9fdce2721ccULL, 0x0dc09357c31d2ULL, 0x6668632a28499ULL, 0x4e416b693da0eULL, 0x6ec452375e303ULL}} ,
+ {{0x315b0e7f485a9ULL, 0x3204342837086ULL, 0x3a9b10c3eb4efULL, 0x635eeed3f079fULL, 0x0fbf6bd46e7f4ULL}}},
+{{{0x1437c567c9f47ULL, 0x487ce49d76392ULL, 0x762d37e8282adULL, 0x464a4545e9d43ULL, 0x4f846fad2eefbULL}} ,
+ {{0x42a7e1bf02d2dULL, 0x33e1c2d553f0dULL, 0x3284f52699e86ULL, 0x6d0d54913dd65ULL, 0x0a2640ccde505ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x3ce90b2f23e9fULL, 0x6c6fba067cc9bULL, 0x5a6d491d9c150ULL, 0x2d93a15d07e01ULL, 0x1f6a1fd8cc0e0ULL}} ,
+ {{0x0865869605e19ULL, 0x3859d2657a634ULL, 0x2a19102ea1749ULL, 0x4d4d98e077c3aULL, 0x779964401ee86ULL}}},
+{{{0x35cbbfd4f326cULL, 0x3ee294ccc91b7ULL, 0x353e636b68de4ULL, 0x502fd3833e7f6ULL, 0x6f0a87af6e0f4ULL}} ,
+ {{0x1248c6c6e36c6ULL, 0x3c99a44d7cc01ULL, 0x21f30757f285dULL, 0x13ee5e5b52174ULL, 0x6b60138135059ULL}}},
+{{{0x6af0a0fcd15f4ULL, 0x5d8829faa2d69ULL, 0x59b2d11d2184cULL, 0x6192b3a4edb35ULL, 0x398c8c8c8e8daULL}} ,
+ {{0x5ef111a7459caULL, 0x743e76b873eedULL, 0x7da788d05038fULL, 0x132d6dfd110e8ULL, 0x7fc5e88a596b4ULL}}},
+{{{0x3134a847a0564ULL, 0x26d734dd61ed8ULL, 0x1d5d36768c9adULL, 0x6841d9eb25d62ULL, 0x1f90c7ef4610dULL}} ,
+ {{0x1a1c8ce3a2f7bULL, 0x6c5088246078fULL, 0x25f03d3f7fef3ULL, 0x55cbd09e1e658ULL, 0x63344ccbe4169ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x633092dd34e07ULL, 0x49ce7d7c1ba41ULL, 0x2b7a22c02deabULL, 0x0d4941a46bd55ULL, 0x47ac42e7c5948ULL}} ,
+ {{0x09bb58f7a8924ULL, 0x6a3da0c80785eULL, 0x06ba5d3ceca93ULL, 0x075f50ae5fe8bULL, 0x28a6c1d1356c1ULL}}},
+{{{0x5a4a5fc39d5ccULL, 0x69d0339c2a655ULL, 0x417f2458070acULL, 0x06214c06e59d4ULL, 0x22e2c03906792ULL}} ,
+ {{0x0577089e1a8bbULL, 0x25041bec78a83ULL, 0x38ce41a5a1c14ULL, 0x7936bf2cad9fcULL, 0x631cf9945a09bULL}}},
+{{{0x2848b9a2d8c2bULL, 0x6efe5d5bf6adeULL, 0x6ea24d784c3f2ULL, 0x045c66736d426ULL, 0x17111829dae03ULL}} ,
+ {{0x5c393655aa619ULL, 0x1fede69e44636ULL, 0x33badf30ca3acULL, 0x29ab73b33f643ULL, 0x6501926bd87b4ULL}}},
+{{{0x13673649ad53dULL, 0x147e85310dad6ULL, 0x272a10bd71fc6ULL, 0x51f927cee5429ULL, 0x1a62e85ba4a14ULL}} ,
+ {{0x30dd514c8bdc5ULL, 0x122307cd4bc3dULL, 0x5f9460d547400ULL, 0x2ec65dcc0803aULL, 0x1f6d17d9a1e5cULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x752e1e9e4f9eaULL, 0x3bb3ba1a32a27ULL, 0x754248e1cc64eULL, 0x1b73b04c975c1ULL, 0x36b566a2c0f8eULL}} ,
+ {{0x70232ed39bb3aULL, 0x47082870f487cULL, 0x5e376517b4913ULL, 0x270cf39a62ac4ULL, 0x1bde4ad0433eeULL}}},
+{{{0x3c5a3e38fe7b2ULL, 0x3ff082f3dce59ULL, 0x09ddd171597bbULL, 0x2713ae9ac5e9eULL, 0x0fc8f365bb4b0ULL}} ,
+ {{0x4e2b534937b24ULL, 0x2f2417419a90eULL, 0x5778ac3d0e59aULL, 0x73c0ba2adb51cULL, 0x16f91c8191db1ULL}}},
+{{{0x6e9d55ad1df16ULL, 0x12a2bf272ab09ULL, 0x521575324ab0cULL, 0x53161d951d23cULL, 0x1b3947ade88caULL}} ,
+ {{0x1e63a519eda46ULL, 0x7c10f69b774daULL, 0x3dff4ffcf5632ULL, 0x3e825a996c022ULL, 0x07f7d8b5c1688ULL}}},
+{{{0x1d2b7be4610f4ULL, 0x07af44ecbd9daULL, 0x0f3d96a079370ULL, 0x29a10cebd576fULL, 0x608de273a9f6aULL}} ,
+ {{0x6d841f67144faULL, 0x1f09d66e26b18ULL, 0x5eaa723731e58ULL, 0x40d589897d941ULL, 0x3b31d0113f98dULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x3a3011634d581ULL, 0x6f27d928a5d52ULL, 0x2d7e560b44606ULL, 0x31f977b27d505ULL, 0x08d1e75a33bf3ULL}} ,
+ {{0x7b5ccae42cf1aULL, 0x4da0b6b78872eULL, 0x449c557409d64ULL, 0x520f54e1ec44eULL, 0x47dd939350f06ULL}}},
+{{{0x5aa1c6d51c96fULL, 0x5dc4287f214beULL, 0x13b82b3f59239ULL, 0x50514de60f291ULL, 0x0b2fcb60a19e6ULL}} ,
+ {{0x144a1f33239dcULL, 0x0f2bf6f1878bdULL, 0x77897a0d0d4d1ULL, 0x1c336bb5a6349ULL, 0x6301b568e9c61ULL}}},
+{{{0x4d99764529a1fULL, 0x553a4cdea2103ULL, 0x3a5dfe90cce4eULL, 0x475ba8c2ecdb1ULL, 0x4db4418f87f77ULL}} ,
+ {{0x513e93e82a813ULL, 0x1bb59f9403d75ULL, 0x07b71eb1db3dfULL, 0x540312aa76437ULL, 0x5140b9860c78eULL}}},
+{{{0x48f4c0dd3ae27ULL, 0x1f15ca78fbd46ULL, 0x6d058c362496fULL, 0x66413f5ffbad1ULL, 0x0b216ceec26c5ULL}} ,
+ {{0x7aa2a5312bac3ULL, 0x5d14aaf0335aeULL, 0x4e245bb0a1d80ULL, 0x0c79262bd1fc8ULL, 0x563053b0dec55ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x5ca181254fe02ULL, 0x28db4686d14afULL, 0x79cca3a95a8a8ULL, 0x59f226371a7b1ULL, 0x3f748617ca63aULL}} ,
+ {{0x3dc527dc1641eULL, 0x33dc9d3942b42ULL, 0x6a6b3b932eca2ULL, 0x23d9c9c51448dULL, 0x0fed89e6420fcULL}}},
+{{{0x21083808c3cf3ULL, 0x7fbf6938a06f1ULL, 0x3ff581c8fde30ULL, 0x2f21dbab64150ULL, 0x08f050e6e4bbbULL}} ,
+ {{0x233924875ee62ULL, 0x0342f42b5be9eULL, 0x2da2018caa518ULL, 0x2a15a5c9aa39bULL, 0x38900048f0768ULL}}},
+{{{0x1d195c39d1551ULL, 0x03022b3ac9767ULL, 0x1f4b292db41a3ULL, 0x21df0001c812fULL, 0x1024811dcaccaULL}} ,
+ {{0x246d937f929e7ULL, 0x7eb69bfce19abULL, 0x3bbbfd2473e96ULL, 0x112e273e814c5ULL, 0x49e4fc36ff8a9ULL}}},
+{{{0x4357d04b900bdULL, 0x24640a17a1d7fULL, 0x78541d49225e9ULL, 0x642f3c7410131ULL, 0x2583374456f20ULL}} ,
+ {{0x2da60cbcea18fULL, 0x065472523c042ULL, 0x727a901dfaedcULL, 0x3963f3eea9615ULL, 0x62d1c4fffd5acULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x1fc4e5b98881dULL, 0x5c56a1cc0a488ULL, 0x6c9c9af65465aULL, 0x5085db44c2119ULL, 0x05b4079d8c7a5ULL}} ,
+ {{0x33fa8d79f612fULL, 0x1fcd20d221190ULL, 0x5f953928d8f4bULL, 0x52bc80e09b4f2ULL, 0x2329432253e9aULL}}},
+{{{0x62dfd0af81ce5ULL, 0x5682fae1ebeafULL, 0x5574666fbf845ULL, 0x2b64be05f9894ULL, 0x69d98b5ecc35dULL}} ,
+ {{0x481f8259f4e8eULL, 0x3702a9aa1c5aaULL, 0x23fa52f3a4a9aULL, 0x355a270651d92ULL, 0x3e26d487fbfe3ULL}}},
+{{{0x1dbe7119c930fULL, 0x6e2a50870be1eULL, 0x4fab77c9f7b74ULL, 0x4c07b2df027a4ULL, 0x123eb7853c155ULL}} ,
+ {{0x312b4f0ccfff5ULL, 0x2e3b970992be0ULL, 0x6a5880f32f380ULL, 0x3e58c55534a45ULL, 0x071517a6498d2ULL}}},
+{{{0x76ad49dd4b6d9ULL, 0x7b3c20580ee15ULL, 0x1c0cc9b92b446ULL, 0x03acfba0e3c49ULL, 0x62a8a839f4566ULL}} ,
+ {{0x48b613555bf3bULL, 0x1182aa75d12e8ULL, 0x18044a657f4efULL, 0x1e14e88e58f4bULL, 0x3d45d6c61b8a0ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x30dccb2500e7eULL, 0x7bda84b6e34cdULL, 0x6884bf3c2b2beULL, 0x1f988f46d271fULL, 0x4e1c036204e12ULL}} ,
+ {{0x561736f1bb1c8ULL, 0x3e4af4fa1a4e7ULL, 0x093da4cbc39cdULL, 0x53151564827ecULL, 0x6a5908d961f00ULL}}},
+{{{0x08e2ff8552d6fULL, 0x644dbbd47631eULL, 0x79ae397fbd745ULL, 0x79d24a3240869ULL, 0x7fe8906b455e9ULL}} ,
+ {{0x0b97b336976d3ULL, 0x3ad6534ddce08ULL, 0x128fb06357743ULL, 0x2818101d89bf5ULL, 0x1300ff9d28f13ULL}}},
+{{{0x3828ad212db7aULL, 0x3897f35e3c360ULL, 0x4aa5391f2bafaULL, 0x1fef3c3315991ULL, 0x6c112bbd99aa2ULL}} ,
+ {{0x0cc9dacd5a68dULL, 0x3a969b86feeadULL, 0x795816846edb3ULL, 0x2da6d4593bedeULL, 0x3f92a42703f69ULL}}},
+{{{0x2bf8417b5d622ULL, 0x29be942847982ULL, 0x2adbab286f0c4ULL, 0x313d9a988abfdULL, 0x1e34443347f9eULL}} ,
+ {{0x0350bb4a6fc79ULL, 0x538908449b924ULL, 0x19aea5227b082ULL, 0x7653fc3dca42bULL, 0x295955a5ed061ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x0abd5f1f5e156ULL, 0x2d9fe7135c575ULL, 0x462f0c52fca7dULL, 0x430da5f2d8354ULL, 0x4cab819c06b2fULL}} ,
+ {{0x338160176681fULL, 0x1ccf252eee1e5ULL, 0x433a3962daa19ULL, 0x7f319da9c9b7bULL, 0x1f10fb18bd5ecULL}}},
+{{{0x353ef630df083ULL, 0x3d9f07f2d76adULL, 0x78028b26c8813ULL, 0x351d2ce63ec52ULL, 0x7c686b90cf6ffULL}} ,
+ {{0x1d51a7fd71533ULL, 0x19e14a3188b04ULL, 0x74463ebf6a1cfULL, 0x251e92946c881ULL, 0x000f1deab1d3aULL}}},
+{{{0x7fde5908348ccULL, 0x330517f355087ULL, 0x48c713da0d091ULL, 0x7c63ff0b8e66cULL, 0x77a0b600eef1aULL}} ,
+ {{0x09d37f7611af5ULL, 0x0296ded3e5e80ULL, 0x009fd35146614ULL, 0x08fb62382b53eULL, 0x722750e8d4208ULL}}},
+{{{0x5ddf4ade53a2cULL, 0x42b76a88b9ee5ULL, 0x72916597e268cULL, 0x26d384c90d226ULL, 0x0aecf4e5a0c4cULL}} ,
+ {{0x008e965216807ULL, 0x016b7494d4174ULL, 0x52fd7146f42beULL, 0x0b4b896b02839ULL, 0x19304020c00e6ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x45ceb3b5775d0ULL, 0x71709f92a0ac2ULL, 0x2a7d6afd28c7aULL, 0x64b6d414a0a90ULL, 0x51f4ff8c599b1ULL}} ,
+ {{0x406b0d7863ac1ULL, 0x700fa97a36ff0ULL, 0x14bbad2c4ba01ULL, 0x0f9fb7ccd771cULL, 0x35ac9588d46e4ULL}}},
+{{{0x29b6a71bf9741ULL, 0x1dccd7f1e7d8eULL, 0x149a0be95a5b0ULL, 0x31fb1e040b0ecULL, 0x568de690133caULL}} ,
+ {{0x5b123773039e8ULL, 0x7e9ae87c7a37fULL, 0x03996d0e96eb9ULL, 0x323a0ee6e219dULL, 0x4c48220992e8eULL}}},
+{{{0x206c8b59f5785ULL, 0x4df5e07e8f3f6ULL, 0x5f659be6ec6a7ULL, 0x3193a84b2d27cULL, 0x4f2f4b477f6caULL}} ,
+ {{0x0269d9359e934ULL, 0x4b847999e4a90ULL, 0x4118b05ab8e14ULL, 0x21cd0b6990453ULL, 0x13115f873b8a8ULL}}},
+{{{0x30cc4663403daULL, 0x61f36a4978dceULL, 0x48df3d3a54a05ULL, 0x10ef7a35c4feeULL, 0x3342c4717d552ULL}} ,
+ {{0x5c6a85b6937c5ULL, 0x0cd0dcc3f9493ULL, 0x1f7499c735fa9ULL, 0x29b46aa6678fdULL, 0x50676cdf00c93ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x3a45d29424d9aULL, 0x77229b1550dedULL, 0x48807bcdb7f49ULL, 0x19eac75c6e662ULL, 0x3396978bfc50bULL}} ,
+ {{0x0ca4ac8073393ULL, 0x794fbb7b5763aULL, 0x41f332d14fab1ULL, 0x13ee5ce9adfc8ULL, 0x5ccf1359113c1ULL}}},
+{{{0x507abd741b845ULL, 0x0765bf9d1c002ULL, 0x54407d3700571ULL, 0x012127b2d084aULL, 0x3faa2a093a19aULL}} ,
+ {{0x1ddbfc6eb8edcULL, 0x4f9dcc8fcef62ULL, 0x52f722ba316dbULL, 0x1c4e5331d8aabULL, 0x7a1de10dacfdaULL}}},
+{{{0x1d07503bfef89ULL, 0x5b7dacfb96a05ULL, 0x662a8c801ed7eULL, 0x340e5c9479ff6ULL, 0x3938a36463015ULL}} ,
+ {{0x5aab450d6a48bULL, 0x4d425cecc8c8bULL, 0x3d559e9f2e2ceULL, 0x56efdae42272eULL, 0x34bab9488b48cULL}}},
+{{{0x32717aee8e3c5ULL, 0x04528ee2c0c9cULL, 0x3224c4176483cULL, 0x64b54dd76d087ULL, 0x30f9cd3076c51ULL}} ,
+ {{0x7a7bc8cbdb095ULL, 0x3f7e749dfafc9ULL, 0x67d68ae01e411ULL, 0x063388c90b427ULL, 0x2caedfaa42012ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x093714b7e6e90ULL, 0x2e48e3d7dae58ULL, 0x564fb2ffa709aULL, 0x45f3eba87d40cULL, 0x6070951e96e61ULL}} ,
+ {{0x65f4c1d3e6689ULL, 0x3289ac860981fULL, 0x1c7708b1eb6d4ULL, 0x7939c20ef3214ULL, 0x7bb8b8086b2c8ULL}}},
+{{{0x1afd99d27703dULL, 0x743cbbc75e4f6ULL, 0x30fa1818550c0ULL, 0x6c0fabf5e1d13ULL, 0x1ec0eb040164dULL}} ,
+ {{0x4c3a1d1a42cdaULL, 0x1d703e0e64dcbULL, 0x268cca6667864ULL, 0x634a13476bd57ULL, 0x3df62c38b3077ULL}}},
+{{{0x0657988b5aa64ULL, 0x7a6ec5ad29187ULL, 0x7a3ffaceb3591ULL, 0x684a8356384c0ULL, 0x0a939a0d03280ULL}} ,
+ {{0x00fb4c5f1a342ULL, 0x717a622b1b91bULL, 0x3ee2823362c1fULL, 0x7c329477f038cULL, 0x08995249ecbeeULL}}},
+{{{0x748aa01d5a90fULL, 0x79743464cc509ULL, 0x26c605e0047a9ULL, 0x609348312c42bULL, 0x1924416956ea2ULL}} ,
+ {{0x1fb8adaf021deULL, 0x3304d5919b716ULL, 0x3ae233f1f6dccULL, 0x6e9037db7f74bULL, 0x0c8e28127b7dcULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2ff28ce974493ULL, 0x6937edeb88807ULL, 0x36263ee101dafULL, 0x6a4f62b81c676ULL, 0x2898ffaab663eULL}} ,
+ {{0x3bc46f335163dULL, 0x69f49f6d8de96ULL, 0x64d155f984e83ULL, 0x23bf3aceb5e5cULL, 0x094f3b96ab6c9ULL}}},
+{{{0x14f12016bf75aULL, 0x648f2908e182aULL, 0x05f335dc5b006ULL, 0x0882eaeac87b3ULL, 0x34e2ddf511570ULL}} ,
+ {{0x3ac585c1fd926ULL, 0x741f0b87a4071ULL, 0x3361a39b5ff0cULL, 0x38bbbaac7ba29ULL, 0x1bdaea88b78ebULL}}},
+{{{0x12093400eeab6ULL, 0x0eb508c2d46afULL, 0x1a7b5bddfe5b4ULL, 0x5f8663b12868eULL, 0x5726e2adc5bbdULL}} ,
+ {{0x57d966b0ee8cfULL, 0x21b35279a24fdULL, 0x3be197a1262a5ULL, 0x782c4877c786bULL, 0x79735f155fd92ULL}}},
+{{{0x69fedfe165cc8ULL, 0x154f3e97ecac4ULL, 0x3761e3297fa14ULL, 0x12aac61a7674cULL, 0x4cb56bd83d7bbULL}} ,
+ {{0x4a7fa15a03865ULL, 0x61370d89d71f6ULL, 0x66a2ba9357a94ULL, 0x48a29adec0d4fULL, 0x5d1f6fb463251ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x28b7d1ebc8facULL, 0x625ced5f1a16bULL, 0x0f8bd4dbcef8dULL, 0x6278a1aea4ac8ULL, 0x49761c57ce3c8ULL}} ,
+ {{0x5576b61e150a8ULL, 0x72dc181689d66ULL, 0x1be3fc9d20097ULL, 0x4a77996bf9f3dULL, 0x3225035e10650ULL}}},
+{{{0x5e5640fdc60a9ULL, 0x1c5ef29f1bc43ULL, 0x50ddc14000890ULL, 0x25fdbe3b51e92ULL, 0x654b39f465080ULL}} ,
+ {{0x3b76a6b121996ULL, 0x5169b7368bb9cULL, 0x1951052a372baULL, 0x10c424d1a6731ULL, 0x50ce7be2f1011ULL}}},
+{{{0x1471b53302141ULL, 0x7aaf05b0316e0ULL, 0x16fd8cbc1828eULL, 0x07eacc8c41878ULL, 0x34219355b9a29ULL}} ,
+ {{0x6f96aeb9e6797ULL, 0x5852d7d0e7acdULL, 0x47266a002098fULL, 0x348294864180eULL, 0x514bff4e806abULL}}},
+{{{0x65c6e8c637d0fULL, 0x605df4cbbe61bULL, 0x096f55014968eULL, 0x5ecc5efd7035dULL, 0x091605b338ea1ULL}} ,
+ {{0x0ad2864bf8cc7ULL, 0x2b7592deb54bfULL, 0x4bd9af75b55ffULL, 0x1195d7b2a551eULL, 0x1df405521e9a2ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x7e4feebbb1faaULL, 0x69116e5963f90ULL, 0x7c91893d6e71bULL, 0x4b849c547cfd2ULL, 0x4606fdec56d46ULL}} ,
+ {{0x4ce344ecf664eULL, 0x2abdaca14db21ULL, 0x26fbbe963a6beULL, 0x121f01a87d2dcULL, 0x0f00d9e6656d8ULL}}},
+{{{0x1d364fc3a757bULL, 0x26b33493bafc5ULL, 0x416cd4a9ed2fdULL, 0x1428d0b57e1d5ULL, 0x4339fa86a2324ULL}} ,
+ {{0x5fe8a63a34b0eULL, 0x553b7a27e2b14ULL, 0x44205c101d9feULL, 0x48b05df5dccbaULL, 0x6d07cc3462baeULL}}},
+{{{0x3ee6593c6f1c3ULL, 0x7183e029d5781ULL, 0x3ab5f270a2613ULL, 0x06acce253e51aULL, 0x7c6321d6cb695ULL}} ,
+ {{0x76473317ceb99ULL, 0x531954cc18fecULL, 0x3888f4c9b8a45ULL, 0x2aeefa9192ebbULL, 0x70b3847cb78fcULL}}},
+{{{0x64e9736c701ebULL, 0x4f74581abf576ULL, 0x29bfef3795591ULL, 0x72b1cc6e98276ULL, 0x62332ee4f8ee5ULL}} ,
+ {{0x74bc89fb8ef65ULL, 0x6b25369243fb4ULL, 0x5e7ca6c2b5a08ULL, 0x7cfbf3517a3f8ULL, 0x3e1bfb3c0218cULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x4d15140c88b2fULL, 0x054553c816355ULL, 0x6fe5decbc6485ULL, 0x7a79e9fb6abfbULL, 0x7b9e0081b2e20ULL}} ,
+ {{0x3f1fcc42b858cULL, 0x2f098844f3d15ULL, 0x7e5f69a1be8e8ULL, 0x4a6902b81b7f9ULL, 0x093854716ef97ULL}}},
+{{{0x15e2fa8742940ULL, 0x7b727de748f3fULL, 0x221a66ab0c4cfULL, 0x148f99690bb8fULL, 0x7ecfa6b215265ULL}} ,
+ {{0x37da46c4720c6ULL, 0x7dbe06b7d4c79ULL, 0x1081f39b60620ULL, 0x57f2abdbf300cULL, 0x10958b5cdaf36ULL}}},
+{{{0x5d7b4030de462ULL, 0x6327be8d7bf59ULL, 0x426d8eea0b041ULL, 0x4d414a1c23802ULL, 0x20d7e4108ef55ULL}} ,
+ {{0x062bfab1c8257ULL, 0x5c51e19f89d0eULL, 0x21625e020f059ULL, 0x765e7bffb07a3ULL, 0x03fa5ae925b87ULL}}},
+{{{0x2fc50639295fbULL, 0x043118bd49e0cULL, 0x6a709e2dc905fULL, 0x7c294eb193573ULL, 0x6bda13918dcbaULL}} ,
+ {{0x5a54bb6c20a36ULL, 0x44be62822e0ebULL, 0x5219be64be119ULL, 0x7443e86cbd339ULL, 0x2c3fa803b162eULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x3e8a98a70b14aULL, 0x142c4bc400f2cULL, 0x466b59a903d2fULL, 0x561458633c44fULL, 0x19af956d2b5b4ULL}} ,
+ {{0x2b460ccb69d8bULL, 0x5094b4d22e9eeULL, 0x4f0c91686acd1ULL, 0x43baa183943c1ULL, 0x5e228bb5fbae6ULL}}},
+{{{0x1bbc53587b9f1ULL, 0x19ab9badeb9f7ULL, 0x7ecd2439839f0ULL, 0x34d56368f2128ULL, 0x45bf322997c44ULL}} ,
+ {{0x5edc024c69e66ULL, 0x2ee7e1a910bb4ULL, 0x087fd09ffa9eeULL, 0x3a9fecd17cdd0ULL, 0x529d884884075ULL}}},
+{{{0x7062a344896c6ULL, 0x659e35e87b295ULL, 0x721790b088703ULL, 0x67d149f511a97ULL, 0x067c7289e5840ULL}} ,
+ {{0x6a689e5036532ULL, 0x7dd7951cb766dULL, 0x52c51762d588bULL, 0x6737adadf7ca6ULL, 0x341113f48b7b5ULL}}},
+{{{0x09ce21522c607ULL, 0x6f5c4fb23344cULL, 0x6469a03269938ULL, 0x38c0072a48947ULL, 0x39632228d7d14ULL}} ,
+ {{0x69ef27e00e2e8ULL, 0x3d7a092a73323ULL, 0x39ab09ac9ed9cULL, 0x374726aa37155ULL, 0x6f59557cabbd8ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x071359b6e6424ULL, 0x6c664206679cfULL, 0x22c56e66dcfc4ULL, 0x6a7f6a6e7b496ULL, 0x4da4821314574ULL}} ,
+ {{0x70759a40a6e65ULL, 0x6cdc3e94d7e42ULL, 0x36adb918af2d7ULL, 0x1690294de49d1ULL, 0x314016034673dULL}}},
+{{{0x5a1bd156d734cULL, 0x300c481626b89ULL, 0x0607fad6c71e2ULL, 0x4ed332aeca1aaULL, 0x22423cb8e8212ULL}} ,
+ {{0x223156f08cdb4ULL, 0x4fe3a3da44163ULL, 0x33a7bcd15cf1eULL, 0x4c75b1cfb5bbbULL, 0x627dcf9be9be7ULL}}},
+{{{0x1bafd72fc5b92ULL, 0x43c72af94dfbeULL, 0x350af500fa4fdULL, 0x29f1926edec90ULL, 0x32beb4e36411fULL}} ,
+ {{0x01fc9e7901786ULL, 0x77a0725ad54a2ULL, 0x3684d67a69b10ULL, 0x4281e5cd0730dULL, 0x425a36157c40bULL}}},
+{{{0x104dcab320bb4ULL, 0x32ea163c42aaaULL, 0x0ae44e8d5ce26ULL, 0x4e0bb7524f3ffULL, 0x04230253b946fULL}} ,
+ {{0x558741d1e5afcULL, 0x2e7d2ef71f4d2ULL, 0x7bd5e98b5e4ecULL, 0x1cf3726858122ULL, 0x04db9dd92f8d9ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x691589756d7c0ULL, 0x60c77d3e9e13bULL, 0x782f1750e1a0eULL, 0x54745dfbae079ULL, 0x63b06e648bf7aULL}} ,
+ {{0x0249be08bae16ULL, 0x6e11a18488b8dULL, 0x75361fff589eeULL, 0x0df8d967ea85bULL, 0x1b17d88ed9954ULL}}},
+{{{0x038c38e375586ULL, 0x294fa52f6a289ULL, 0x678e110d7c515ULL, 0x31e001a5b0df8ULL, 0x0b2cea0029ee9ULL}} ,
+ {{0x683199e99daeaULL, 0x22a10eedd2dacULL, 0x5071a1d80f3f7ULL, 0x5556f2f6dc76cULL, 0x47ea95da28d39ULL}}},
+{{{0x11dae19ba80d0ULL, 0x5ebb587fecf35ULL, 0x6c8a738a87e59ULL, 0x28647ca789bffULL, 0x66f6219aba28bULL}} ,
+ {{0x1f305b854fb02ULL, 0x0d3a8c68d2a50ULL, 0x599abe35e3ddaULL, 0x6af7bc853f37fULL, 0x489dfc559b6acULL}}},
+{{{0x245cde613aabdULL, 0x3162c814b3489ULL, 0x25f98104cd35aULL, 0x35da76a65834aULL, 0x06e3d157d1cd9ULL}} ,
+ {{0x793c427456c7aULL, 0x7470a0c4f8fafULL, 0x3c7671a22d5acULL, 0x49ec99cdc8cbcULL, 0x72f5ce3c9ce0cULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x22c567d23ea24ULL, 0x1008c10a1cb3cULL, 0x04fbd2c79d16aULL, 0x7c2a2c1ffa66dULL, 0x1f13202c95083ULL}} ,
+ {{0x2025c90275f48ULL, 0x7d6ab88ef15a8ULL, 0x7f5ffe8021421ULL, 0x5bf790884f3feULL, 0x66336d356c381ULL}}},
+{{{0x0e4ac81360393ULL, 0x3d648a986a124ULL, 0x62ba798845130ULL, 0x09f630f7f46bdULL, 0x1d4e70e7fa35cULL}} ,
+ {{0x15795ddc22e61ULL, 0x6a2ec7d10157aULL, 0x1ca78462b9122ULL, 0x7f90528c6c2dfULL, 0x7b2807a91ce09ULL}}},
+{{{0x58c265e1471bbULL, 0x23ada6f9d3907ULL, 0x7ef7f99b41cbfULL, 0x0244b2ccceb3cULL, 0x72a0b27b3a0f4ULL}} ,
+ {{0x17543c8693b4eULL, 0x6f97c8acf2d8aULL, 0x02d08b309469bULL, 0x304008e10416aULL, 0x02fc5604bfd76ULL}}},
+{{{0x047ae60b7e824ULL, 0x1385ce47cbf90ULL, 0x538a682639a17ULL, 0x1964a969cc270ULL, 0x4c27afff3c45fULL}} ,
+ {{0x2bd114bf5a66bULL, 0x3ca349893cb77ULL, 0x30a70ea4342f8ULL, 0x43ecaf88f5b13ULL, 0x5f2c99e6526dcULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x7d1b43224e085ULL, 0x651f7f44d3f9dULL, 0x1f5bb93da54b1ULL, 0x57bd040abfbc8ULL, 0x786be30733efdULL}} ,
+ {{0x30712c63e2736ULL, 0x7d673ad37c9d5ULL, 0x3f4211ca9f022ULL, 0x42d9a138766eaULL, 0x653a5f772f349ULL}}},
+{{{0x022f04c2eaa13ULL, 0x57d69a3366d97ULL, 0x72376731a9341ULL, 0x499efc4abc0adULL, 0x21fee4804968aULL}} ,
+ {{0x0d3e930901700ULL, 0x7512e5846260cULL, 0x2160ce6f694d9ULL, 0x28ea0b62ed0a8ULL, 0x500b7740072cbULL}}},
+{{{0x1449ec0ec3464ULL, 0x54da0a6d415e8ULL, 0x27490d51894c3ULL, 0x3a33578cadec3ULL, 0x5dbd3bf95494dULL}} ,
+ {{0x4e1c737e25b77ULL, 0x54f6f73f1826fULL, 0x264aae68d0b38ULL, 0x5d8431e6c6054ULL, 0x56f5f77776e9fULL}}},
+{{{0x7136e1146b3dfULL, 0x59e3baac9c516ULL, 0x25223e30d62b6ULL, 0x5b57250cc032fULL, 0x77fe8a5d490afULL}} ,
+ {{0x5c5afa5f50246ULL, 0x7c146a8b74daeULL, 0x48636448ab327ULL, 0x18b45600199caULL, 0x3c530f01e039fULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x14e341f377534ULL, 0x3093f0ced03b5ULL, 0x3de5d9533f25aULL, 0x45e80b6292501ULL, 0x53e2a4ed1bbb4ULL}} ,
+ {{0x390a25a9bd559ULL, 0x5104aa986f71aULL, 0x19606a9fc3c20ULL, 0x39951e4a90670ULL, 0x5a2334fdda642ULL}}},
+{{{0x37bb34d0cb0b5ULL, 0x4ccc73143f904ULL, 0x27328dc4132ebULL, 0x77c607fcf02beULL, 0x2618676f8fb18ULL}} ,
+ {{0x41a235413414bULL, 0x78963d17529d4ULL, 0x2db2dfaec9057ULL, 0x62b64797a8d8fULL, 0x2aa05b60a232eULL}}},
+{{{0x7922e864729a4ULL, 0x2ab965e69e229ULL, 0x4cf8b22e698fbULL, 0x3cdd847808f88ULL, 0x281e0f83ffa5cULL}} ,
+ {{0x58eeca17a291dULL, 0x68c0d005d55b6ULL, 0x4ef233e9470a5ULL, 0x05256be15c5beULL, 0x5d2e7c5951174ULL}}},
+{{{0x7323ebc4f6c0aULL, 0x709382263495cULL, 0x5ae3f4f0bdefcULL, 0x593de67fba956ULL, 0x566dcd766740cULL}} ,
+ {{0x29bbead27b0e5ULL, 0x2a4675bcc76beULL, 0x5167bcdf82adeULL, 0x69cc7ba9c8cb7ULL, 0x51e9f19fc00f3ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x194862414aa88ULL, 0x77996a347c242ULL, 0x2e9b673567382ULL, 0x7bd917dc6b92cULL, 0x2151b330947c9ULL}} ,
+ {{0x6d0aff23d74f6ULL, 0x7992d646f8063ULL, 0x6926b7241c097ULL, 0x41a851efe24fdULL, 0x2a01507ee46f3ULL}}},
+{{{0x7fd3a6196e3d6ULL, 0x284949203f37dULL, 0x476c5437b216cULL, 0x706c3c52af457ULL, 0x7b8d2c823baafULL}} ,
+ {{0x14483f8af0c85ULL, 0x3291ef9e8bb29ULL, 0x7868197c6d14fULL, 0x7cdc4f68ad9e1ULL, 0x1c45a557b3624ULL}}},
+{{{0x11fd1afea128fULL, 0x54f747ec1620fULL, 0x39d88c95e2eb3ULL, 0x7219dd0288903ULL, 0x0dce317820a45ULL}} ,
+ {{0x62391a6c27c84ULL, 0x6bab9df3b97b9ULL, 0x5890fe79888c1ULL, 0x7c63fcebafb86ULL, 0x1c9fac72e47dfULL}}},
+{{{0x51c3cd099c188ULL, 0x73201e27df68bULL, 0x3731a5654bcdaULL, 0x679c6f128856fULL, 0x5fa2b1dfec51bULL}} ,
+ {{0x09b7d23a1682eULL, 0x217e84f70ad28ULL, 0x14b5cbd03592eULL, 0x45eb26f10d929ULL, 0x3f81faa56dc38ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x6668a7b47fdfbULL, 0x6fdf04c85cf33ULL, 0x4261b63dbb087ULL, 0x02c3501eebe18ULL, 0x1f878c9bb777aULL}} ,
+ {{0x1553da8e44755ULL, 0x69c15c3b56684ULL, 0x2fd62e7176fabULL, 0x6fa0d18c49562ULL, 0x59479937cae12ULL}}},
+{{{0x5a949c163cac7ULL, 0x64c9b4fcaa8a6ULL, 0x77ab0cbdd401cULL, 0x79d5908cdac3aULL, 0x08e60479f7f51ULL}} ,
+ {{0x6e1fa4b22fa46ULL, 0x2ecf74cff92dfULL, 0x17e42186f9f12ULL, 0x6e6d908adfa77ULL, 0x1b2b6c48c2eeaULL}}},
+{{{0x4314fb46239e3ULL, 0x2ea2e7abb5920ULL, 0x1c10e8fcee315ULL, 0x7ddf14240b0f2ULL, 0x06745ea49e4fbULL}} ,
+ {{0x659e027ffac29ULL, 0x21af061b38737ULL, 0x0b30b86dc542cULL, 0x5aebe9d403998ULL, 0x22f4f0c16b58aULL}}},
+{{{0x1c67d35fb7ffeULL, 0x3f58058850460ULL, 0x65003f276d108ULL, 0x084cbed657752ULL, 0x78877b5d87774ULL}} ,
+ {{0x619812d90fbf5ULL, 0x0119110ada5f3ULL, 0x064053505dd71ULL, 0x1f2242674303bULL, 0x0341b46c32833ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x46e4f09c210ffULL, 0x38f794fdbfa5eULL, 0x59f6ada8ee874ULL, 0x008a59b43ea19ULL, 0x1787c129a6052ULL}} ,
+ {{0x738da2fca96f6ULL, 0x11fcfb95f8374ULL, 0x575a8ad1f8a24ULL, 0x15b6f5a50fd25ULL, 0x0ba4e0f55131cULL}}},
+{{{0x72b8e04c6e55cULL, 0x6f96470a717caULL, 0x049bb4ea53efaULL, 0x514c997596ad5ULL, 0x01f54318884a9ULL}} ,
+ {{0x52159a2dbfc50ULL, 0x0e5f5c66fd7b1ULL, 0x534371e5f406aULL, 0x0764202f780b1ULL, 0x0b704f0aa8dd4ULL}}},
+{{{0x2d35c67016941ULL, 0x22afa27f9f8b1ULL, 0x72ed4e404f99fULL, 0x3e15b134b2b40ULL, 0x06589763fb5ceULL}} ,
+ {{0x2e5f0baf30e0cULL, 0x36418ceeaf657ULL, 0x22a73caf89226ULL, 0x527d878e0b4ddULL, 0x367e10ee9a052ULL}}},
+{{{0x503e940e9263fULL, 0x13a3c122d20d5ULL, 0x1b49f79e61182ULL, 0x45773755ebb73ULL, 0x2fcd57c067c34ULL}} ,
+ {{0x6bcc7b9dcc17fULL, 0x76f45096aa7b0ULL, 0x0a99ef3e31d37ULL, 0x38d0583c7a6b0ULL, 0x1a3da7acfabf1ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x778185eed3f91ULL, 0x0089181a58467ULL, 0x3475a3ba7efa0ULL, 0x625d74f2bac1bULL, 0x2b556bbc070b5ULL}} ,
+ {{0x184e1d7174d6fULL, 0x665dfb2162f1bULL, 0x303e86cfc66d6ULL, 0x6c497006ed9b4ULL, 0x7ba01332807ebULL}}},
+{{{0x04444af406f1aULL, 0x083da01b1e876ULL, 0x707fa3974642fULL, 0x7027c48ae62f9ULL, 0x3f5c47b490be4ULL}} ,
+ {{0x132fef32c3bb0ULL, 0x408b75547e0eeULL, 0x0e72d53aa36a1ULL, 0x10a6945f95a08ULL, 0x537ce98e07428ULL}}},
+{{{0x18fc98dc1aeb0ULL, 0x40f375deeef57ULL, 0x4ff89abd6a0f2ULL, 0x59222a5f1802eULL, 0x1e2b1d5578437ULL}} ,
+ {{0x5a06716d6b801ULL, 0x634f48b1c3722ULL, 0x27c4a2cbddcdcULL, 0x469331b639ffaULL, 0x41c6747ff756aULL}}},
+{{{0x4dd30a8b4f85dULL, 0x23b195a74a719ULL, 0x5cb5244c6cbe3ULL, 0x325411da52b82ULL, 0x614118e22068cULL}} ,
+ {{0x51229478dd419ULL, 0x176a8ef02360cULL, 0x5521417ea968fULL, 0x76115c6cb99d4ULL, 0x63ebe5283599fULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x4f4d8ef3f3fb1ULL, 0x560ca0c14167fULL, 0x0902c55c148a4ULL, 0x7e60c3caffc12ULL, 0x13aea1849989fULL}} ,
+ {{0x0c101c2b81f44ULL, 0x4820c00aaa326ULL, 0x49795c19cb5b2ULL, 0x5b87deedff90dULL, 0x0884949c8ca12ULL}}},
+{{{0x12bc94d43c4e7ULL, 0x07775e783abadULL, 0x437b4f66138e1ULL, 0x223ccf87e8190ULL, 0x0f72556998b00ULL}} ,
+ {{0x0863b5315df5eULL, 0x4d1ed0e1e3610ULL, 0x1af60692439f1ULL, 0x1ea23e577a77fULL, 0x16c19c5037c10ULL}}},
+{{{0x3820c3ec624cdULL, 0x1f6494c257233ULL, 0x7fd5d697d5620ULL, 0x400218985ba72ULL, 0x2c0315d2cf6bdULL}} ,
+ {{0x74a2f6115ffdcULL, 0x196a5e09e4c45ULL, 0x43c69d0fc7adcULL, 0x17b3eece6f56bULL, 0x163b5adb2f0e1ULL}}},
+{{{0x29ef5e347371bULL, 0x686d05ce5459dULL, 0x1a52e491e047fULL, 0x0ada9aec60887ULL, 0x25aea0bc08278ULL}} ,
+ {{0x0421105a13269ULL, 0x16c49b58b3a40ULL, 0x676817543884eULL, 0x0baa0895dfecdULL, 0x5ddcc7dccc9e4ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x270460638e3d9ULL, 0x4bfef29250bd0ULL, 0x6c01a34a53b48ULL, 0x03ef2334dd711ULL, 0x4eecfca39170cULL}} ,
+ {{0x6f6306a371262ULL, 0x6e1c1ab829f63ULL, 0x2b014239daa06ULL, 0x5f539f1231c55ULL, 0x5e9e7c4381074ULL}}},
+{{{0x3762e4f21f9fcULL, 0x6486eec0503f3ULL, 0x318a8c05efa74ULL, 0x04c183133490cULL, 0x2884187fa6114ULL}} ,
+ {{0x1768af4d3ab3fULL, 0x5586925b94794ULL, 0x30ca85e142c23ULL, 0x79ecfabfe8436ULL, 0x3200426867df5ULL}}},
+{{{0x18a4f061b6051ULL, 0x01ad755071744ULL, 0x55935da6fa7d9ULL, 0x6a7974d852d90ULL, 0x5b979f0832813ULL}} ,
+ {{0x1909d06ec44e5ULL, 0x1f5ef3c1a73efULL, 0x49eb81377f442ULL, 0x75c753c99a34bULL, 0x0ee157595aca4ULL}}},
+{{{0x04341a5f3da1aULL, 0x0dd4e3cefdf85ULL, 0x1034cbb3164efULL, 0x1e6a23789d9f6ULL, 0x1cd96ef237b21ULL}} ,
+ {{0x04a5ccd60dbe3ULL, 0x18e26ce7de1e3ULL, 0x05f3b62d047daULL, 0x5afcbbb9327afULL, 0x7a626aeb91efcULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x5810897a24a18ULL, 0x7d07e19989065ULL, 0x3ed6d325437b1ULL, 0x62b3325404c7dULL, 0x275d04f2b3510ULL}} ,
+ {{0x62e5a06b8b93bULL, 0x2347386f0587fULL, 0x5218f6a9a707cULL, 0x75e5316ef56cdULL, 0x57dd6527da326ULL}}},
+{{{0x42e7d31374f84ULL, 0x6ed6540f0f5b7ULL, 0x0d5d53bad7ff0ULL, 0x39d0c8555ef53ULL, 0x3c3b6a92efb1bULL}} ,
+ {{0x460396d94b23bULL, 0x6c763503cfdd5ULL, 0x514aa5015721dULL, 0x583d89174c05cULL, 0x126d49709e40cULL}}},
+{{{0x54ca8847818fdULL, 0x62e9cb4cb2dcfULL, 0x70544ba129867ULL, 0x1aeb58a790994ULL, 0x2201bfeff7515ULL}} ,
+ {{0x2fde64c624ba4ULL, 0x7be5f903e40eeULL, 0x6e8a9d9a1f04aULL, 0x4050b8fd8b2faULL, 0x2af4f8c0bfb03ULL}}},
+{{{0x11de45b556055ULL, 0x4ce13eb73a98eULL, 0x0cb8a80b26a16ULL, 0x583d2954f6724ULL, 0x3cde77866cc73ULL}} ,
+ {{0x7437e967a18f7ULL, 0x656c9df8ab52aULL, 0x74d4b5f93c801ULL, 0x263b8fb42db69ULL, 0x79f2b3d77f3f4ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x3797b55a7ca46ULL, 0x21dbeccab595eULL, 0x194ab1391ec51ULL, 0x31153e57cf14fULL, 0x31a75b21cb532ULL}} ,
+ {{0x0bd0826c5d790ULL, 0x3c6386b0c6a76ULL, 0x7e29a445519d5ULL, 0x417c432840d17ULL, 0x77006e7cf1049ULL}}},
+{{{0x14ef609612181ULL, 0x0ee6c2c7dd25eULL, 0x7252d0839531eULL, 0x3bac8bf5c68a3ULL, 0x507fddb828993ULL}} ,
+ {{0x7d65dbec08f89ULL, 0x759d033be1413ULL, 0x1e35eed6261ecULL, 0x78cba78899fe4ULL, 0x5ffa5d8998f8dULL}}},
+{{{0x01f479485359eULL, 0x15db09a04c2b2ULL, 0x49e19098fde02ULL, 0x04e6e2c3afa6bULL, 0x1ffd35207e22cULL}} ,
+ {{0x370ba976f0e68ULL, 0x682417ca1d477ULL, 0x7439be11f728bULL, 0x7234cd419b611ULL, 0x0f4876ba440f6ULL}}},
+{{{0x259e237612aa3ULL, 0x5c86c9744e1c2ULL, 0x47a91e5a50b02ULL, 0x257fc758ac594ULL, 0x247ab53368a2dULL}} ,
+ {{0x4ab1bdd33192cULL, 0x5685f0476003dULL, 0x000b4f7aa2018ULL, 0x7769c26a2bc15ULL, 0x33cbed49442e2ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x0918f41e868a0ULL, 0x574e5d202623fULL, 0x0018682b7bcc2ULL, 0x5ae2de76df7c4ULL, 0x7300f956c862bULL}} ,
+ {{0x0a32d82c1603fULL, 0x61c73f3c48b05ULL, 0x444fc69382731ULL, 0x020d21e038a88ULL, 0x116d410aa365eULL}}},
+{{{0x3945652014031ULL, 0x31dca5551450bULL, 0x2aad73634142bULL, 0x5fbc3dbd51c17ULL, 0x543d84cb04fb2ULL}} ,
+ {{0x32ba4de59ef20ULL, 0x293485d85cdd2ULL, 0x0ac9d611bd0b7ULL, 0x24f349ec1c78cULL, 0x0358fdc5b63edULL}}},
+{{{0x71c6263c98933ULL, 0x12d04d88c1682ULL, 0x2d1ec3cdcbb0cULL, 0x428ea7dfcdb4eULL, 0x074777ea63c87ULL}} ,
+ {{0x4cb794718b432ULL, 0x2b401e280eb5aULL, 0x586ad010742b3ULL, 0x47bb795157291ULL, 0x6c45e7ef76d4aULL}}},
+{{{0x0e1fb4f605ea1ULL, 0x68129eaa3ed4eULL, 0x0060718d8ce56ULL, 0x25a521392830cULL, 0x02ac4c0386a42ULL}} ,
+ {{0x74860d7de3877ULL, 0x4aa9ff50e9e00ULL, 0x487eddffd0cc3ULL, 0x2f23583d97f83ULL, 0x01a36c19fc30eULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x283d3ac2cc513ULL, 0x014a0bee52f90ULL, 0x75bd156187ed8ULL, 0x5cdb2e84c8617ULL, 0x2816f8430d466ULL}} ,
+ {{0x1b17e74b47f1eULL, 0x0cc956b4309f1ULL, 0x319ab821d177cULL, 0x51c1a92648778ULL, 0x5452c4b45430eULL}}},
+{{{0x489c13fdc9fe9ULL, 0x7f2183c84ee88ULL, 0x7d337b8f29d2bULL, 0x40b31bfca128eULL, 0x0cc495fe64bc4ULL}} ,
+ {{0x606036e75198bULL, 0x27c71834ded4bULL, 0x50deae783c8a3ULL, 0x3bf7f6069f334ULL, 0x42138e7b6cab9ULL}}},
+{{{0x7fbab3d70cad4ULL, 0x44ef981800bcbULL, 0x4d58ab955e3e0ULL, 0x7067201e34d7dULL, 0x548789c0c7abeULL}} ,
+ {{0x0435885aead32ULL, 0x7138007dcd637ULL, 0x1e7f2736d5a21ULL, 0x0de5bafa0fcfbULL, 0x2b531c3620f91ULL}}},
+{{{0x144a5a15b205aULL, 0x70c824c604492ULL, 0x11f6cb37bd956ULL, 0x1bc006185635cULL, 0x0a2818f5f5d89ULL}} ,
+ {{0x246e56c9a1bd6ULL, 0x24549d1b2ce1dULL, 0x03eeec52c9885ULL, 0x428dd824dd4beULL, 0x187c76a49af10ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x3d7d040f794faULL, 0x722baa6d0553dULL, 0x18fca2afde8ceULL, 0x5ded62cfa9bd5ULL, 0x389973be3632bULL}} ,
+ {{0x13dd87adab32cULL, 0x1d33b5e9a5953ULL, 0x4fabbd2de613eULL, 0x299d2301ac74fULL, 0x4d6bb19304a47ULL}}},
+{{{0x57b97cda89d97ULL, 0x51fbdf4bcf733ULL, 0x5f5918b0dad0aULL, 0x4a2e94f648dd2ULL, 0x68c0bfb003eebULL}} ,
+ {{0x1d3f62c84b7edULL, 0x2ead0eda48d74ULL, 0x7b6b27d89e566ULL, 0x1821710c4e4f9ULL, 0x4b0ad6be2fccbULL}}},
+{{{0x38925ed056139ULL, 0x68aa199636bb1ULL, 0x07ba11a2801abULL, 0x66dbb2d6441e3ULL, 0x0b4667cc7a19cULL}} ,
+ {{0x36aada1c2cf53ULL, 0x7039bd931f9beULL, 0x39d09dbe23db3ULL, 0x2330510b9597fULL, 0x016fe4ebb78f7ULL}}},
+{{{0x04dfcbe6b8c22ULL, 0x1132eea4dcc4eULL, 0x3f835e95dedfaULL, 0x38eb478c9396eULL, 0x3710538d7cd79ULL}} ,
+ {{0x027ca02778853ULL, 0x549151c48bcb5ULL, 0x0a8b7ab2862acULL, 0x06e04991b8baaULL, 0x7d10827db74aeULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x4570a141e648aULL, 0x1803372cb9b5aULL, 0x423f8c22efd9dULL, 0x084ebd46a86edULL, 0x7efb45d3a2851ULL}} ,
+ {{0x018acd0c28cdaULL, 0x3b4643a86ca5dULL, 0x5c7e2dde4895fULL, 0x7ab433848e34eULL, 0x0fe1198b11a1bULL}}},
+{{{0x6918f2c983218ULL, 0x79e7d519e0255ULL, 0x6cbb5a79176e4ULL, 0x6290b675e8c23ULL, 0x5d5225a5e2235ULL}} ,
+ {{0x6bc4e5de7b1b9ULL, 0x3304ef028177dULL, 0x56eafbb1ad6acULL, 0x6c69a454931b5ULL, 0x7ec9e5494feecULL}}},
+{{{0x2c3cd228bac21ULL, 0x75bd7af0bdd33ULL, 0x42505d6feaeb6ULL, 0x7d8493ed22c62ULL, 0x6db3c0d1a1f27ULL}} ,
+ {{0x6ba7775d04f62ULL, 0x5f25b171aeeeeULL, 0x4713b58f4d261ULL, 0x6d9f89747f807ULL, 0x07b499ecb9b1bULL}}},
+{{{0x31d729a2e5760ULL, 0x11184866b0dcdULL, 0x621aa263918e5ULL, 0x304995ab111a8ULL, 0x6fde98f557e33ULL}} ,
+ {{0x3f94a48002c8bULL, 0x22b7caa4d30ebULL, 0x27380949796c7ULL, 0x0055cf42209e1ULL, 0x6994510fbdad7ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x42d25a9abdca2ULL, 0x7dce106606bf5ULL, 0x4e96cf0da57f9ULL, 0x416ca8e4102e9ULL, 0x705bd9027e77dULL}} ,
+ {{0x6cd670c1bfec2ULL, 0x73c0591ca3c1aULL, 0x6b529073fc221ULL, 0x1d0ca65236a11ULL, 0x1417fa0628ebcULL}}},
+{{{0x5fb4b0a70aa7bULL, 0x74119f8b017feULL, 0x5415277d28775ULL, 0x29a7a91bb91a9ULL, 0x472e960dd122aULL}} ,
+ {{0x0d0578932b7ccULL, 0x5153326fc8eb3ULL, 0x53f1faeebb6ebULL, 0x7f7a60603bb0aULL, 0x10585d04fc529ULL}}},
+{{{0x002798ff082ceULL, 0x5c901229b5a35ULL, 0x15181da61022bULL, 0x7f37a9201ef2dULL, 0x7f8268bf03e12ULL}} ,
+ {{0x2cfa4c728e964ULL, 0x1658e4c921f25ULL, 0x4d5f7ca83b3aeULL, 0x4a52dbfa6c85aULL, 0x2fa1c83bb8e44ULL}}},
+{{{0x1a6693dccc58bULL, 0x6eee9b7888314ULL, 0x35b2433b21b1cULL, 0x201dc9391d4a2ULL, 0x3734c7d50aa73ULL}} ,
+ {{0x1f9ee663e7ef9ULL, 0x45b0235bfe513ULL, 0x02c343f37159bULL, 0x427d4123e7e35ULL, 0x416c8b45805eaULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2778df7ec1eefULL, 0x004206c1b7d5eULL, 0x42dc70d9d7bffULL, 0x31c345020da10ULL, 0x3c3c51d3a301cULL}} ,
+ {{0x342ef4bd6f892ULL, 0x7ee45d8895642ULL, 0x43809d2f44724ULL, 0x28d8d41ce89faULL, 0x6c161ec4de54dULL}}},
+{{{0x694aa63e45227ULL, 0x58ad8d385187cULL, 0x1db338af6dbeaULL, 0x5bc47511393e3ULL, 0x2a4ebd1072842ULL}} ,
+ {{0x06104ef23a7eaULL, 0x232d4add92a10ULL, 0x4b75c630f2347ULL, 0x0c93de5de937eULL, 0x49b857654a0e5ULL}}},
+{{{0x563ecc33655abULL, 0x038f4becaa22aULL, 0x7dc2b61e7f97cULL, 0x0687acccc6c01ULL, 0x25f528666b540ULL}} ,
+ {{0x15d705da18d7aULL, 0x2aacca61dc4eaULL, 0x6d1d40ef7791aULL, 0x64f0175c4acabULL, 0x6717cba71989cULL}}},
+{{{0x6109a9afceb6aULL, 0x3ad4783875b79ULL, 0x6b12516f11baaULL, 0x7fbf83e0920f1ULL, 0x04892cfff7f94ULL}} ,
+ {{0x6ca461a543130ULL, 0x178387c5978dcULL, 0x68fe3bafa05d6ULL, 0x09ad3d1928e08ULL, 0x3ae2aa25e2555ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x6098a9f1048b4ULL, 0x6ee160f5e1f4eULL, 0x098ae114a020fULL, 0x458dd27aee251ULL, 0x60c497780d40cULL}} ,
+ {{0x040c7086cb1d4ULL, 0x3aede616bee67ULL, 0x41d5d5cbe96c9ULL, 0x10427b6510476ULL, 0x22fa44ee0eb50ULL}}},
+{{{0x61904a63f000fULL, 0x1bd716fe62caaULL, 0x14c5a5e251f84ULL, 0x3dfd95553c0fdULL, 0x480d816072eb6ULL}} ,
+ {{0x684a8cd33137eULL, 0x5886d75ece3caULL, 0x6654b005abc5eULL, 0x1dabf39c3ada4ULL, 0x552d0f1d6bda4ULL}}},
+{{{0x33f84ff1f58e9ULL, 0x4ad261c396392ULL, 0x3e17c51f865d6ULL, 0x54ebc546e84feULL, 0x130130d18b59cULL}} ,
+ {{0x1894bc50376ffULL, 0x2b38e0b200e13ULL, 0x7f9196a244767ULL, 0x3a295aaecee77ULL, 0x29c224fb2db0aULL}}},
+{{{0x482ac0bf80638ULL, 0x51efc120572f8ULL, 0x2419a0021b2aeULL, 0x278fc16937ba3ULL, 0x378e98824a6bcULL}} ,
+ {{0x23fd4b8eeb48eULL, 0x68ea7a15c0376ULL, 0x1ee4b123a88a0ULL, 0x698dc36b7307fULL, 0x114214780d621ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x1739b04d8a85eULL, 0x157ee61bb9939ULL, 0x6707c63fdcc28ULL, 0x692c1f8e35528ULL, 0x2401d311a3abfULL}} ,
+ {{0x45e62387ee34dULL, 0x50076aa65776cULL, 0x4c80d68afcb11ULL, 0x70d70cd20a54cULL, 0x653224f3488caULL}}},
+{{{0x4ea8c3aaddde8ULL, 0x5be4e7cb6567eULL, 0x43032c7b6fe2fULL, 0x3742400f895fdULL, 0x72964d278e032ULL}} ,
+ {{0x526c9603b09c8ULL, 0x7743a939e4f89ULL, 0x1d910cc130898ULL, 0x1062108dd811eULL, 0x0eb4ace1c6b72ULL}}},
+{{{0x067deefe7856fULL, 0x74f7c0b57ff86ULL, 0x6158975ad50a9ULL, 0x4b0f6440b7c50ULL, 0x4d432defb596bULL}} ,
+ {{0x4cfe4cc33317cULL, 0x31a2ee8f01fedULL, 0x481fe625da7a7ULL, 0x41384278e8eabULL, 0x0c21c6405735cULL}}},
+{{{0x78e42fa9b8ed2ULL, 0x1549f30d8f1fbULL, 0x7b2fc867401c3ULL, 0x286c62c18312bULL, 0x5aa06a8b5ddb3ULL}} ,
+ {{0x1dd200d7c58c1ULL, 0x312e7712be4c2ULL, 0x388cb7f8e2fe1ULL, 0x71bd2f933ec7eULL, 0x7920277cec6d1ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x34595fac0e9d0ULL, 0x284af259e32c4ULL, 0x0d8b110510338ULL, 0x5ab5bab31eca8ULL, 0x0ebb89efa79e3ULL}} ,
+ {{0x482cc0adc7fceULL, 0x1ae9d0e2f0143ULL, 0x530469c3cc006ULL, 0x47c06d3eb9c6fULL, 0x0e5f7b8000524ULL}}},
+{{{0x2817b94e68325ULL, 0x47920a1d5d236ULL, 0x064962364b5a2ULL, 0x08acb90b0b095ULL, 0x0ea2c846a535aULL}} ,
+ {{0x71b5a8b0d031bULL, 0x3e7a622de4972ULL, 0x6f860e94280ccULL, 0x08ddd60bb5089ULL, 0x3b82a8337b05fULL}}},
+{{{0x4eaa96d7b36baULL, 0x740123f58a242ULL, 0x3a4095b32666eULL, 0x4624633201350ULL, 0x2003e7683385fULL}} ,
+ {{0x1f1b2a9ff5b50ULL, 0x795348299ef1eULL, 0x0359552511827ULL, 0x2cbf110b92fceULL, 0x795f4ace812daULL}}},
+{{{0x77dbcd25c5f3dULL, 0x088a44da541ceULL, 0x71a9b1b77101aULL, 0x748c3b6d6a4ebULL, 0x561d2c1d673a0ULL}} ,
+ {{0x5d2d4cf747afeULL, 0x46e1b7a1bc33cULL, 0x733b3b1b799a4ULL, 0x135ee3bb51984ULL, 0x2dac09925d762ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2dbd3eb171523ULL, 0x595723e002bc2ULL, 0x52c6fb6b33904ULL, 0x344b30bedde16ULL, 0x140b6f1e4bad4ULL}} ,
+ {{0x02d77b6bfce11ULL, 0x14bb469e30449ULL, 0x35d50f849c2c1ULL, 0x7a9ee1395876cULL, 0x444eb3598ccafULL}}},
+{{{0x1b2660f617607ULL, 0x508bd980fc724ULL, 0x4d510c8a68608ULL, 0x665aa2f30af09ULL, 0x0a9fcf41f6ef7ULL}} ,
+ {{0x2e6c384daf9ddULL, 0x72bb2da4493f1ULL, 0x64d5b063161bcULL, 0x1d4691dbcdad5ULL, 0x732fb4faed167ULL}}},
+{{{0x55092e595b18bULL, 0x489be958ec226ULL, 0x4b3fbaf98cb0cULL, 0x23ae22b78e243ULL, 0x133a5a85567a2ULL}} ,
+ {{0x6584a3cac160dULL, 0x2546d8fe8c750ULL, 0x3a6725b90ddb9ULL, 0x4fdf233a0b32eULL, 0x7cd564f6050c7ULL}}},
+{{{0x7f27354e1c128ULL, 0x48363232e8ed7ULL, 0x7cdcd951aa2e7ULL, 0x4e32dba14cdbbULL, 0x0fb3f87c2c6c8ULL}} ,
+ {{0x5b85d74e9d5f7ULL, 0x0b0978616a2c4ULL, 0x6f0a04b2ab7c3ULL, 0x7f1f3417d6a4eULL, 0x1034d42c15a2bULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x5310eba46b161ULL, 0x4fb3acfed8cf4ULL, 0x5b32051e43e14ULL, 0x41e9ace2daf97ULL, 0x7b6a556577863ULL}} ,
+ {{0x31b60663ab0d3ULL, 0x1e1332b04de28ULL, 0x76e15c4528cb6ULL, 0x1cd30ea937b76ULL, 0x0cb7acea0eac7ULL}}},
+{{{0x7100e17e5f45eULL, 0x58b8cebe87cf3ULL, 0x2ff490453952eULL, 0x0e338d80a7aa4ULL, 0x5ad25870b2c16ULL}} ,
+ {{0x494920716ba2dULL, 0x04ff9256a17bbULL, 0x50fe3b586e801ULL, 0x05930207cfaf6ULL, 0x65c775edcb82bULL}}},
+{{{0x1a740090dba80ULL, 0x7cccfc68cf4c7ULL, 0x11b11e14fed5aULL, 0x4673fb63476f4ULL, 0x535864a2ce9feULL}} ,
+ {{0x1597bc2a9c1e8ULL, 0x5856e687c4664ULL, 0x78854ee2704b6ULL, 0x337fec54be06aULL, 0x0988c3b9b7333ULL}}},
+{{{0x3ae5c3056b6d0ULL, 0x5ca3074888eb6ULL, 0x799d917bd9405ULL, 0x41d8b6a06d17aULL, 0x3f18362ff22f5ULL}} ,
+ {{0x58c1e9be02ffdULL, 0x6a57a99552318ULL, 0x3edfa7c2a56d8ULL, 0x62191bdc477e2ULL, 0x5cfc7a0f0d2feULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2d644c7dad28dULL, 0x43703afa4db6fULL, 0x1f85df5ea777bULL, 0x73e16c6821b8eULL, 0x1bc7af1e38185ULL}} ,
+ {{0x2f65900314833ULL, 0x24c6364e1f95eULL, 0x57701247409f8ULL, 0x797bd2f77c3bcULL, 0x61d909d855661ULL}}},
+{{{0x1938218028354ULL, 0x6bb1b54fa00f3ULL, 0x6e28f67cbea25ULL, 0x4b5e9141aad35ULL, 0x06bce245f8c25ULL}} ,
+ {{0x4955188a3c065ULL, 0x161bd0f1292dfULL, 0x1d521630b2506ULL, 0x6d06495669788ULL, 0x3d26989cdd0f6ULL}}},
+{{{0x589041b29662fULL, 0x1d6fbadddcfd7ULL, 0x1fff2d032c3bcULL, 0x2f7b21e1d64e1ULL, 0x7665908aaf444ULL}} ,
+ {{0x3a00e4b704ca1ULL, 0x71715f4826e10ULL, 0x40ad025948864ULL, 0x2a3670bfc0327ULL, 0x4ed18a7c50da4ULL}}},
+{{{0x5954e6c16d4f7ULL, 0x7ca457221ebb3ULL, 0x69398c394d173ULL, 0x554841a79f99dULL, 0x0a09b36eb5a04ULL}} ,
+ {{0x2eb0fa35ed926ULL, 0x49a86e7641e74ULL, 0x3b54cf41b3a7bULL, 0x085125b7595d7ULL, 0x3aa47fd60fa31ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x6b2d6fc2c9fdbULL, 0x5b0e0cf4a45c3ULL, 0x1de41b4adca18ULL, 0x6b07c3d5aa1a3ULL, 0x079e9d5b60917ULL}} ,
+ {{0x1381c04c78797ULL, 0x79470b8eb0720ULL, 0x2fe8895900193ULL, 0x5229893654a28ULL, 0x16512951d2240ULL}}},
+{{{0x4577198d74a4dULL, 0x7ec77a6f16fb5ULL, 0x5f0825526c61fULL, 0x7ce48e22cbe67ULL, 0x469d0960dbd0eULL}} ,
+ {{0x345e4909478cbULL, 0x2ae8afedb3ed6ULL, 0x2f724e53e0fe3ULL, 0x1120f90abe144ULL, 0x0b5f21c7f8683ULL}}},
+{{{0x7b65ffc68362aULL, 0x005e493bc74a9ULL, 0x7b42be33d864fULL, 0x10a077613edf0ULL, 0x164162a18e5f3ULL}} ,
+ {{0x65b95ce012195ULL, 0x516ac5738eae1ULL, 0x4191ad3b04728ULL, 0x73eb37dff9339ULL, 0x082afd56b25feULL}}},
+{{{0x4ffa156776792ULL, 0x1475c7e12b8b8ULL, 0x4f5fa79365328ULL, 0x05267585b375cULL, 0x5911ade999893ULL}} ,
+ {{0x75f6fa19548f6ULL, 0x24380061774b6ULL, 0x6c86c98975a2bULL, 0x74efa02b51b86ULL, 0x063ad2432a173ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x3729ad1939932ULL, 0x3a99697a2d53eULL, 0x74e6992cb53e7ULL, 0x7658e39d1f202ULL, 0x10b304ff67577ULL}} ,
+ {{0x16dd0ada44bb9ULL, 0x5552695f6846cULL, 0x6178da767b196ULL, 0x0a0cdd873e666ULL, 0x13b7faa0f91ccULL}}},
+{{{0x1d00c3c88fd04ULL, 0x18320c9ea2a41ULL, 0x0cf16037aef0fULL, 0x36e9b0bf9fcdeULL, 0x1b795d9be8decULL}} ,
+ {{0x0ad5751be0a65ULL, 0x2a0f36e210f2aULL, 0x6e8e12ebbee3eULL, 0x0600f431529e7ULL, 0x6c87f61b675c5ULL}}},
+{{{0x2ed5566b2004fULL, 0x6430cdc31bda9ULL, 0x4d86bf635d052ULL, 0x5f9c4c5ae1307ULL, 0x70fd6724f3f2aULL}} ,
+ {{0x7ca3ac12a4efdULL, 0x5ecee9d9b0011ULL, 0x3d25b40a38187ULL, 0x56e77f1c0ef24ULL, 0x65a655b6f37daULL}}},
+{{{0x0319170c5cbebULL, 0x45dfa1901b262ULL, 0x4f5a78e09bfa1ULL, 0x61a937098bfc8ULL, 0x5e9ac4ab2f4a3ULL}} ,
+ {{0x6c32be5b51babULL, 0x1fcce7a160521ULL, 0x3879392f3c991ULL, 0x1e65e9799a94dULL, 0x505f00fa8aee0ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x4b53d220ddbf6ULL, 0x73c503e062ea2ULL, 0x6684612a688deULL, 0x054bc44a9da83ULL, 0x2e5c4ef1a1273ULL}} ,
+ {{0x3dc4dfb54008bULL, 0x196ffe806a2f9ULL, 0x13a653b912bfaULL, 0x1cb2e2eaa3a54ULL, 0x5c1731365512aULL}}},
+{{{0x7f2867bef24ceULL, 0x710efab9d0ee1ULL, 0x1ca33cabfbcb4ULL, 0x0b725aadb7597ULL, 0x4c6c9a0e8a4efULL}} ,
+ {{0x74fd1c286ea25ULL, 0x02cd1ab9507d6ULL, 0x2e4153317b496ULL, 0x44139df386b6cULL, 0x26d5711ee5a1eULL}}},
+{{{0x5224fa7c36d4eULL, 0x6fee2cfd444c8ULL, 0x1c4a8061b718fULL, 0x798676199ae1cULL, 0x728a71912cf9fULL}} ,
+ {{0x123d52809448cULL, 0x358c8b09e71f9ULL, 0x64d5f1f4bfd7aULL, 0x507b16eb4e0d1ULL, 0x4ce95d59305cdULL}}},
+{{{0x4d77227507e92ULL, 0x086b032cd3ac1ULL, 0x18aa9b22cd652ULL, 0x1b6798a8e3743ULL, 0x599ba21b65ffbULL}} ,
+ {{0x250c48865a9e2ULL, 0x0288bedc7777fULL, 0x737db77525f28ULL, 0x615b3cbf29f9fULL, 0x07f59b350f668ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x15adbd82759f1ULL, 0x39fe71e704bc2ULL, 0x4fd5190fffbb4ULL, 0x2b2f7f6c0e8bfULL, 0x11cd80e1fdcbcULL}} ,
+ {{0x1ffe62822dbe0ULL, 0x4c765a28833acULL, 0x7a604d3c77c88ULL, 0x7d345cc07f722ULL, 0x43f11943f7ef3ULL}}},
+{{{0x0de50a100f3eeULL, 0x1a7919c6036d8ULL, 0x3b73562c348c5ULL, 0x4d4c077bd2508ULL, 0x068c33d8f3321ULL}} ,
+ {{0x2d830ff4f7dcbULL, 0x19f20c3872762ULL, 0x6505ad5c4d4d1ULL, 0x6d26f08f76fb3ULL, 0x1032a93593881ULL}}},
+{{{0x2fc5c7bbcc3e9ULL, 0x7575ca5f93f36ULL, 0x56dbce192ac2cULL, 0x6a6f6326d49a5ULL, 0x4847babbf5a03ULL}} ,
+ {{0x3a2231f45bc60ULL, 0x1f332fccece07ULL, 0x39e68c19d51ddULL, 0x612289766eb33ULL, 0x7e6ffe114a422ULL}}},
+{{{0x46fa3f0b1c087ULL, 0x39dee41553261ULL, 0x139aa9cd596f9ULL, 0x397f41190df96ULL, 0x1eac17c83ec79ULL}} ,
+ {{0x6cc40e521ef7bULL, 0x78f52f7badb83ULL, 0x1b96895ea19d5ULL, 0x12d8d9e28f2beULL, 0x0419a160079a8ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2e38faba68896ULL, 0x55ce69fdf0927ULL, 0x15dd09903fac9ULL, 0x5aee74cea7b26ULL, 0x4ee45ad6672f7ULL}} ,
+ {{0x62555bdb3825cULL, 0x7b8c054926d5eULL, 0x3effd6caec571ULL, 0x363482080fc2bULL, 0x7041a7fe4facbULL}}},
+{{{0x723d42c9bfadbULL, 0x4c0ed8c71458cULL, 0x14f480f093d20ULL, 0x4a3b8b2f69410ULL, 0x3328bc121616aULL}} ,
+ {{0x333cdfafac039ULL, 0x232736ed2f8e8ULL, 0x5319c6317adcaULL, 0x65939f2fa7808ULL, 0x2bbf3f26c21b5ULL}}},
+{{{0x4cadf1d8ce686ULL, 0x64898675f1abfULL, 0x3e25cae75e399ULL, 0x61564905a2294ULL, 0x2f5bc511aa678ULL}} ,
+ {{0x39dd752860f17ULL, 0x68ca64eca2898ULL, 0x588dd1a6604deULL, 0x520394eb267f6ULL, 0x56fb2a760b4c7ULL}}},
+{{{0x76fc37c90a733ULL, 0x542ee4cf414a2ULL, 0x7077a0c518dfbULL, 0x0f9bd192096b8ULL, 0x3646a62ad82bdULL}} ,
+ {{0x3b8f97c6bccacULL, 0x671efba0b8111ULL, 0x4032a1b6883a9ULL, 0x4f474a6b9d6e3ULL, 0x24dd06031fdaaULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x52a980a61b29cULL, 0x16cb5953ddaf4ULL, 0x61772fb88782bULL, 0x29a2bd34e07acULL, 0x3c0c1e7beb87aULL}} ,
+ {{0x0b50d6384bd2fULL, 0x698d273c97e14ULL, 0x0bc65cffcd268ULL, 0x318c91622aa37ULL, 0x74e826b2f1347ULL}}},
+{{{0x44c0c6d90670aULL, 0x2abd4f7bcd819ULL, 0x688466d633631ULL, 0x29e0221d8a5ddULL, 0x53b1cdfe23ed5ULL}} ,
+ {{0x0af01f575fb05ULL, 0x685209f8b0e47ULL, 0x1b94022899de8ULL, 0x0725c6ab995e8ULL, 0x5ca6df45ad963ULL}}},
+{{{0x0dc7e901a880dULL, 0x5cceba5f83fdbULL, 0x50d55bfb4bd9fULL, 0x2e9a11a8a43afULL, 0x761a85d3d5ae7ULL}} ,
+ {{0x5b0e16ea0c887ULL, 0x79dae26894d55ULL, 0x17129940d1359ULL, 0x3581f927a822eULL, 0x20c5d2b28c5e1ULL}}},
+{{{0x041a037c28398ULL, 0x75917ebeb8915ULL, 0x7daf4b1678093ULL, 0x4026573443f40ULL, 0x0ba774bb605ddULL}} ,
+ {{0x37a77bf911321ULL, 0x3a14720fd3786ULL, 0x51fba684019f7ULL, 0x6e6fdad0a8db9ULL, 0x54ba013ad2d04ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2200b4a39d548ULL, 0x12bd040f4086dULL, 0x4ddf3c51f25f1ULL, 0x622a335f791dcULL, 0x6e6b14df76458ULL}} ,
+ {{0x7764c29cac942ULL, 0x3074f85b15b46ULL, 0x46ae6d6d00fc9ULL, 0x54eb5afef1689ULL, 0x30f3b35dc952bULL}}},
+{{{0x7620c6bfe6f4cULL, 0x730b63dee291aULL, 0x24c22c493b701ULL, 0x775c71c7bc73bULL, 0x496490af4080fULL}} ,
+ {{0x44498c1da884aULL, 0x257297b69ca67ULL, 0x5d7bc1023357cULL, 0x57d03f29d58f3ULL, 0x7f6410727b65cULL}}},
+{{{0x0fd16ebf0813dULL, 0x41f634f91a66bULL, 0x4ceee43ba28b0ULL, 0x0c2ccc774a2b6ULL, 0x46b5f1c51f08eULL}} ,
+ {{0x33fa04b43e7e4ULL, 0x4c7b5c2f740c5ULL, 0x445d3b6e2f73bULL, 0x77198ff4b761aULL, 0x20cb1dc94e7a0ULL}}},
+{{{0x496db7be967e0ULL, 0x2062b3a06560bULL, 0x4e026b25e4b72ULL, 0x3682eeb3f0798ULL, 0x075bf0ea1fb60ULL}} ,
+ {{0x2416bdec79f81ULL, 0x207ceece286a4ULL, 0x729321766c206ULL, 0x3d56b2c821fcdULL, 0x43ba373488c31ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x49581c869b64cULL, 0x0879d26924672ULL, 0x08a70dd68f436ULL, 0x6e15a6732d550ULL, 0x1074ff0267662ULL}} ,
+ {{0x1efc7e6d5b022ULL, 0x0168c1b4274f6ULL, 0x25dc041f50b06ULL, 0x7614491ed2682ULL, 0x299be0decb680ULL}}},
+{{{0x62b362a42fe33ULL, 0x039916b8c86c5ULL, 0x7a09e842055aaULL, 0x4ac79473c72abULL, 0x3e63c4ae42121ULL}} ,
+ {{0x680caa79c9678ULL, 0x3808f9630a055ULL, 0x7b6eb04996f05ULL, 0x4464642b82cd2ULL, 0x3599286aac87eULL}}},
+{{{0x287be2808049fULL, 0x1b3fbc705101bULL, 0x518bbed8b8f93ULL, 0x4ea28835980c6ULL, 0x1eade2fa113b1ULL}} ,
+ {{0x3ae0a699920a0ULL, 0x0b6f00c89ce14ULL, 0x1550d0d521e72ULL, 0x53254be46b6c0ULL, 0x6cc8d8212e6ccULL}}},
+{{{0x17508ad074a91ULL, 0x0cdf8765489f8ULL, 0x59ead4b3ac4f9ULL, 0x6ebb635a42a04ULL, 0x31ddffcb76711ULL}} ,
+ {{0x736f0fdfa8836ULL, 0x2ba0a110e80edULL, 0x5901cb92128e2ULL, 0x6938d00bb08cbULL, 0x221c9b9a258e4ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x6ac0f0ebd57beULL, 0x20575ae346ecbULL, 0x5775567b00914ULL, 0x659a612e62254ULL, 0x6b265507695b3ULL}} ,
+ {{0x32951a7d46b30ULL, 0x5f0454eaf5f3cULL, 0x75600ae647758ULL, 0x5fee54e8a8f33ULL, 0x3f7f093597aceULL}}},
+{{{0x667b80a340d35ULL, 0x44be33e64052aULL, 0x316a14dcd0a0fULL, 0x1deb25a198c81ULL, 0x25ed76d78c87cULL}} ,
+ {{0x41d0d76373947ULL, 0x331086dab5ea1ULL, 0x2cca83d4ad056ULL, 0x3d99359d31fd8ULL, 0x179b5f92f545cULL}}},
+{{{0x252fe15bd239dULL, 0x0d750cf24c2aaULL, 0x440ba32ed9958ULL, 0x26d290c256a88ULL, 0x358ce93ef0448ULL}} ,
+ {{0x14dc8ec41a0adULL, 0x0ab69d2cdda57ULL, 0x6fc333c6e830bULL, 0x2c80be0abb30bULL, 0x27eb24e1c2714ULL}}},
+{{{0x23bafa442b92cULL, 0x07d5e41f841c8ULL, 0x6f6c05c4e6abeULL, 0x30765b9718bc4ULL, 0x71880463417e7ULL}} ,
+ {{0x7dd5786387875ULL, 0x637ecae0a9dd3ULL, 0x6278c34e780b3ULL, 0x2ee21a7c9c77eULL, 0x7be598f9de5bdULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2b2df11653be7ULL, 0x3cb8de2528c7eULL, 0x162af62db05deULL, 0x1f3eeb9ca8ebdULL, 0x76db1d03f26feULL}} ,
+ {{0x41b522c4e06aeULL, 0x7a4f7d4ab4b57ULL, 0x499a05c5387aeULL, 0x0ef858c688183ULL, 0x24b91ba65c06fULL}}},
+{{{0x4480e138066c5ULL, 0x5ac16908630f1ULL, 0x4cc1716dbb317ULL, 0x6995b203e97afULL, 0x3d09f11b74381ULL}} ,
+ {{0x4f88dbc8269d4ULL, 0x30aa30aaea6c6ULL, 0x6ae009abde4f1ULL, 0x0ed65f8804acdULL, 0x45f4a22ff69fcULL}}},
+{{{0x59eed85ebbe17ULL, 0x68848a2feaad9ULL, 0x455d01531107eULL, 0x4921eb5630023ULL, 0x04d742b1580d0ULL}} ,
+ {{0x79b06c4a3bd8dULL, 0x0164e8c0b1203ULL, 0x2ee0b6b48f0ecULL, 0x05a54c934c808ULL, 0x4589a87ce3813ULL}}},
+{{{0x03c41cb05dc3fULL, 0x4732705808479ULL, 0x71ccb4fe555a3ULL, 0x66f2e8dea7d5fULL, 0x75d942c04210dULL}} ,
+ {{0x5c4874e35ab2dULL, 0x5a8f4848cf2ecULL, 0x45cc72fce38feULL, 0x09e47ebf162bbULL, 0x696cc14856cdcULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x0a57b885fae14ULL, 0x48bd176421bf2ULL, 0x6483f528f0c5cULL, 0x6bb56ad0c8d30ULL, 0x6d12e0dd1cd8bULL}} ,
+ {{0x4a3028f70bd8eULL, 0x6fb588ceb49a4ULL, 0x015e96e043c83ULL, 0x3c01505c1b392ULL, 0x0d5c9e4b74fdeULL}}},
+{{{0x3fba21f5fd594ULL, 0x5a41f0680fc3dULL, 0x60684b418c206ULL, 0x0d78588e79b4aULL, 0x16c1556c9a2bcULL}} ,
+ {{0x335745ef14f36ULL, 0x3d719e23ae502ULL, 0x5ced6e016ce4fULL, 0x7c48f0cd6f5f4ULL, 0x23e38cd5158b0ULL}}},
+{{{0x70fe618e77933ULL, 0x09554f402b26aULL, 0x57a55d0c13effULL, 0x5807222ada534ULL, 0x456bdf4c7423eULL}} ,
+ {{0x50b42c46c2997ULL, 0x2e6936b85381bULL, 0x1d18e01e71f42ULL, 0x43e15d81bc772ULL, 0x579782c36c68eULL}}},
+{{{0x3804bb683be22ULL, 0x3733debc4886dULL, 0x00cee3497f2a2ULL, 0x5bb4af39f15caULL, 0x66e632db15cc9ULL}} ,
+ {{0x2d6a6134af084ULL, 0x38fdec0e8d27fULL, 0x1239e9bd979b5ULL, 0x660c87ff50378ULL, 0x534e3c9c194ccULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2591507e3502aULL, 0x59a7e7e50317eULL, 0x333b19dc23265ULL, 0x3beaca2accf77ULL, 0x5d9324f569754ULL}} ,
+ {{0x7306bbe1b4f6aULL, 0x793af7c68ceb9ULL, 0x322d07d736337ULL, 0x102940d761271ULL, 0x10985a3cfd573ULL}}},
+{{{0x2c2d830f7dba3ULL, 0x01ca459da7c33ULL, 0x702ac7f93647aULL, 0x5cc9387430d38ULL, 0x3c08b09976fa5ULL}} ,
+ {{0x56a1b85d2932aULL, 0x7a67a3a3dd4cbULL, 0x110e8ddccd9aaULL, 0x041ef3d54f65aULL, 0x30a2ba28dfd74ULL}}},
+{{{0x39f3f056db5d3ULL, 0x799394f91a2beULL, 0x4d98ec251f22bULL, 0x4498fc8e8bc4dULL, 0x43a376de4357dULL}} ,
+ {{0x6323da9e2359bULL, 0x0bd2e0502d763ULL, 0x5f821fdc23cbdULL, 0x270fbdfbd6229ULL, 0x111b64acd86aaULL}}},
+{{{0x73e184647ebb2ULL, 0x4059e39819323ULL, 0x195f807823f9fULL, 0x05ce47de8065cULL, 0x27d83b6133989ULL}} ,
+ {{0x44b503a72bea0ULL, 0x498b27900356eULL, 0x7bb2ad1b0231fULL, 0x6e313276bc775ULL, 0x2aa089af71e21ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2a8dbdee40b98ULL, 0x10daa40ce905fULL, 0x1ab158bfe2948ULL, 0x3370fc62887a2ULL, 0x4676d3812cc6bULL}} ,
+ {{0x2a7802e7429f4ULL, 0x7f1dad7bed1e3ULL, 0x5fe83acaa5706ULL, 0x3d8828a285022ULL, 0x7d89e2b7744c5ULL}}},
+{{{0x309b7ada7ee07ULL, 0x43cb957e9c921ULL, 0x3cd9f56bf9b98ULL, 0x02d3dc9be3f67ULL, 0x7511066c0e121ULL}} ,
+ {{0x6a33ba386fcd5ULL, 0x626dee17f6147ULL, 0x29c02ddc3696eULL, 0x65e544247c46dULL, 0x604df365b8391ULL}}},
+{{{0x1bea2f4319d96ULL, 0x0f753cb34b730ULL, 0x717af6161d2f8ULL, 0x1e7577a689ecfULL, 0x4d892ac74fdf5ULL}} ,
+ {{0x70ee9aaf2d829ULL, 0x12b7153abe5deULL, 0x43fd0889327b4ULL, 0x21a37420e4792ULL, 0x045d86b3ea6c1ULL}}},
+{{{0x1d26ae8619807ULL, 0x0e30b7aa4a930ULL, 0x2b51a914548d7ULL, 0x5c88c2fe4868cULL, 0x668d5960c0b43ULL}} ,
+ {{0x6246e53791b03ULL, 0x110a12b1b2af5ULL, 0x045378ad74e89ULL, 0x058f49e437341ULL, 0x7a66f757c2190ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x522d70389e30fULL, 0x5b3d1b69953f2ULL, 0x41d648637fe5dULL, 0x3227c2f1681f7ULL, 0x5089c58085e74ULL}} ,
+ {{0x186248653d88bULL, 0x1d8641f402a45ULL, 0x250d1eeb72e55ULL, 0x020cb7d3d5b98ULL, 0x50cab959cb2b6ULL}}},
+{{{0x21b23789b5bc2ULL, 0x313614bf29107ULL, 0x3ffd8454db8aeULL, 0x0400166213ee3ULL, 0x0761affb1e0d4ULL}} ,
+ {{0x6a170812fe6b0ULL, 0x0e5988f808725ULL, 0x6b25da56d2916ULL, 0x29dbe21081636ULL, 0x3a6d110e60701ULL}}},
+{{{0x505db5e80189bULL, 0x1a8184796f8d7ULL, 0x454d22a5f3975ULL, 0x61bf8082e9455ULL, 0x0d331ffa16cc0ULL}} ,
+ {{0x41a59aa35f919ULL, 0x2e16d5f80cb81ULL, 0x56a94abf0d94eULL, 0x69cd791f7984dULL, 0x0b4857756b9a5ULL}}},
+{{{0x4f9fc3b76dc26ULL, 0x5ea6c417127f3ULL, 0x719aaf0b8060eULL, 0x27306953a8681ULL, 0x2596e5b3cf549ULL}} ,
+ {{0x78a3174b182feULL, 0x41e91b7aacdf4ULL, 0x168b379654653ULL, 0x049c42535c27aULL, 0x68a0a7ac9a0ccULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x04723c7d60d25ULL, 0x0f0eb8118f5a2ULL, 0x2734ee062624eULL, 0x4fc3ae29ead56ULL, 0x249651cc14324ULL}} ,
+ {{0x00437f05d9c65ULL, 0x494be054d269eULL, 0x040556caf7b29ULL, 0x358626e8355e9ULL, 0x028fdf17c15bbULL}}},
+{{{0x4315cbf3d59bdULL, 0x08c0092864588ULL, 0x7263ed802b43eULL, 0x00724d12e660eULL, 0x0555439a08915ULL}} ,
+ {{0x1129bdf55935dULL, 0x4d3c850b27d83ULL, 0x49abe66be743dULL, 0x5e77ffeb0de44ULL, 0x5835c99533f44ULL}}},
+{{{0x744cbdaf95512ULL, 0x4d35f3c4afb94ULL, 0x4e69d51808c1fULL, 0x5d5372b424dd2ULL, 0x67af872cb08f8ULL}} ,
+ {{0x2f812b24ca900ULL, 0x64929600f5506ULL, 0x1123911747ee8ULL, 0x3841cfd88ee3dULL, 0x0e934212a5875ULL}}},
+{{{0x2d05972aeb417ULL, 0x6622c7162d515ULL, 0x2dea03368110eULL, 0x6d7f3aa276eb4ULL, 0x0dec3676055d5ULL}} ,
+ {{0x7553832827c6dULL, 0x778986fab6e8aULL, 0x151544fc0a41bULL, 0x4cc4fa66e53e3ULL, 0x48fa8dc3a8204ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x3d525e99d4787ULL, 0x0b4f0bbef08fcULL, 0x469e57d31e97aULL, 0x6ce5014595179ULL, 0x28bd38d44030dULL}} ,
+ {{0x41d6d78d5bbfcULL, 0x748889556933aULL, 0x2e666d3fb606dULL, 0x1b99d69e273e6ULL, 0x552dd7405c418ULL}}},
+{{{0x7dce55f7be126ULL, 0x44884d4f42fa7ULL, 0x6d7c5f63f008cULL, 0x7baea0cbda388ULL, 0x0ec8fe27a51e6ULL}} ,
+ {{0x52cefab3d11d3ULL, 0x570264f87b63dULL, 0x701ecf073e3f9ULL, 0x53fbb3adc6fb0ULL, 0x3de83daf93d8aULL}}},
+{{{0x27eb68d4e5bfdULL, 0x22d2099ddf370ULL, 0x6d54a83bffd49ULL, 0x66b6f17af0bbcULL, 0x190bb443a02d3ULL}} ,
+ {{0x6f417484861c0ULL, 0x645fd45aa2313ULL, 0x22edc528f83cbULL, 0x0aee0c0fa981dULL, 0x5a601f5562397ULL}}},
+{{{0x5db6c768a89e5ULL, 0x5cb33ae4b6149ULL, 0x3eb8df0618d8dULL, 0x3d2fa46d0edf1ULL, 0x393fb3d0b216dULL}} ,
+ {{0x776f56c0960ceULL, 0x298f2c7500482ULL, 0x016d7bdafdcbaULL, 0x2ed28bde9f7cbULL, 0x4e2107bc67440ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2deb9216f73e9ULL, 0x4620632fd6fa4ULL, 0x63facdf1b87aaULL, 0x7073220ef2c21ULL, 0x1edff13d99073ULL}} ,
+ {{0x20617c243adf8ULL, 0x2e319b0d53c9cULL, 0x0274999d321e3ULL, 0x131536578d28cULL, 0x2e42eb00cbc19ULL}}},
+{{{0x538cf4c24347bULL, 0x1644580214d9cULL, 0x065f892b4e090ULL, 0x09afa18fcb678ULL, 0x59233a3346f61ULL}} ,
+ {{0x1ad1908a10b20ULL, 0x6c12467dd4a87ULL, 0x273f136f34b8aULL, 0x15c9f910b09f8ULL, 0x3cce55908611dULL}}},
+{{{0x43799624b0bc4ULL, 0x459df344e87f0ULL, 0x78e8cf4a83c2fULL, 0x7d2e649cead6dULL, 0x686ce61d9182eULL}} ,
+ {{0x2c88b9b1764a3ULL, 0x77db8d3bccc27ULL, 0x6ccea7499480dULL, 0x68d167ec56609ULL, 0x0e5755d013ed1ULL}}},
+{{{0x63c4afdbfea1aULL, 0x24eeeefc53d91ULL, 0x5fd57e6135e64ULL, 0x6d1cae95a45f8ULL, 0x4b82eba78af08ULL}} ,
+ {{0x2def63af4282cULL, 0x7ff0468883c01ULL, 0x131570e7d900cULL, 0x7ae920e4a60e3ULL, 0x1437579645925ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x076b96690cdc1ULL, 0x7246eb0b4ab74ULL, 0x6c5beca0a9627ULL, 0x6ad0c37b4e275ULL, 0x1a2cd99d3d94eULL}} ,
+ {{0x7b70673e6b035ULL, 0x25d04561f1c06ULL, 0x56b1b9bbc2fb7ULL, 0x24b824f8d4f4cULL, 0x4044babe0b4deULL}}},
+{{{0x31f5f919656c1ULL, 0x64151310dea97ULL, 0x3ba09a909075aULL, 0x387b2983b550aULL, 0x24497c51a6396ULL}} ,
+ {{0x50f11d178a335ULL, 0x2241b68ce1a6eULL, 0x1d04152024b2dULL, 0x40451ebd4c31bULL, 0x3b80f82901f17ULL}}},
+{{{0x4a0bf9d9da7dbULL, 0x72334544a7db9ULL, 0x34560dc660d20ULL, 0x461457ba01402ULL, 0x4c53cf42a5b70ULL}} ,
+ {{0x7ddad8ef6bba7ULL, 0x5d1326bfbb21eULL, 0x3a2de6b98dc12ULL, 0x5625f950b6fe0ULL, 0x5a7289d5413c3ULL}}},
+{{{0x1132c34ff961fULL, 0x677d0b1215964ULL, 0x2be5f787a79c2ULL, 0x6a044a47b984bULL, 0x5830f025f1078ULL}} ,
+ {{0x717e25793d41eULL, 0x0406aa79573bcULL, 0x0c0795b6cacbeULL, 0x1fff337239217ULL, 0x67d451752c243ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x4e15da1d9062bULL, 0x538d34783da3eULL, 0x36301e04c4cacULL, 0x4e4d4cf168b8bULL, 0x19929124ab577ULL}} ,
+ {{0x175a69ca1fb69ULL, 0x088480e6c0fa9ULL, 0x41079e654284fULL, 0x4060f4dccca41ULL, 0x52c0cbef541feULL}}},
+{{{0x28737a1738914ULL, 0x345db23b9ef4dULL, 0x673c301d3b59cULL, 0x0bddf846fee99ULL, 0x0849c9e6da66dULL}} ,
+ {{0x60ab0555edde9ULL, 0x01a85cb49843bULL, 0x313c5ea495ceaULL, 0x1c96497d7a016ULL, 0x09f4dcbc5ae50ULL}}},
+{{{0x086057c2be1f3ULL, 0x7d1f695a95270ULL, 0x747bf37f43265ULL, 0x220899a34967fULL, 0x1e0990d03bcf6ULL}} ,
+ {{0x245e680d6459dULL, 0x0e68b9542be95ULL, 0x58a109a328a66ULL, 0x2f5296014db3eULL, 0x0ea9350f1881fULL}}},
+{{{0x7946d7c7220e7ULL, 0x65e3c6a888a4bULL, 0x24ab83d18dac2ULL, 0x6d8bcb74eb874ULL, 0x03dec05fa937aULL}} ,
+ {{0x4271cc6375515ULL, 0x0949949e28da3ULL, 0x56bf0e5189623ULL, 0x17ab48894ff72ULL, 0x15949f784d847ULL}}},
+{{{0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}},
+ {{0x0000000000001ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL, 0x0000000000000ULL}}},
+{{{0x2b00b57ffd3ecULL, 0x2a25c49ff1b96ULL, 0x5b50c25aef8dbULL, 0x43a5c16c826d1ULL, 0x6a0c8b194571eULL}} ,
+ {{0x32cad031c42b8ULL, 0x265331af591c0ULL, 0x79f52d4a40b18ULL, 0x39af641c5e667ULL, 0x5f85adb7749ccULL}}},
+{{{0x0694556e18478ULL, 0x7e5363709eb4dULL, 0x65b2edcc40ccfULL, 0x58d4c20f37312ULL, 0x3491b2f25603bULL}} ,
+ {{0x362a466f76c2cULL, 0x39a6cb756672dULL, 0x60372faa847e0ULL, 0x1f1f2bdfac3acULL, 0x0988beda393ebULL}}},
+{{{0x429dcf5a0f18bULL, 0x2000f58c0fc56ULL, 0x352ef51445e27ULL, 0x5123e3ebf7511ULL, 0x06951222e8f2eULL}} ,
+ {{0x6baf40ca47cdaULL, 0x6394b36b13c2dULL, 0x7891024d8a703ULL, 0x2f54c8ab1e8bfULL, 0x6f44c09d0ccf2ULL}}},
+{{{0x037f7cf4e861dULL, 0x7633f6251e4a2ULL, 0x7d78b2043b783ULL, 0x586cb6019d8baULL, 0x055f070d6c15fULL}} ,
+ {{0x2af2c97473e69ULL, 0x72375b06f0f8aULL, 0x36d1dbc08be08ULL, 0x42accc8f0d815ULL, 0x511144a03a99bULL}}}
+};
+
+#else
+
 /* d */
 static const fe25519 ge25519_ecd = {{0xA3, 0x78, 0x59, 0x13, 0xCA, 0x4D, 0xEB, 0x75, 0xAB, 0xD8, 0x41, 0x41, 0x4D, 0x0A, 0x70, 0x00,
 											0x98, 0xE8, 0x79, 0x77, 0x79, 0x40, 0xC7, 0x8C, 0x73, 0xFE, 0x6F, 0x2B, 0xEE, 0x6C, 0x03, 0x52}};
@@ -2182,6 +3343,8 @@ static const ge25519_aff ge25519_base_multiples_affine[425] = {
  {{0x69, 0x3e, 0x47, 0x97, 0x2c, 0xaf, 0x52, 0x7c, 0x78, 0x83, 0xad, 0x1b, 0x39, 0x82, 0x2f, 0x02, 0x6f, 0x47, 0xdb, 0x2a, 0xb0, 0xe1, 0x91, 0x99, 0x55, 0xb8, 0x99, 0x3a, 0xa0, 0x44, 0x11, 0x51}}}
 };
 
+#endif // ZT_C25519_RADIX51
+
 static inline void p1p1_to_p2(ge25519_p2 *r, const ge25519_p1p1 *p)
 {
 	fe25519_mul(&r->x, &p->x, &p->t);
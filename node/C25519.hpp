@@ -58,6 +58,21 @@ public:
 		return kp;
 	}
 
+	/**
+	 * Compute the public half of a key pair from a private key
+	 *
+	 * @param priv Private key
+	 * @return Key pair containing priv and its public key
+	 */
+	static inline Pair fromPrivate(const Private &priv)
+	{
+		Pair kp;
+		kp.priv = priv;
+		_calcPubDH(kp);
+		_calcPubED(kp);
+		return kp;
+	}
+
 	/**
 	 * Generate a key pair satisfying a condition
 	 *
@@ -208,6 +208,10 @@ public:
 					b.append((uint8_t)2);
 					b.append((uint16_t)rules[i].v.vlanId);
 					break;
+				case ZT_NETWORK_RULE_ACTION_PRIORITY:
+					b.append((uint8_t)1);
+					b.append((uint8_t)rules[i].v.qosBucket);
+					break;
 				case ZT_NETWORK_RULE_MATCH_VLAN_PCP:
 					b.append((uint8_t)1);
 					b.append((uint8_t)rules[i].v.vlanPcp);
@@ -317,6 +321,9 @@ public:
 				case ZT_NETWORK_RULE_MATCH_VLAN_ID:
 					rules[ruleCount].v.vlanId = b.template at<uint16_t>(p);
 					break;
+				case ZT_NETWORK_RULE_ACTION_PRIORITY:
+					rules[ruleCount].v.qosBucket = (uint8_t)b[p];
+					break;
 				case ZT_NETWORK_RULE_MATCH_VLAN_PCP:
 					rules[ruleCount].v.vlanPcp = (uint8_t)b[p];
 					break;
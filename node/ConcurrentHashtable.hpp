@@ -0,0 +1,385 @@
+/*
+ * ZeroTier One - Network Virtualization Everywhere
+ * Copyright (C) 2011-2019  ZeroTier, Inc.  https://www.zerotier.com/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * --
+ *
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial closed-source software that incorporates or links
+ * directly against ZeroTier software without disclosing the source code
+ * of your own application.
+ */
+
+#ifndef ZT_CONCURRENTHASHTABLE_HPP
+#define ZT_CONCURRENTHASHTABLE_HPP
+
+#include "Constants.hpp"
+#include "Mutex.hpp"
+#include "Epoch.hpp"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <new>
+
+#include <atomic>
+#include <vector>
+#include <utility>
+
+namespace ZeroTier {
+
+/**
+ * Read-mostly hash table with lock-free readers
+ *
+ * Lookups run inside an Epoch::Guard and take no locks. Writers serialize on
+ * an internal mutex. Each slot of the open addressed (linear probing) table
+ * caches its key's hash and points to an immutable entry, so a lookup is one
+ * probe of a slot array plus one dereference of the matching entry. Erased
+ * slots are left as tombstones until the next rehash. Replaced or erased
+ * entries and outgrown slot arrays are handed to the epoch domain and freed
+ * once no reader can still see them.
+ *
+ * Iteration is weakly consistent: it sees every entry present for the whole
+ * iteration and may or may not see entries added or erased meanwhile.
+ *
+ * K must have a hashCode() method or be an integer type, and V must be
+ * copyable. The epoch domain must outlive the table.
+ */
+template<typename K,typename V>
+class ConcurrentHashtable
+{
+private:
+	struct _Entry
+	{
+		_Entry(const K &k,const V &v) : k(k),v(v) {}
+		const K k;
+		const V v;
+	};
+
+	struct _Slot
+	{
+		std::atomic<uint64_t> h; // 0 if never used, otherwise key hash with low bit set
+		std::atomic<_Entry *> e; // NULL in never used and erased slots
+	};
+
+	struct _Table
+	{
+		unsigned long mask;
+		unsigned int shift;
+		unsigned long used; // slots with h != 0, only read or written by writers
+		_Slot s[1];
+	};
+
+public:
+	/**
+	 * @param e Epoch domain for readers and for reclaiming replaced entries
+	 * @param capacity Initial capacity in entries (default: 32)
+	 */
+	ConcurrentHashtable(Epoch &e,unsigned long capacity = 32) :
+		_e(e),
+		_t(_newTable(capacity)),
+		_s(0)
+	{
+	}
+
+	~ConcurrentHashtable()
+	{
+		_Table *const t = _t.load();
+		for(unsigned long i=0;i<=t->mask;++i)
+			delete t->s[i].e.load();
+		_freeTable(t);
+	}
+
+	/**
+	 * Look up a value without copying it
+	 *
+	 * The caller must hold a guard on this table's epoch domain. The
+	 * returned pointer remains valid until that guard is destroyed.
+	 *
+	 * @param k Key
+	 * @return Pointer to value or NULL if not found
+	 */
+	inline const V *get(const K &k) const
+	{
+		const _Entry *const e = _find(k);
+		return (e) ? &(e->v) : (const V *)0;
+	}
+
+	/**
+	 * @param k Key
+	 * @param v Value to fill with result
+	 * @return True if value was found and set (if false, v is not modified)
+	 */
+	inline bool get(const K &k,V &v) const
+	{
+		Epoch::Guard _g(_e);
+		const _Entry *const e = _find(k);
+		if (e) {
+			v = e->v;
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * @param k Key to check
+	 * @return True if key is present
+	 */
+	inline bool contains(const K &k) const
+	{
+		Epoch::Guard _g(_e);
+		return (_find(k) != (const _Entry *)0);
+	}
+
+	/**
+	 * Set a value, replacing any existing one
+	 *
+	 * @param k Key
+	 * @param v Value
+	 */
+	inline void set(const K &k,const V &v)
+	{
+		Mutex::Lock _l(_m);
+		_Slot *const s = _findOrAdd(k);
+		_Entry *const old = s->e.load();
+		s->e.store(new _Entry(k,v));
+		if (old)
+			_e.retire(old);
+		else ++_s;
+	}
+
+	/**
+	 * Set a value only if the key is not already present
+	 *
+	 * @param k Key
+	 * @param v Value to add if key is not present
+	 * @return Value now in table (v or the existing value)
+	 */
+	inline V setIfAbsent(const K &k,const V &v)
+	{
+		Mutex::Lock _l(_m);
+		_Slot *const s = _findOrAdd(k);
+		const _Entry *const old = s->e.load();
+		if (old)
+			return old->v;
+		s->e.store(new _Entry(k,v));
+		++_s;
+		return v;
+	}
+
+	/**
+	 * @param k Key
+	 * @return True if value was present
+	 */
+	inline bool erase(const K &k)
+	{
+		Mutex::Lock _l(_m);
+		const _Table *const t = _t.load();
+		const uint64_t h = _hash(k);
+		for(unsigned long i=_idx(t,h);;i=((i + 1) & t->mask)) {
+			_Slot &s = const_cast<_Slot &>(t->s[i]);
+			const uint64_t sh = s.h.load();
+			if (!sh)
+				return false;
+			if (sh == h) {
+				_Entry *const e = s.e.load();
+				if ((e)&&(e->k == k)) {
+					s.e.store((_Entry *)0);
+					_e.retire(e);
+					--_s;
+					return true;
+				}
+			}
+		}
+	}
+
+	/**
+	 * Apply a function or function object to all entries
+	 *
+	 * The function is called as f(key,value) inside a guard and may call
+	 * any method of this table, including those that modify it.
+	 *
+	 * @param f Function to apply
+	 * @tparam F Function or function object type
+	 */
+	template<typename F>
+	inline void each(F f) const
+	{
+		Epoch::Guard _g(_e);
+		const _Table *const t = _t.load();
+		for(unsigned long i=0;i<=t->mask;++i) {
+			const _Entry *const e = t->s[i].e.load();
+			if (e)
+				f(e->k,e->v);
+		}
+	}
+
+	/**
+	 * @return Vector of all entries (pairs of K,V)
+	 */
+	inline typename std::vector< std::pair<K,V> > entries() const
+	{
+		typename std::vector< std::pair<K,V> > ent;
+		ent.reserve(_s.load());
+		Epoch::Guard _g(_e);
+		const _Table *const t = _t.load();
+		for(unsigned long i=0;i<=t->mask;++i) {
+			const _Entry *const e = t->s[i].e.load();
+			if (e)
+				ent.push_back(std::pair<K,V>(e->k,e->v));
+		}
+		return ent;
+	}
+
+	/**
+	 * @return Number of entries
+	 */
+	inline unsigned long size() const { return _s.load(); }
+
+	/**
+	 * @return True if table is empty
+	 */
+	inline bool empty() const { return (_s.load() == 0); }
+
+	/**
+	 * @return Epoch domain used by this table
+	 */
+	inline Epoch &epoch() const { return _e; }
+
+private:
+	ConcurrentHashtable(const ConcurrentHashtable &ht) : _e(ht._e) {}
+	const ConcurrentHashtable &operator=(const ConcurrentHashtable &) { return *this; }
+
+	template<typename O>
+	static inline uint64_t _hc(const O &obj) { return (uint64_t)obj.hashCode(); }
+	static inline uint64_t _hc(const uint64_t i) { return i; }
+	static inline uint64_t _hc(const uint32_t i) { return (uint64_t)i; }
+	static inline uint64_t _hc(const uint16_t i) { return (uint64_t)i; }
+	static inline uint64_t _hc(const int i) { return (uint64_t)i; }
+
+	// Fibonacci hashing spreads sequential or low-entropy keys over the whole table
+	static inline uint64_t _hash(const K &k) { return ((_hc(k) * 0x9e3779b97f4a7c15ULL) | 1ULL); }
+	static inline unsigned long _idx(const _Table *t,const uint64_t h) { return (unsigned long)(h >> t->shift); }
+
+	inline const _Entry *_find(const K &k) const
+	{
+		const _Table *const t = _t.load();
+		const uint64_t h = _hash(k);
+		for(unsigned long i=_idx(t,h);;i=((i + 1) & t->mask)) {
+			const uint64_t sh = t->s[i].h.load();
+			if (!sh)
+				return (const _Entry *)0;
+			if (sh == h) {
+				const _Entry *const e = t->s[i].e.load();
+				if ((e)&&(e->k == k))
+					return e;
+			}
+		}
+	}
+
+	// Must be locked. Returns slot holding k or an empty slot claimed for k.
+	inline _Slot *_findOrAdd(const K &k)
+	{
+		_Table *t = _t.load();
+		const uint64_t h = _hash(k);
+		_Slot *tomb = (_Slot *)0;
+		unsigned long i = _idx(t,h);
+		for(;;i=((i + 1) & t->mask)) {
+			_Slot *const s = &(t->s[i]);
+			const uint64_t sh = s->h.load();
+			if (!sh)
+				break;
+			_Entry *const e = s->e.load();
+			if (!e) {
+				if (!tomb)
+					tomb = s;
+			} else if ((sh == h)&&(e->k == k)) {
+				return s;
+			}
+		}
+
+		if (tomb) {
+			// The entry pointer is NULL here and is only set by the caller, so readers
+			// matching the new hash against a stale entry (or vice versa) just move on.
+			tomb->h.store(h);
+			return tomb;
+		}
+
+		if (((t->used + 1) * 2) > (t->mask + 1)) {
+			t = _grow(t);
+			for(i=_idx(t,h);t->s[i].h.load();i=((i + 1) & t->mask)) {}
+		}
+		++t->used;
+		t->s[i].h.store(h);
+		return &(t->s[i]);
+	}
+
+	// Must be locked. Rehashes live entries into a new slot array and publishes it.
+	inline _Table *_grow(_Table *t)
+	{
+		_Table *const nt = _newTable((_s.load() + 1) * 2);
+		for(unsigned long i=0;i<=t->mask;++i) {
+			_Entry *const e = t->s[i].e.load();
+			if (e) {
+				const uint64_t h = t->s[i].h.load();
+				unsigned long j = _idx(nt,h);
+				while (nt->s[j].h.load())
+					j = (j + 1) & nt->mask;
+				nt->s[j].e.store(e);
+				nt->s[j].h.store(h);
+				++nt->used;
+			}
+		}
+		_t.store(nt);
+		_e.retire(reinterpret_cast<void *>(t),&_freeTable);
+		return nt;
+	}
+
+	// Capacity is rounded up to a power of two with at most half the slots in use
+	static inline _Table *_newTable(unsigned long capacity)
+	{
+		unsigned int bits = 4;
+		while ((1UL << bits) < (capacity * 2))
+			++bits;
+		const unsigned long n = 1UL << bits;
+		_Table *const t = reinterpret_cast<_Table *>(::malloc(sizeof(_Table) + (sizeof(_Slot) * (n - 1))));
+		if (!t)
+			throw ZT_EXCEPTION_OUT_OF_MEMORY;
+		t->mask = n - 1;
+		t->shift = 64 - bits;
+		t->used = 0;
+		for(unsigned long i=0;i<n;++i) {
+			new (&(t->s[i])) _Slot();
+			t->s[i].h.store(0);
+			t->s[i].e.store((_Entry *)0);
+		}
+		return t;
+	}
+
+	static void _freeTable(void *t)
+	{
+		::free(t);
+	}
+
+	Epoch &_e;
+	std::atomic<_Table *> _t;
+	std::atomic<unsigned long> _s;
+	Mutex _m;
+};
+
+} // namespace ZeroTier
+
+#endif
@@ -188,15 +188,40 @@
 #define ZT_MAX_PACKET_FRAGMENTS 7
 
 /**
- * Size of RX queue
+ * Maximum number of packets awaiting fragments or WHOIS in the RX queue
  */
-#define ZT_RX_QUEUE_SIZE 32
+#define ZT_RX_QUEUE_SIZE 256
 
 /**
- * Size of TX queue
+ * Maximum number of RX queue entries from any one physical source address
+ */
+#define ZT_RX_QUEUE_MAX_PER_SOURCE 32
+
+/**
+ * Maximum number of spare RX queue entries kept for reuse instead of being freed
+ */
+#define ZT_RX_QUEUE_FREE_LIST_SIZE 64
+
+/**
+ * Size of TX queue (per destination address or multicast group)
  */
 #define ZT_TX_QUEUE_SIZE 32
 
+/**
+ * Maximum number of packets in all TX queues combined
+ */
+#define ZT_TX_QUEUE_MAX_TOTAL 512
+
+/**
+ * Number of free packet buffers each thread keeps for reuse
+ */
+#define ZT_PACKET_POOL_THREAD_CACHE 32
+
+/**
+ * Number of free packet buffers kept in the shared pool behind the per-thread caches
+ */
+#define ZT_PACKET_POOL_SHARED 256
+
 /**
  * Length of secret key in bytes -- 256-bit -- do not change
  */
@@ -437,6 +462,14 @@
  */
 #define ZT_QOS_NUM_BUCKETS 9
 
+/**
+ * Number of hashed flow queues in each QoS bucket
+ *
+ * Flows inside a bucket are scheduled fairly against each other (FQ-CoDel),
+ * so a bulk flow doesn't add latency to a sparse one sharing its bucket.
+ */
+#define ZT_QOS_FLOWS_PER_BUCKET 64
+
 /**
  * All unspecified traffic is put in this bucket. Anything in a bucket with a smaller
  * value is de-prioritized. Anything in a bucket with a higher value is prioritized over
@@ -474,6 +507,11 @@
  */
 #define ZT_PEER_PATH_EXPIRATION ((ZT_PEER_PING_PERIOD * 4) + 3000)
 
+/**
+ * Number of independently locked shards in Topology's path registry (must be a power of two)
+ */
+#define ZT_TOPOLOGY_PATH_SHARDS 16
+
 /**
  * How often to retry expired paths that we're still remembering
  */
@@ -0,0 +1,259 @@
+/*
+ * ZeroTier One - Network Virtualization Everywhere
+ * Copyright (C) 2011-2019  ZeroTier, Inc.  https://www.zerotier.com/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * --
+ *
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial closed-source software that incorporates or links
+ * directly against ZeroTier software without disclosing the source code
+ * of your own application.
+ */
+
+#ifndef ZT_EPOCH_HPP
+#define ZT_EPOCH_HPP
+
+#include "Constants.hpp"
+#include "Mutex.hpp"
+
+#include <stdint.h>
+#include <assert.h>
+
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <vector>
+
+/**
+ * Number of reader slots per epoch domain (guards beyond this share a locked overflow slot)
+ */
+#define ZT_EPOCH_READER_SLOTS 64
+
+/**
+ * Maximum guards one thread may have open at once, across all epoch domains
+ */
+#define ZT_EPOCH_MAX_NESTING 8
+
+/**
+ * Retired objects are reclaimed opportunistically once this many are waiting
+ */
+#define ZT_EPOCH_RECLAIM_THRESHOLD 64
+
+namespace ZeroTier {
+
+/**
+ * Epoch-based deferred reclamation for read-mostly shared structures
+ *
+ * Readers enter a critical section by creating a Guard, which announces the
+ * current epoch in one of a fixed set of reader slots. Writers unlink objects
+ * (under whatever lock they use among themselves) and pass them to retire(),
+ * which stamps them with a new epoch. A retired object is deleted only after
+ * every slot is either idle or announces an epoch at least as new as its stamp,
+ * so a reader never sees memory freed out from under it.
+ *
+ * Readers never block and write nothing shared except their own slot. Guards
+ * may be nested (up to ZT_EPOCH_MAX_NESTING deep) and used by any number of
+ * threads: a thread starts at a slot chosen from its ID and probes onward if
+ * that one is in use. If every slot is taken the guard joins a shared overflow
+ * slot under a mutex instead, so more threads than slots only costs a lock.
+ * Guards should be short lived since an open guard holds back all reclamation.
+ */
+class Epoch
+{
+public:
+	/**
+	 * Read-side critical section, valid until destroyed
+	 */
+	class Guard
+	{
+	public:
+		Guard(const Epoch &e) : _e(const_cast<Epoch *>(&e)),_s(_e->_enter()) {}
+		~Guard() { _e->_leave(_s); }
+
+	private:
+		Guard(const Guard &g) : _e(g._e),_s(g._s) {}
+		const Guard &operator=(const Guard &) { return *this; }
+
+		Epoch *const _e;
+		std::atomic<uint64_t> *const _s;
+	};
+
+	Epoch() :
+		_overflowReaders(0),
+		_epoch(1)
+	{
+		for(unsigned int i=0;i<ZT_EPOCH_READER_SLOTS;++i)
+			_slots[i].e.store(0);
+		_overflow.e.store(0);
+	}
+
+	/**
+	 * Delete everything still waiting; there must be no guards left open
+	 */
+	~Epoch()
+	{
+		for(std::vector<_Retired>::iterator r(_retired.begin());r!=_retired.end();++r)
+			r->del(r->obj);
+	}
+
+	/**
+	 * Delete an unlinked object once no reader can still be using it
+	 *
+	 * @param obj Object allocated with new, already unreachable by new readers
+	 * @tparam T Object type (generally inferred)
+	 */
+	template<typename T>
+	inline void retire(T *obj) { retire(reinterpret_cast<void *>(obj),&_delete<T>); }
+
+	/**
+	 * Release an unlinked object once no reader can still be using it
+	 *
+	 * @param obj Object, already unreachable by new readers
+	 * @param del Function to call to release it
+	 */
+	inline void retire(void *obj,void (*del)(void *))
+	{
+		bool r;
+		{
+			Mutex::Lock _l(_retired_m);
+			_retired.push_back(_Retired(obj,del,_epoch.fetch_add(1) + 1));
+			r = (_retired.size() >= ZT_EPOCH_RECLAIM_THRESHOLD);
+		}
+		if (r)
+			reclaim();
+	}
+
+	/**
+	 * Delete retired objects that are no longer visible to any reader
+	 *
+	 * This is called by retire() once enough objects are waiting and should
+	 * also be called periodically so stragglers are eventually freed.
+	 */
+	inline void reclaim()
+	{
+		std::vector<_Retired> dead;
+		{
+			Mutex::Lock _l(_retired_m);
+			if (_retired.empty())
+				return;
+			uint64_t oldest = _epoch.load();
+			for(unsigned int i=0;i<ZT_EPOCH_READER_SLOTS;++i) {
+				const uint64_t e = _slots[i].e.load();
+				if ((e)&&(e < oldest))
+					oldest = e;
+			}
+			const uint64_t oe = _overflow.e.load();
+			if ((oe)&&(oe < oldest))
+				oldest = oe;
+			std::vector<_Retired>::iterator w(_retired.begin());
+			for(std::vector<_Retired>::iterator r(_retired.begin());r!=_retired.end();++r) {
+				if (r->epoch <= oldest)
+					dead.push_back(*r);
+				else *(w++) = *r;
+			}
+			_retired.erase(w,_retired.end());
+		}
+		for(std::vector<_Retired>::iterator r(dead.begin());r!=dead.end();++r)
+			r->del(r->obj);
+	}
+
+	/**
+	 * @return Number of retired objects not yet deleted
+	 */
+	inline unsigned long pending() const
+	{
+		Mutex::Lock _l(_retired_m);
+		return (unsigned long)_retired.size();
+	}
+
+private:
+	Epoch(const Epoch &) {}
+	const Epoch &operator=(const Epoch &) { return *this; }
+
+	struct _Retired
+	{
+		_Retired(void *o,void (*d)(void *),uint64_t e) : obj(o),del(d),epoch(e) {}
+		void *obj;
+		void (*del)(void *);
+		uint64_t epoch;
+	};
+
+	// Each slot gets its own cache line so readers on different cores don't contend
+	struct _Slot
+	{
+		std::atomic<uint64_t> e;
+		uint8_t pad[64 - sizeof(std::atomic<uint64_t>)];
+	};
+
+	template<typename T>
+	static void _delete(void *obj) { delete reinterpret_cast<T *>(obj); }
+
+	static inline unsigned int &_depth()
+	{
+		static thread_local unsigned int d = 0;
+		return d;
+	}
+
+	inline std::atomic<uint64_t> *_enter()
+	{
+		assert(_depth() < ZT_EPOCH_MAX_NESTING);
+		++_depth();
+
+		// Announcing the epoch must be ordered before any of the reader's loads
+		// of shared pointers, and retire() must bump the epoch after unlinking,
+		// so everything here is sequentially consistent.
+		static thread_local unsigned int hint = (unsigned int)std::hash<std::thread::id>()(std::this_thread::get_id());
+		const uint64_t e = _epoch.load();
+		for(unsigned int i=0;i<ZT_EPOCH_READER_SLOTS;++i) {
+			std::atomic<uint64_t> *const s = &(_slots[(hint + i) % ZT_EPOCH_READER_SLOTS].e);
+			uint64_t idle = 0;
+			if (s->compare_exchange_strong(idle,e))
+				return s;
+		}
+
+		// All slots busy: share the overflow slot, which holds the epoch of its
+		// oldest reader until the last one leaves.
+		Mutex::Lock _l(_overflow_m);
+		if (_overflowReaders++ == 0)
+			_overflow.e.store(e);
+		return &(_overflow.e);
+	}
+
+	inline void _leave(std::atomic<uint64_t> *const s)
+	{
+		--_depth();
+		if (s == &(_overflow.e)) {
+			Mutex::Lock _l(_overflow_m);
+			if (--_overflowReaders == 0)
+				_overflow.e.store(0);
+		} else {
+			s->store(0);
+		}
+	}
+
+	_Slot _slots[ZT_EPOCH_READER_SLOTS];
+	_Slot _overflow;
+	unsigned long _overflowReaders; // guards sharing _overflow, guarded by _overflow_m
+	Mutex _overflow_m;
+	std::atomic<uint64_t> _epoch;
+	std::vector<_Retired> _retired;
+	Mutex _retired_m;
+};
+
+} // namespace ZeroTier
+
+#endif
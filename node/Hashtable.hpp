@@ -32,39 +32,70 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include <new>
 #include <stdexcept>
 #include <vector>
 #include <utility>
 #include <algorithm>
 
+#if (!defined(ZT_HASHTABLE_NO_SSE2)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define ZT_HASHTABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Control byte values: anything with the high bit clear is 7 bits of a present key's hash
+#define ZT_HASHTABLE_CTRL_EMPTY ((int8_t)-128)
+#define ZT_HASHTABLE_CTRL_DELETED ((int8_t)-2)
+#define ZT_HASHTABLE_CTRL_SENTINEL ((int8_t)-1)
+
+// Slots are probed in groups of this many (must be 16 for SSE2)
+#define ZT_HASHTABLE_GROUP_SIZE 16
+
 namespace ZeroTier {
 
 /**
  * A minimal hash table implementation for the ZeroTier core
+ *
+ * This is an open addressed table in the style of Abseil's "Swiss tables."
+ * Every slot has a control byte that is either empty, deleted, or 7 bits of
+ * the hash of the key stored there. Slots are probed in groups of 16 whose
+ * control bytes are checked all at once (with SSE2 where available), so a
+ * lookup usually reads one group of control bytes and compares only keys
+ * whose hash bits match. Keys and values live inline in one allocation,
+ * which is made on first insert, so there is no per-entry heap overhead
+ * and an unused table costs nothing.
+ *
+ * Adding a key may move entries, which invalidates pointers and references
+ * previously returned by get(), set(), or operator[]. Erasing never moves
+ * entries.
  */
 template<typename K,typename V>
 class Hashtable
 {
 private:
-	struct _Bucket
+	struct _Slot
 	{
-		_Bucket(const K &k,const V &v) : k(k),v(v) {}
-		_Bucket(const K &k) : k(k),v() {}
-		_Bucket(const _Bucket &b) : k(b.k),v(b.v) {}
-		inline _Bucket &operator=(const _Bucket &b) { k = b.k; v = b.v; return *this; }
+		_Slot(const K &k,const V &v) : k(k),v(v) {}
+		_Slot(const K &k) : k(k),v() {}
 		K k;
 		V v;
-		_Bucket *next; // must be set manually for each _Bucket
 	};
 
 public:
 	/**
 	 * A simple forward iterator (different from STL)
 	 *
-	 * It's safe to erase the last key, but not others. Don't use set() since that
-	 * may rehash and invalidate the iterator. Note the erasing the key will destroy
-	 * the targets of the pointers returned by next().
+	 * Erasing never moves other entries, so any key (including the one just
+	 * returned) may be erased while iterating. Inserting with set() or operator[]
+	 * can rehash and move everything, invalidating the iterator and all pointers
+	 * from next(). Note that erasing a key destroys the targets of the pointers
+	 * returned for it by next().
 	 */
 	class Iterator
 	{
@@ -74,8 +105,7 @@ public:
 		 */
 		Iterator(Hashtable &ht) :
 			_idx(0),
-			_ht(&ht),
-			_b(ht._t[0])
+			_ht(&ht)
 		{
 		}
 
@@ -86,78 +116,63 @@ public:
 		 */
 		inline bool next(K *&kptr,V *&vptr)
 		{
-			for(;;) {
-				if (_b) {
-					kptr = &(_b->k);
-					vptr = &(_b->v);
-					_b = _b->next;
+			while (_idx < _ht->_cap) {
+				const unsigned long i = _idx++;
+				if (_ht->_ctrl[i] >= 0) {
+					kptr = &(_ht->_slots[i].k);
+					vptr = &(_ht->_slots[i].v);
 					return true;
 				}
-				++_idx;
-				if (_idx >= _ht->_bc)
-					return false;
-				_b = _ht->_t[_idx];
 			}
+			return false;
 		}
 
 	private:
 		unsigned long _idx;
 		Hashtable *_ht;
-		_Bucket *_b;
 	};
 	//friend class Hashtable<K,V>::Iterator;
 
 	/**
-	 * @param bc Initial capacity in buckets (default: 64, must be nonzero)
+	 * @param bc Initial capacity in slots (default: 64, must be nonzero, storage isn't allocated until first insert)
 	 */
 	Hashtable(unsigned long bc = 64) :
-		_t(reinterpret_cast<_Bucket **>(::malloc(sizeof(_Bucket *) * bc))),
-		_bc(bc),
+		_ctrl((int8_t *)0),
+		_slots((_Slot *)0),
+		_cap(0),
+		_initialCap(_pow2(bc)),
+		_growthLeft(0),
 		_s(0)
 	{
-		if (!_t)
-			throw ZT_EXCEPTION_OUT_OF_MEMORY;
-		for(unsigned long i=0;i<bc;++i)
-			_t[i] = (_Bucket *)0;
 	}
 
 	Hashtable(const Hashtable<K,V> &ht) :
-		_t(reinterpret_cast<_Bucket **>(::malloc(sizeof(_Bucket *) * ht._bc))),
-		_bc(ht._bc),
-		_s(ht._s)
+		_ctrl((int8_t *)0),
+		_slots((_Slot *)0),
+		_cap(0),
+		_initialCap(ht._initialCap),
+		_growthLeft(0),
+		_s(0)
 	{
-		if (!_t)
-			throw ZT_EXCEPTION_OUT_OF_MEMORY;
-		for(unsigned long i=0;i<_bc;++i)
-			_t[i] = (_Bucket *)0;
-		for(unsigned long i=0;i<_bc;++i) {
-			const _Bucket *b = ht._t[i];
-			while (b) {
-				_Bucket *nb = new _Bucket(*b);
-				nb->next = _t[i];
-				_t[i] = nb;
-				b = b->next;
-			}
-		}
+		_copy(ht);
 	}
 
 	~Hashtable()
 	{
 		this->clear();
-		::free(_t);
+		::free(_ctrl);
 	}
 
 	inline Hashtable &operator=(const Hashtable<K,V> &ht)
 	{
-		this->clear();
-		if (ht._s) {
-			for(unsigned long i=0;i<ht._bc;++i) {
-				const _Bucket *b = ht._t[i];
-				while (b) {
-					this->set(b->k,b->v);
-					b = b->next;
-				}
-			}
+		if (this != &ht) {
+			this->clear();
+			::free(_ctrl);
+			_ctrl = (int8_t *)0;
+			_slots = (_Slot *)0;
+			_cap = 0;
+			_growthLeft = 0;
+			_copy(ht);
 		}
 		return *this;
 	}
@@ -168,17 +183,16 @@ public:
 	inline void clear()
 	{
 		if (_s) {
-			for(unsigned long i=0;i<_bc;++i) {
-				_Bucket *b = _t[i];
-				while (b) {
-					_Bucket *const nb = b->next;
-					delete b;
-					b = nb;
-				}
-				_t[i] = (_Bucket *)0;
+			for(unsigned long i=0;i<_cap;++i) {
+				if (_ctrl[i] >= 0)
+					_slots[i].~_Slot();
 			}
 			_s = 0;
 		}
+		if (_cap) {
+			memset(_ctrl,ZT_HASHTABLE_CTRL_EMPTY,_cap);
+			_growthLeft = _maxLoad(_cap);
+		}
 	}
 
 	/**
@@ -189,12 +203,9 @@ public:
 		typename std::vector<K> k;
 		if (_s) {
 			k.reserve(_s);
-			for(unsigned long i=0;i<_bc;++i) {
-				_Bucket *b = _t[i];
-				while (b) {
-					k.push_back(b->k);
-					b = b->next;
-				}
+			for(unsigned long i=0;i<_cap;++i) {
+				if (_ctrl[i] >= 0)
+					k.push_back(_slots[i].k);
 			}
 		}
 		return k;
@@ -210,12 +221,9 @@ public:
 	inline void appendKeys(C &v) const
 	{
 		if (_s) {
-			for(unsigned long i=0;i<_bc;++i) {
-				_Bucket *b = _t[i];
-				while (b) {
-					v.push_back(b->k);
-					b = b->next;
-				}
+			for(unsigned long i=0;i<_cap;++i) {
+				if (_ctrl[i] >= 0)
+					v.push_back(_slots[i].k);
 			}
 		}
 	}
@@ -228,12 +236,9 @@ public:
 		typename std::vector< std::pair<K,V> > k;
 		if (_s) {
 			k.reserve(_s);
-			for(unsigned long i=0;i<_bc;++i) {
-				_Bucket *b = _t[i];
-				while (b) {
-					k.push_back(std::pair<K,V>(b->k,b->v));
-					b = b->next;
-				}
+			for(unsigned long i=0;i<_cap;++i) {
+				if (_ctrl[i] >= 0)
+					k.push_back(std::pair<K,V>(_slots[i].k,_slots[i].v));
 			}
 		}
 		return k;
@@ -245,13 +250,8 @@ public:
 	 */
 	inline V *get(const K &k)
 	{
-		_Bucket *b = _t[_hc(k) % _bc];
-		while (b) {
-			if (b->k == k)
-				return &(b->v);
-			b = b->next;
-		}
-		return (V *)0;
+		const unsigned long i = _find(k,_hash(k));
+		return (i < _cap) ? &(_slots[i].v) : (V *)0;
 	}
 	inline const V *get(const K &k) const { return const_cast<Hashtable *>(this)->get(k); }
 
@@ -262,13 +262,10 @@ public:
 	 */
 	inline bool get(const K &k,V &v) const
 	{
-		_Bucket *b = _t[_hc(k) % _bc];
-		while (b) {
-			if (b->k == k) {
-				v = b->v;
-				return true;
-			}
-			b = b->next;
+		const unsigned long i = _find(k,_hash(k));
+		if (i < _cap) {
+			v = _slots[i].v;
+			return true;
 		}
 		return false;
 	}
@@ -279,13 +276,7 @@ public:
 	 */
 	inline bool contains(const K &k) const
 	{
-		_Bucket *b = _t[_hc(k) % _bc];
-		while (b) {
-			if (b->k == k)
-				return true;
-			b = b->next;
-		}
-		return false;
+		return (_find(k,_hash(k)) < _cap);
 	}
 
 	/**
@@ -294,20 +285,19 @@ public:
 	 */
 	inline bool erase(const K &k)
 	{
-		const unsigned long bidx = _hc(k) % _bc;
-		_Bucket *lastb = (_Bucket *)0;
-		_Bucket *b = _t[bidx];
-		while (b) {
-			if (b->k == k) {
-				if (lastb)
-					lastb->next = b->next;
-				else _t[bidx] = b->next;
-				delete b;
-				--_s;
-				return true;
+		const unsigned long i = _find(k,_hash(k));
+		if (i < _cap) {
+			_slots[i].~_Slot();
+			// If this slot's group still has an empty slot, no probe has ever continued past
+			// it, so this slot can go back to empty instead of leaving a tombstone.
+			if (_matchEmpty(_ctrl + (i & ~((unsigned long)ZT_HASHTABLE_GROUP_SIZE - 1)))) {
+				_ctrl[i] = ZT_HASHTABLE_CTRL_EMPTY;
+				++_growthLeft;
+			} else {
+				_ctrl[i] = ZT_HASHTABLE_CTRL_DELETED;
 			}
-			lastb = b;
-			b = b->next;
+			--_s;
+			return true;
 		}
 		return false;
 	}
@@ -319,28 +309,15 @@ public:
 	 */
 	inline V &set(const K &k,const V &v)
 	{
-		const unsigned long h = _hc(k);
-		unsigned long bidx = h % _bc;
-
-		_Bucket *b = _t[bidx];
-		while (b) {
-			if (b->k == k) {
-				b->v = v;
-				return b->v;
-			}
-			b = b->next;
-		}
-
-		if (_s >= _bc) {
-			_grow();
-			bidx = h % _bc;
+		const uint64_t h = _hash(k);
+		unsigned long i = _find(k,h);
+		if (i < _cap) {
+			_slots[i].v = v;
+		} else {
+			i = _claim(h);
+			new (&(_slots[i])) _Slot(k,v);
 		}
-
-		b = new _Bucket(k,v);
-		b->next = _t[bidx];
-		_t[bidx] = b;
-		++_s;
-		return b->v;
+		return _slots[i].v;
 	}
 
 	/**
@@ -349,26 +326,13 @@ public:
 	 */
 	inline V &operator[](const K &k)
 	{
-		const unsigned long h = _hc(k);
-		unsigned long bidx = h % _bc;
-
-		_Bucket *b = _t[bidx];
-		while (b) {
-			if (b->k == k)
-				return b->v;
-			b = b->next;
-		}
-
-		if (_s >= _bc) {
-			_grow();
-			bidx = h % _bc;
+		const uint64_t h = _hash(k);
+		unsigned long i = _find(k,h);
+		if (i >= _cap) {
+			i = _claim(h);
+			new (&(_slots[i])) _Slot(k);
 		}
-
-		b = new _Bucket(k);
-		b->next = _t[bidx];
-		_t[bidx] = b;
-		++_s;
-		return b->v;
+		return _slots[i].v;
 	}
 
 	/**
@@ -381,6 +345,11 @@ public:
 	 */
 	inline bool empty() const { return (_s == 0); }
 
+	/**
+	 * @return Bytes of heap memory used by the table itself (not counting anything keys or values allocate)
+	 */
+	inline unsigned long memoryUsage() const { return (_cap) ? _allocSize(_cap) : 0; }
+
 private:
 	template<typename O>
 	static inline unsigned long _hc(const O &obj)
@@ -404,31 +373,175 @@ private:
 		return ((unsigned long)i * (unsigned long)0x9e3379b1);
 	}
 
-	inline void _grow()
-	{
-		const unsigned long nc = _bc * 2;
-		_Bucket **nt = reinterpret_cast<_Bucket **>(::malloc(sizeof(_Bucket *) * nc));
-		if (nt) {
-			for(unsigned long i=0;i<nc;++i)
-				nt[i] = (_Bucket *)0;
-			for(unsigned long i=0;i<_bc;++i) {
-				_Bucket *b = _t[i];
-				while (b) {
-					_Bucket *const nb = b->next;
-					const unsigned long nidx = _hc(b->k) % nc;
-					b->next = nt[nidx];
-					nt[nidx] = b;
-					b = nb;
+	// Mix hash codes so both the 7 control bits and the group index are well distributed
+	static inline uint64_t _hash(const K &k)
+	{
+		uint64_t h = (uint64_t)_hc(k);
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdULL;
+		h ^= h >> 33;
+		return h;
+	}
+
+	static inline unsigned int _ctz(unsigned int m)
+	{
+#if defined(__GNUC__)
+		return (unsigned int)__builtin_ctz(m);
+#elif defined(_MSC_VER)
+		unsigned long i;
+		_BitScanForward(&i,m);
+		return (unsigned int)i;
+#else
+		unsigned int i = 0;
+		while (!(m & 1)) {
+			m >>= 1;
+			++i;
+		}
+		return i;
+#endif
+	}
+
+	// Bit masks of positions in a group of 16 control bytes matching a hash, empty, or empty or deleted
+	static inline unsigned int _match(const int8_t *g,const int8_t h2)
+	{
+#ifdef ZT_HASHTABLE_SSE2
+		return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2),_mm_loadu_si128(reinterpret_cast<const __m128i *>(g))));
+#else
+		unsigned int m = 0;
+		for(unsigned int i=0;i<ZT_HASHTABLE_GROUP_SIZE;++i)
+			m |= ((unsigned int)(g[i] == h2)) << i;
+		return m;
+#endif
+	}
+	static inline unsigned int _matchEmpty(const int8_t *g) { return _match(g,ZT_HASHTABLE_CTRL_EMPTY); }
+	static inline unsigned int _matchEmptyOrDeleted(const int8_t *g)
+	{
+#ifdef ZT_HASHTABLE_SSE2
+		return (unsigned int)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(ZT_HASHTABLE_CTRL_SENTINEL),_mm_loadu_si128(reinterpret_cast<const __m128i *>(g))));
+#else
+		unsigned int m = 0;
+		for(unsigned int i=0;i<ZT_HASHTABLE_GROUP_SIZE;++i)
+			m |= ((unsigned int)(g[i] < ZT_HASHTABLE_CTRL_SENTINEL)) << i;
+		return m;
+#endif
+	}
+
+	// Tables smaller than a group are padded with sentinel control bytes to a full group
+	static inline unsigned long _ctrlSize(const unsigned long cap) { return (cap < ZT_HASHTABLE_GROUP_SIZE) ? ZT_HASHTABLE_GROUP_SIZE : cap; }
+	static inline unsigned long _allocSize(const unsigned long cap) { return _ctrlSize(cap) + (sizeof(_Slot) * cap); }
+	static inline unsigned long _groups(const unsigned long cap) { return _ctrlSize(cap) / ZT_HASHTABLE_GROUP_SIZE; }
+	static inline unsigned long _maxLoad(const unsigned long cap) { return (cap < ZT_HASHTABLE_GROUP_SIZE) ? cap : (cap - (cap / 8)); }
+	static inline unsigned long _pow2(const unsigned long n)
+	{
+		unsigned long c = 1;
+		while (c < n)
+			c <<= 1;
+		return c;
+	}
+
+	// Groups are probed in triangular order, which visits every group once since their count is a power of two
+	inline unsigned long _find(const K &k,const uint64_t h) const
+	{
+		if (_s) {
+			const int8_t h2 = (int8_t)(h & 0x7f);
+			const unsigned long gmask = _groups(_cap) - 1;
+			unsigned long g = (unsigned long)(h >> 7) & gmask;
+			for(unsigned long n=1;;++n) {
+				const int8_t *const c = _ctrl + (g * ZT_HASHTABLE_GROUP_SIZE);
+				for(unsigned int m=_match(c,h2);m;m&=(m - 1)) {
+					const unsigned long i = (g * ZT_HASHTABLE_GROUP_SIZE) + _ctz(m);
+					if (_slots[i].k == k)
+						return i;
 				}
+				if ((_matchEmpty(c))||(n > gmask))
+					break;
+				g = (g + n) & gmask;
+			}
+		}
+		return _cap;
+	}
+
+	// Returns the first empty or deleted slot on h's probe path without claiming it, or _cap if full
+	inline unsigned long _findFree(const uint64_t h) const
+	{
+		const unsigned long gmask = _groups(_cap) - 1;
+		unsigned long g = (unsigned long)(h >> 7) & gmask;
+		for(unsigned long n=1;n<=(gmask + 1);++n) {
+			const unsigned int m = _matchEmptyOrDeleted(_ctrl + (g * ZT_HASHTABLE_GROUP_SIZE));
+			if (m)
+				return (g * ZT_HASHTABLE_GROUP_SIZE) + _ctz(m);
+			g = (g + n) & gmask;
+		}
+		return _cap;
+	}
+
+	// Claims a slot for a new key with hash h (key must not be present), growing if needed
+	inline unsigned long _claim(const uint64_t h)
+	{
+		unsigned long i = (_cap) ? _findFree(h) : 0;
+		if ((i >= _cap)||((_ctrl[i] == ZT_HASHTABLE_CTRL_EMPTY)&&(!_growthLeft))) {
+			// Rehash at the same size if tombstones rather than entries are what fill the table
+			_rehash((!_cap) ? _initialCap : (((_s * 2) <= _maxLoad(_cap)) ? _cap : (_cap * 2)));
+			i = _findFree(h);
+		}
+		if (_ctrl[i] == ZT_HASHTABLE_CTRL_EMPTY)
+			--_growthLeft;
+		_ctrl[i] = (int8_t)(h & 0x7f);
+		++_s;
+		return i;
+	}
+
+	inline void _alloc(const unsigned long cap)
+	{
+		_ctrl = reinterpret_cast<int8_t *>(::malloc(_allocSize(cap)));
+		if (!_ctrl)
+			throw ZT_EXCEPTION_OUT_OF_MEMORY;
+		memset(_ctrl,ZT_HASHTABLE_CTRL_EMPTY,cap);
+		if (cap < ZT_HASHTABLE_GROUP_SIZE)
+			memset(_ctrl + cap,ZT_HASHTABLE_CTRL_SENTINEL,ZT_HASHTABLE_GROUP_SIZE - cap);
+		_slots = reinterpret_cast<_Slot *>(_ctrl + _ctrlSize(cap));
+		_cap = cap;
+		_growthLeft = _maxLoad(cap);
+	}
+
+	inline void _rehash(const unsigned long cap)
+	{
+		int8_t *const oc = _ctrl;
+		_Slot *const os = _slots;
+		const unsigned long ocap = _cap;
+		_alloc(cap);
+		for(unsigned long i=0;i<ocap;++i) {
+			if (oc[i] >= 0) {
+				const uint64_t h = _hash(os[i].k);
+				const unsigned long j = _findFree(h);
+				_ctrl[j] = (int8_t)(h & 0x7f);
+				new (&(_slots[j])) _Slot(std::move(os[i]));
+				os[i].~_Slot();
+			}
+		}
+		_growthLeft -= _s;
+		::free(oc);
+	}
+
+	inline void _copy(const Hashtable<K,V> &ht)
+	{
+		if (ht._s) {
+			_alloc(ht._cap);
+			memcpy(_ctrl,ht._ctrl,_ctrlSize(_cap));
+			for(unsigned long i=0;i<_cap;++i) {
+				if (_ctrl[i] >= 0)
+					new (&(_slots[i])) _Slot(ht._slots[i]);
 			}
-			::free(_t);
-			_t = nt;
-			_bc = nc;
+			_growthLeft = ht._growthLeft;
+			_s = ht._s;
 		}
 	}
 
-	_Bucket **_t;
-	unsigned long _bc;
+	int8_t *_ctrl; // control bytes followed by slots, in one allocation
+	_Slot *_slots;
+	unsigned long _cap;
+	unsigned long _initialCap;
+	unsigned long _growthLeft; // insertions into empty (not deleted) slots allowed before a rehash
 	unsigned long _s;
 };
 
@@ -78,7 +78,7 @@ bool IncomingPacket::tryDecode(const RuntimeEnvironment *RR,void *tPtr)
 		const SharedPtr<Peer> peer(RR->topology->getPeer(tPtr,sourceAddress));
 		if (peer) {
 			if (!trusted) {
-				if (!dearmor(peer->key())) {
+				if (!dearmor(peer->key(),peer->aesKey())) {
 					RR->t->incomingPacketMessageAuthenticationFailure(tPtr,_path,packetId(),sourceAddress,hops(),"invalid MAC");
 					_path->recordInvalidPacket();
 					return true;
@@ -314,7 +314,7 @@ bool IncomingPacket::_doHELLO(const RuntimeEnvironment *RR,void *tPtr,const bool
 			} else {
 				// Identity is the same as the one we already have -- check packet integrity
 
-				if (!dearmor(peer->key())) {
+				if (!dearmor(peer->key(),peer->aesKey())) {
 					RR->t->incomingPacketMessageAuthenticationFailure(tPtr,_path,pid,fromAddress,hops(),"invalid MAC");
 					return true;
 				}
@@ -374,6 +374,7 @@ bool IncomingPacket::_doHELLO(const RuntimeEnvironment *RR,void *tPtr,const bool
 	}
 
 	std::vector< std::pair<uint64_t,uint64_t> > moonIdsAndTimestamps;
+	unsigned int cipherSuites = 0;
 	if (ptr < size()) {
 		// Remainder of packet, if present, is encrypted
 		cryptField(peer->key(),ptr,size() - ptr);
@@ -387,6 +388,12 @@ bool IncomingPacket::_doHELLO(const RuntimeEnvironment *RR,void *tPtr,const bool
 				ptr += 16;
 			}
 		}
+
+		// Get supported cipher suites if present
+		if ((ptr + 2) <= size()) {
+			cipherSuites = at<uint16_t>(ptr);
+			ptr += 2;
+		}
 	}
 
 	// Send OK(HELLO) with an echo of the packet's timestamp and some of the same
@@ -450,11 +457,13 @@ bool IncomingPacket::_doHELLO(const RuntimeEnvironment *RR,void *tPtr,const bool
 		}
 	}
 	outp.setAt<uint16_t>(worldUpdateSizeAt,(uint16_t)(outp.size() - (worldUpdateSizeAt + 2)));
+	outp.append((uint16_t)Peer::localCipherSuites());
 
 	outp.armor(peer->key(),true);
 	_path->send(RR,tPtr,outp.data(),outp.size(),now);
 
 	peer->setRemoteVersion(protoVersion,vMajor,vMinor,vRevision); // important for this to go first so received() knows the version
+	peer->setRemoteCipherSuites(cipherSuites);
 	peer->received(tPtr,_path,hops(),pid,payloadLength(),Packet::VERB_HELLO,0,Packet::VERB_NOP,false,0);
 
 	return true;
@@ -502,11 +511,17 @@ bool IncomingPacket::_doOK(const RuntimeEnvironment *RR,void *tPtr,const SharedP
 				}
 			}
 
+			// Get supported cipher suites if present
+			unsigned int cipherSuites = 0;
+			if ((ptr + 2) <= size())
+				cipherSuites = at<uint16_t>(ptr);
+
 			if (!hops()) {
 				_path->updateLatency((unsigned int)latency,RR->node->now());
 			}
 
 			peer->setRemoteVersion(vProto,vMajor,vMinor,vRevision);
+			peer->setRemoteCipherSuites(cipherSuites);
 
 			if ((externalSurfaceAddress)&&(hops() == 0))
 				RR->sa->iam(tPtr,peer->address(),_path->localSocket(),_path->address(),externalSurfaceAddress,RR->topology->isUpstream(peer->identity()),RR->node->now());
@@ -43,7 +43,7 @@ Membership::Membership() :
 	_lastPushedCredentials(0),
 	_revocations(4),
 	_remoteTags(4),
-	_remoteCaps(4),
+	_remoteCaps(1), // capabilities are large and members rarely have more than one or two
 	_remoteCoos(4)
 {
 }
@@ -38,6 +38,9 @@
 #include "Tag.hpp"
 #include "Revocation.hpp"
 #include "NetworkConfig.hpp"
+#include "SharedPtr.hpp"
+#include "AtomicCounter.hpp"
+#include "Mutex.hpp"
 
 #define ZT_MEMBERSHIP_CRED_ID_UNUSED 0xffffffffffffffffULL
 
@@ -51,10 +54,14 @@ class Network;
  *
  * This is essentially a relational join between Peer and Network.
  *
- * This class is not thread safe. It must be locked externally.
+ * This class is not thread safe. It must be locked externally: Network
+ * holds credentialLock() whenever it changes credentials, so the packet
+ * filters can read them under this lock alone.
  */
 class Membership
 {
+	friend class SharedPtr<Membership>;
+
 public:
 	enum AddCredentialResult
 	{
@@ -66,6 +73,11 @@ public:
 
 	Membership();
 
+	/**
+	 * @return Lock held while this member's credentials are added, cleaned, or read by rule evaluation
+	 */
+	inline const Mutex &credentialLock() const { return _credentials_m; }
+
 	/**
 	 * Send COM and other credentials to this peer
 	 *
@@ -243,6 +255,9 @@ private:
 	Hashtable< uint32_t,Capability > _remoteCaps;
 	Hashtable< uint32_t,CertificateOfOwnership > _remoteCoos;
 
+	Mutex _credentials_m;
+	AtomicCounter __refCount;
+
 public:
 	class CapabilityIterator
 	{
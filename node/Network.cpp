@@ -81,6 +81,18 @@ static bool _ipv6GetPayload(const uint8_t *frameData,unsigned int frameLen,unsig
 	return false; // overflow == invalid
 }
 
+// Holds a member's credential lock for the life of this object, or nothing if there is no member
+class _CredentialLock
+{
+public:
+	_CredentialLock(const Membership *m) : _m((m) ? const_cast<Mutex *>(&(m->credentialLock())) : (Mutex *)0) { if (_m) _m->lock(); }
+	~_CredentialLock() { if (_m) _m->unlock(); }
+private:
+	_CredentialLock(const _CredentialLock &);
+	_CredentialLock &operator=(const _CredentialLock &);
+	Mutex *const _m;
+};
+
 enum _doZtFilterResult
 {
 	DOZTFILTER_NO_MATCH,
@@ -128,7 +140,7 @@ static _doZtFilterResult _doZtFilter(
 			if (thisSetMatches) {
 				switch(rt) {
 					case ZT_NETWORK_RULE_ACTION_PRIORITY:
-						qosBucket = (rules[rn].v.qosBucket >= 0 || rules[rn].v.qosBucket <= 8) ? rules[rn].v.qosBucket : 4; // 4 = default bucket (no priority)
+						qosBucket = (rules[rn].v.qosBucket < ZT_QOS_NUM_BUCKETS) ? rules[rn].v.qosBucket : ZT_QOS_DEFAULT_BUCKET;
 						return DOZTFILTER_ACCEPT;
 
 					case ZT_NETWORK_RULE_ACTION_DROP:
@@ -560,10 +572,13 @@ Network::Network(const RuntimeEnvironment *renv,void *tPtr,uint64_t nwid,void *u
 	_lastAnnouncedMulticastGroupsUpstream(0),
 	_mac(renv->identity.address(),nwid),
 	_portInitialized(false),
+	_qosEnabled(false),
 	_lastConfigUpdate(0),
+	_snapshot(new NetworkConfig()),
 	_destroyed(false),
 	_netconfFailure(NETCONF_FAILURE_NONE),
-	_portError(0)
+	_portError(0),
+	_memberships(8)
 {
 	for(int i=0;i<ZT_NETWORK_MAX_INCOMING_UPDATES;++i)
 		_incomingConfigChunks[i].ts = 0;
@@ -616,6 +631,8 @@ Network::~Network()
 	} else {
 		RR->node->configureVirtualNetworkPort((void *)0,_id,&_uPtr,ZT_VIRTUAL_NETWORK_CONFIG_OPERATION_DOWN,&ctmp);
 	}
+
+	delete _snapshot.load();
 }
 
 bool Network::filterOutgoingPacket(
@@ -639,19 +656,34 @@ bool Network::filterOutgoingPacket(
 	unsigned int ccLength = 0;
 	bool ccWatch = false;
 
-	Mutex::Lock _l(_lock);
+	Address cc2;
+	unsigned int ccLength2 = 0;
+	bool ccWatch2 = false;
 
-	Membership *const membership = (ztDest) ? _memberships.get(ztDest) : (Membership *)0;
+	const Epoch::Guard _g(_snapshotEpoch);
+	const NetworkConfig &nconf = *_snapshot.load();
 
-	switch(_doZtFilter(RR,rrl,_config,membership,false,ztSource,ztFinalDest,macSource,macDest,frameData,frameLen,etherType,vlanId,_config.rules,_config.ruleCount,cc,ccLength,ccWatch,qosBucket)) {
+	SharedPtr<Membership> membership;
+	if (ztDest) {
+		Mutex::Lock _l(_memberships_m);
+		const SharedPtr<Membership> *const m = _memberships.get(ztDest);
+		if (m)
+			membership = *m;
+	}
 
-		case DOZTFILTER_NO_MATCH: {
-			for(unsigned int c=0;c<_config.capabilityCount;++c) {
+	// Rules run under only the destination's credential lock, and anything
+	// they want sent goes out after it is released.
+	_doZtFilterResult r;
+	{
+		_CredentialLock _ml(membership.ptr());
+		r = _doZtFilter(RR,rrl,nconf,membership.ptr(),false,ztSource,ztFinalDest,macSource,macDest,frameData,frameLen,etherType,vlanId,nconf.rules,nconf.ruleCount,cc,ccLength,ccWatch,qosBucket);
+		if (r == DOZTFILTER_NO_MATCH) {
+			for(unsigned int c=0;c<nconf.capabilityCount;++c) {
 				ztFinalDest = ztDest; // sanity check, shouldn't be possible if there was no match
-				Address cc2;
-				unsigned int ccLength2 = 0;
-				bool ccWatch2 = false;
-				switch (_doZtFilter(RR,crrl,_config,membership,false,ztSource,ztFinalDest,macSource,macDest,frameData,frameLen,etherType,vlanId,_config.capabilities[c].rules(),_config.capabilities[c].ruleCount(),cc2,ccLength2,ccWatch2,qosBucket)) {
+				cc2.zero();
+				ccLength2 = 0;
+				ccWatch2 = false;
+				switch (_doZtFilter(RR,crrl,nconf,membership.ptr(),false,ztSource,ztFinalDest,macSource,macDest,frameData,frameLen,etherType,vlanId,nconf.capabilities[c].rules(),nconf.capabilities[c].ruleCount(),cc2,ccLength2,ccWatch2,qosBucket)) {
 					case DOZTFILTER_NO_MATCH:
 					case DOZTFILTER_DROP: // explicit DROP in a capability just terminates its evaluation and is an anti-pattern
 						break;
@@ -661,28 +693,32 @@ bool Network::filterOutgoingPacket(
 					case DOZTFILTER_SUPER_ACCEPT: // no difference in behavior on outbound side in capabilities
 						localCapabilityIndex = (int)c;
 						accept = 1;
-
-						if ((!noTee)&&(cc2)) {
-							Packet outp(cc2,RR->identity.address(),Packet::VERB_EXT_FRAME);
-							outp.append(_id);
-							outp.append((uint8_t)(ccWatch2 ? 0x16 : 0x02));
-							macDest.appendTo(outp);
-							macSource.appendTo(outp);
-							outp.append((uint16_t)etherType);
-							outp.append(frameData,ccLength2);
-							outp.compress();
-							RR->sw->send(tPtr,outp,true);
-						}
-
 						break;
 				}
 				if (accept)
 					break;
 			}
-		}	break;
+		}
+	}
+
+	switch(r) {
+
+		case DOZTFILTER_NO_MATCH:
+			if ((accept)&&(!noTee)&&(cc2)) {
+				Packet outp(cc2,RR->identity.address(),Packet::VERB_EXT_FRAME);
+				outp.append(_id);
+				outp.append((uint8_t)(ccWatch2 ? 0x16 : 0x02));
+				macDest.appendTo(outp);
+				macSource.appendTo(outp);
+				outp.append((uint16_t)etherType);
+				outp.append(frameData,ccLength2);
+				outp.compress();
+				RR->sw->send(tPtr,outp,true);
+			}
+			break;
 
 		case DOZTFILTER_DROP:
-			if (_config.remoteTraceTarget)
+			if (nconf.remoteTraceTarget)
 				RR->t->networkFilter(tPtr,*this,rrl,(Trace::RuleResultLog *)0,(Capability *)0,ztSource,ztDest,macSource,macDest,frameData,frameLen,etherType,vlanId,noTee,false,0);
 			return false;
 
@@ -720,17 +756,17 @@ bool Network::filterOutgoingPacket(
 			outp.compress();
 			RR->sw->send(tPtr,outp,true);
 
-			if (_config.remoteTraceTarget)
-				RR->t->networkFilter(tPtr,*this,rrl,(localCapabilityIndex >= 0) ? &crrl : (Trace::RuleResultLog *)0,(localCapabilityIndex >= 0) ? &(_config.capabilities[localCapabilityIndex]) : (Capability *)0,ztSource,ztDest,macSource,macDest,frameData,frameLen,etherType,vlanId,noTee,false,0);
+			if (nconf.remoteTraceTarget)
+				RR->t->networkFilter(tPtr,*this,rrl,(localCapabilityIndex >= 0) ? &crrl : (Trace::RuleResultLog *)0,(localCapabilityIndex >= 0) ? &(nconf.capabilities[localCapabilityIndex]) : (Capability *)0,ztSource,ztDest,macSource,macDest,frameData,frameLen,etherType,vlanId,noTee,false,0);
 			return false; // DROP locally, since we redirected
 		} else {
-			if (_config.remoteTraceTarget)
-				RR->t->networkFilter(tPtr,*this,rrl,(localCapabilityIndex >= 0) ? &crrl : (Trace::RuleResultLog *)0,(localCapabilityIndex >= 0) ? &(_config.capabilities[localCapabilityIndex]) : (Capability *)0,ztSource,ztDest,macSource,macDest,frameData,frameLen,etherType,vlanId,noTee,false,1);
+			if (nconf.remoteTraceTarget)
+				RR->t->networkFilter(tPtr,*this,rrl,(localCapabilityIndex >= 0) ? &crrl : (Trace::RuleResultLog *)0,(localCapabilityIndex >= 0) ? &(nconf.capabilities[localCapabilityIndex]) : (Capability *)0,ztSource,ztDest,macSource,macDest,frameData,frameLen,etherType,vlanId,noTee,false,1);
 			return true;
 		}
 	} else {
-		if (_config.remoteTraceTarget)
-			RR->t->networkFilter(tPtr,*this,rrl,(localCapabilityIndex >= 0) ? &crrl : (Trace::RuleResultLog *)0,(localCapabilityIndex >= 0) ? &(_config.capabilities[localCapabilityIndex]) : (Capability *)0,ztSource,ztDest,macSource,macDest,frameData,frameLen,etherType,vlanId,noTee,false,0);
+		if (nconf.remoteTraceTarget)
+			RR->t->networkFilter(tPtr,*this,rrl,(localCapabilityIndex >= 0) ? &crrl : (Trace::RuleResultLog *)0,(localCapabilityIndex >= 0) ? &(nconf.capabilities[localCapabilityIndex]) : (Capability *)0,ztSource,ztDest,macSource,macDest,frameData,frameLen,etherType,vlanId,noTee,false,0);
 		return false;
 	}
 }
@@ -753,23 +789,37 @@ int Network::filterIncomingPacket(
 	unsigned int ccLength = 0;
 	bool ccWatch = false;
 	const Capability *c = (Capability *)0;
+	Capability traceCap; // copy of the matching capability for tracing, since the member's own may change once unlocked
+	Address cc2;
+	unsigned int ccLength2 = 0;
+	bool ccWatch2 = false;
 
 	uint8_t qosBucket = 255; // For incoming packets this is a dummy value
 
-	Mutex::Lock _l(_lock);
-
-	Membership &membership = _membership(sourcePeer->address());
+	const Epoch::Guard _g(_snapshotEpoch);
+	const NetworkConfig &nconf = *_snapshot.load();
 
-	switch (_doZtFilter(RR,rrl,_config,&membership,true,sourcePeer->address(),ztFinalDest,macSource,macDest,frameData,frameLen,etherType,vlanId,_config.rules,_config.ruleCount,cc,ccLength,ccWatch,qosBucket)) {
+	SharedPtr<Membership> membership;
+	{
+		Mutex::Lock _l(_memberships_m);
+		membership = _membership(sourcePeer->address());
+	}
 
-		case DOZTFILTER_NO_MATCH: {
-			Membership::CapabilityIterator mci(membership,_config);
-			while ((c = mci.next())) {
+	// Rules run under only the sender's credential lock, and anything they
+	// want sent goes out after it is released.
+	_doZtFilterResult r;
+	{
+		Mutex::Lock _ml(membership->credentialLock());
+		r = _doZtFilter(RR,rrl,nconf,membership.ptr(),true,sourcePeer->address(),ztFinalDest,macSource,macDest,frameData,frameLen,etherType,vlanId,nconf.rules,nconf.ruleCount,cc,ccLength,ccWatch,qosBucket);
+		if (r == DOZTFILTER_NO_MATCH) {
+			Membership::CapabilityIterator mci(*membership,nconf);
+			const Capability *mc;
+			while ((mc = mci.next())) {
 				ztFinalDest = ztDest; // sanity check, should be unmodified if there was no match
-				Address cc2;
-				unsigned int ccLength2 = 0;
-				bool ccWatch2 = false;
-				switch(_doZtFilter(RR,crrl,_config,&membership,true,sourcePeer->address(),ztFinalDest,macSource,macDest,frameData,frameLen,etherType,vlanId,c->rules(),c->ruleCount(),cc2,ccLength2,ccWatch2,qosBucket)) {
+				cc2.zero();
+				ccLength2 = 0;
+				ccWatch2 = false;
+				switch(_doZtFilter(RR,crrl,nconf,membership.ptr(),true,sourcePeer->address(),ztFinalDest,macSource,macDest,frameData,frameLen,etherType,vlanId,mc->rules(),mc->ruleCount(),cc2,ccLength2,ccWatch2,qosBucket)) {
 					case DOZTFILTER_NO_MATCH:
 					case DOZTFILTER_DROP: // explicit DROP in a capability just terminates its evaluation and is an anti-pattern
 						break;
@@ -781,26 +831,35 @@ int Network::filterIncomingPacket(
 						accept = 2; // super-ACCEPT
 						break;
 				}
-
 				if (accept) {
-					if (cc2) {
-						Packet outp(cc2,RR->identity.address(),Packet::VERB_EXT_FRAME);
-						outp.append(_id);
-						outp.append((uint8_t)(ccWatch2 ? 0x1c : 0x08));
-						macDest.appendTo(outp);
-						macSource.appendTo(outp);
-						outp.append((uint16_t)etherType);
-						outp.append(frameData,ccLength2);
-						outp.compress();
-						RR->sw->send(tPtr,outp,true);
+					if (nconf.remoteTraceTarget) {
+						traceCap = *mc;
+						c = &traceCap;
 					}
 					break;
 				}
 			}
-		}	break;
+		}
+	}
+
+	switch (r) {
+
+		case DOZTFILTER_NO_MATCH:
+			if ((accept)&&(cc2)) {
+				Packet outp(cc2,RR->identity.address(),Packet::VERB_EXT_FRAME);
+				outp.append(_id);
+				outp.append((uint8_t)(ccWatch2 ? 0x1c : 0x08));
+				macDest.appendTo(outp);
+				macSource.appendTo(outp);
+				outp.append((uint16_t)etherType);
+				outp.append(frameData,ccLength2);
+				outp.compress();
+				RR->sw->send(tPtr,outp,true);
+			}
+			break;
 
 		case DOZTFILTER_DROP:
-			if (_config.remoteTraceTarget)
+			if (nconf.remoteTraceTarget)
 				RR->t->networkFilter(tPtr,*this,rrl,(Trace::RuleResultLog *)0,(Capability *)0,sourcePeer->address(),ztDest,macSource,macDest,frameData,frameLen,etherType,vlanId,false,true,0);
 			return 0; // DROP
 
@@ -837,13 +896,13 @@ int Network::filterIncomingPacket(
 			outp.compress();
 			RR->sw->send(tPtr,outp,true);
 
-			if (_config.remoteTraceTarget)
+			if (nconf.remoteTraceTarget)
 				RR->t->networkFilter(tPtr,*this,rrl,(c) ? &crrl : (Trace::RuleResultLog *)0,c,sourcePeer->address(),ztDest,macSource,macDest,frameData,frameLen,etherType,vlanId,false,true,0);
 			return 0; // DROP locally, since we redirected
 		}
 	}
 
-	if (_config.remoteTraceTarget)
+	if (nconf.remoteTraceTarget)
 		RR->t->networkFilter(tPtr,*this,rrl,(c) ? &crrl : (Trace::RuleResultLog *)0,c,sourcePeer->address(),ztDest,macSource,macDest,frameData,frameLen,etherType,vlanId,false,true,accept);
 	return accept;
 }
@@ -935,9 +994,10 @@ uint64_t Network::handleConfigChunk(void *tPtr,const uint64_t packetId,const Add
 
 			// New properly verified chunks can be flooded "virally" through the network
 			if (fastPropagate) {
+				Mutex::Lock _l2(_memberships_m);
 				Address *a = (Address *)0;
-				Membership *m = (Membership *)0;
-				Hashtable<Address,Membership>::Iterator i(_memberships);
+				SharedPtr<Membership> *m = (SharedPtr<Membership> *)0;
+				Hashtable< Address,SharedPtr<Membership> >::Iterator i(_memberships);
 				while (i.next(a,m)) {
 					if ((*a != source)&&(*a != controller())) {
 						Packet outp(*a,RR->identity.address(),Packet::VERB_NETWORK_CONFIG);
@@ -1018,13 +1078,25 @@ int Network::setConfiguration(void *tPtr,const NetworkConfig &nconf,bool saveToD
 		if (_config == nconf)
 			return 1; // OK config, but duplicate of what we already have
 
+		const NetworkConfig *const snapshot = new NetworkConfig(nconf); // copied before locking since it's large
+
 		ZT_VirtualNetworkConfig ctmp;
 		bool oldPortInitialized;
 		{	// do things that require lock here, but unlock before calling callbacks
 			Mutex::Lock _l(_lock);
 
 			_config = nconf;
+			_snapshotEpoch.retire(const_cast<NetworkConfig *>(_snapshot.exchange(snapshot)));
 			_lastConfigUpdate = RR->node->now();
+
+			bool qos = false;
+			for(unsigned int r=0;r<_config.ruleCount;++r)
+				qos |= ((_config.rules[r].t & 0x3f) == ZT_NETWORK_RULE_ACTION_PRIORITY);
+			for(unsigned int c=0;c<_config.capabilityCount;++c) {
+				for(unsigned int r=0;r<_config.capabilities[c].ruleCount();++r)
+					qos |= ((_config.capabilities[c].rules()[r].t & 0x3f) == ZT_NETWORK_RULE_ACTION_PRIORITY);
+			}
+			_qosEnabled = qos;
 			_netconfFailure = NETCONF_FAILURE_NONE;
 
 			oldPortInitialized = _portInitialized;
@@ -1032,6 +1104,7 @@ int Network::setConfiguration(void *tPtr,const NetworkConfig &nconf,bool saveToD
 
 			_externalConfig(&ctmp);
 		}
+		_snapshotEpoch.reclaim();
 
 		_portError = RR->node->configureVirtualNetworkPort(tPtr,_id,&_uPtr,(oldPortInitialized) ? ZT_VIRTUAL_NETWORK_CONFIG_OPERATION_CONFIG_UPDATE : ZT_VIRTUAL_NETWORK_CONFIG_OPERATION_UP,&ctmp);
 
@@ -1235,13 +1308,12 @@ bool Network::gate(void *tPtr,const SharedPtr<Peer> &peer)
 {
 	const int64_t now = RR->node->now();
 	Mutex::Lock _l(_lock);
+	Mutex::Lock _l2(_memberships_m);
 	try {
 		if (_config) {
-			Membership *m = _memberships.get(peer->address());
-			if ( (_config.isPublic()) || ((m)&&(m->isAllowedOnNetwork(_config))) ) {
-				if (!m)
-					m = &(_membership(peer->address()));
-				if (m->multicastLikeGate(now)) {
+			const SharedPtr<Membership> *const m = _memberships.get(peer->address());
+			if ( (_config.isPublic()) || ((m)&&((*m)->isAllowedOnNetwork(_config))) ) {
+				if (_membership(peer->address())->multicastLikeGate(now)) {
 					_announceMulticastGroupsTo(tPtr,peer->address(),_allMulticastGroups());
 				}
 				return true;
@@ -1253,9 +1325,9 @@ bool Network::gate(void *tPtr,const SharedPtr<Peer> &peer)
 
 bool Network::recentlyAssociatedWith(const Address &addr)
 {
-	Mutex::Lock _l(_lock);
-	const Membership *m = _memberships.get(addr);
-	return ((m)&&(m->recentlyAssociated(RR->node->now())));
+	Mutex::Lock _l(_memberships_m);
+	const SharedPtr<Membership> *const m = _memberships.get(addr);
+	return ((m)&&((*m)->recentlyAssociated(RR->node->now())));
 }
 
 void Network::clean()
@@ -1277,15 +1349,21 @@ void Network::clean()
 	}
 
 	{
+		Mutex::Lock _l2(_memberships_m);
 		Address *a = (Address *)0;
-		Membership *m = (Membership *)0;
-		Hashtable<Address,Membership>::Iterator i(_memberships);
+		SharedPtr<Membership> *m = (SharedPtr<Membership> *)0;
+		Hashtable< Address,SharedPtr<Membership> >::Iterator i(_memberships);
 		while (i.next(a,m)) {
-			if (!RR->topology->getPeerNoCache(*a))
+			if (!RR->topology->getPeerNoCache(*a)) {
 				_memberships.erase(*a);
-			else m->clean(now,_config);
+			} else {
+				Mutex::Lock _ml((*m)->credentialLock());
+				(*m)->clean(now,_config);
+			}
 		}
 	}
+
+	_snapshotEpoch.reclaim(); // in case a reader held up reclamation when the config last changed
 }
 
 void Network::learnBridgeRoute(const MAC &mac,const Address &addr)
@@ -1338,8 +1416,11 @@ Membership::AddCredentialResult Network::addCredential(void *tPtr,const Certific
 {
 	if (com.networkId() != _id)
 		return Membership::ADD_REJECTED;
-	Mutex::Lock _l(_lock);
-	return _membership(com.issuedTo()).addCredential(RR,tPtr,_config,com);
+	const Epoch::Guard _g(_snapshotEpoch);
+	Mutex::Lock _l(_memberships_m);
+	Membership &m = *_membership(com.issuedTo());
+	Mutex::Lock _ml(m.credentialLock());
+	return m.addCredential(RR,tPtr,*_snapshot.load(),com);
 }
 
 Membership::AddCredentialResult Network::addCredential(void *tPtr,const Address &sentFrom,const Revocation &rev)
@@ -1347,15 +1428,20 @@ Membership::AddCredentialResult Network::addCredential(void *tPtr,const Address
 	if (rev.networkId() != _id)
 		return Membership::ADD_REJECTED;
 
-	Mutex::Lock _l(_lock);
-	Membership &m = _membership(rev.target());
+	const Epoch::Guard _g(_snapshotEpoch);
+	Mutex::Lock _l(_memberships_m);
+	Membership &m = *_membership(rev.target());
 
-	const Membership::AddCredentialResult result = m.addCredential(RR,tPtr,_config,rev);
+	Membership::AddCredentialResult result;
+	{
+		Mutex::Lock _ml(m.credentialLock());
+		result = m.addCredential(RR,tPtr,*_snapshot.load(),rev);
+	}
 
 	if ((result == Membership::ADD_ACCEPTED_NEW)&&(rev.fastPropagate())) {
 		Address *a = (Address *)0;
-		Membership *m = (Membership *)0;
-		Hashtable<Address,Membership>::Iterator i(_memberships);
+		SharedPtr<Membership> *m = (SharedPtr<Membership> *)0;
+		Hashtable< Address,SharedPtr<Membership> >::Iterator i(_memberships);
 		while (i.next(a,m)) {
 			if ((*a != sentFrom)&&(*a != rev.signer())) {
 				Packet outp(*a,RR->identity.address(),Packet::VERB_NETWORK_CREDENTIALS);
@@ -1439,6 +1525,9 @@ void Network::_externalConfig(ZT_VirtualNetworkConfig *ec) const
 		ec->multicastSubscriptions[i].mac = _myMulticastGroups[i].mac().toInt();
 		ec->multicastSubscriptions[i].adi = _myMulticastGroups[i].adi();
 	}
+
+	ec->qos.enabled = (_qosEnabled) ? 1 : 0;
+	RR->sw->aqmStatistics(_id,ec->qos.queuedPackets,ec->qos.activeFlows,ec->qos.overflowDrops,ec->qos.codelDrops);
 }
 
 void Network::_sendUpdatesToMembers(void *tPtr,const MulticastGroup *const newMulticastGroup)
@@ -1486,11 +1575,12 @@ void Network::_sendUpdatesToMembers(void *tPtr,const MulticastGroup *const newMu
 	}
 
 	{
+		Mutex::Lock _l2(_memberships_m);
 		Address *a = (Address *)0;
-		Membership *m = (Membership *)0;
-		Hashtable<Address,Membership>::Iterator i(_memberships);
+		SharedPtr<Membership> *m = (SharedPtr<Membership> *)0;
+		Hashtable< Address,SharedPtr<Membership> >::Iterator i(_memberships);
 		while (i.next(a,m)) {
-			if ( ( m->multicastLikeGate(now) || (newMulticastGroup) ) && (m->isAllowedOnNetwork(_config)) && (!std::binary_search(alwaysAnnounceTo.begin(),alwaysAnnounceTo.end(),*a)) )
+			if ( ( (*m)->multicastLikeGate(now) || (newMulticastGroup) ) && ((*m)->isAllowedOnNetwork(_config)) && (!std::binary_search(alwaysAnnounceTo.begin(),alwaysAnnounceTo.end(),*a)) )
 				_announceMulticastGroupsTo(tPtr,*a,groups);
 		}
 	}
@@ -1536,10 +1626,13 @@ std::vector<MulticastGroup> Network::_allMulticastGroups() const
 	return mgs;
 }
 
-Membership &Network::_membership(const Address &a)
+const SharedPtr<Membership> &Network::_membership(const Address &a)
 {
-	// assumes _lock is locked
-	return _memberships[a];
+	// assumes _memberships_m is locked
+	SharedPtr<Membership> &m = _memberships[a];
+	if (!m)
+		m.set(new Membership());
+	return m;
 }
 
 } // namespace ZeroTier
@@ -36,6 +36,7 @@
 #include <vector>
 #include <algorithm>
 #include <stdexcept>
+#include <atomic>
 
 #include "Constants.hpp"
 #include "Hashtable.hpp"
@@ -43,6 +44,7 @@
 #include "Mutex.hpp"
 #include "SharedPtr.hpp"
 #include "AtomicCounter.hpp"
+#include "Epoch.hpp"
 #include "MulticastGroup.hpp"
 #include "MAC.hpp"
 #include "Dictionary.hpp"
@@ -291,9 +293,9 @@ public:
 	}
 
 	/**
-	 * @return True if QoS is in effect for this network
+	 * @return True if QoS is in effect for this network (its rules or capabilities contain PRIORITY actions)
 	 */
-	inline bool qosEnabled() { return false; }
+	inline bool qosEnabled() const { return _qosEnabled; }
 
 	/**
 	 * Set a bridge route
@@ -324,8 +326,11 @@ public:
 	{
 		if (cap.networkId() != _id)
 			return Membership::ADD_REJECTED;
-		Mutex::Lock _l(_lock);
-		return _membership(cap.issuedTo()).addCredential(RR,tPtr,_config,cap);
+		const Epoch::Guard _g(_snapshotEpoch);
+		Mutex::Lock _l(_memberships_m);
+		Membership &m = *_membership(cap.issuedTo());
+		Mutex::Lock _ml(m.credentialLock());
+		return m.addCredential(RR,tPtr,*_snapshot.load(),cap);
 	}
 
 	/**
@@ -335,8 +340,11 @@ public:
 	{
 		if (tag.networkId() != _id)
 			return Membership::ADD_REJECTED;
-		Mutex::Lock _l(_lock);
-		return _membership(tag.issuedTo()).addCredential(RR,tPtr,_config,tag);
+		const Epoch::Guard _g(_snapshotEpoch);
+		Mutex::Lock _l(_memberships_m);
+		Membership &m = *_membership(tag.issuedTo());
+		Mutex::Lock _ml(m.credentialLock());
+		return m.addCredential(RR,tPtr,*_snapshot.load(),tag);
 	}
 
 	/**
@@ -351,8 +359,11 @@ public:
 	{
 		if (coo.networkId() != _id)
 			return Membership::ADD_REJECTED;
-		Mutex::Lock _l(_lock);
-		return _membership(coo.issuedTo()).addCredential(RR,tPtr,_config,coo);
+		const Epoch::Guard _g(_snapshotEpoch);
+		Mutex::Lock _l(_memberships_m);
+		Membership &m = *_membership(coo.issuedTo());
+		Mutex::Lock _ml(m.credentialLock());
+		return m.addCredential(RR,tPtr,*_snapshot.load(),coo);
 	}
 
 	/**
@@ -364,8 +375,9 @@ public:
 	 */
 	inline void pushCredentialsNow(void *tPtr,const Address &to,const int64_t now)
 	{
-		Mutex::Lock _l(_lock);
-		_membership(to).pushCredentials(RR,tPtr,now,to,_config);
+		const Epoch::Guard _g(_snapshotEpoch);
+		Mutex::Lock _l(_memberships_m);
+		_membership(to)->pushCredentials(RR,tPtr,now,to,*_snapshot.load());
 	}
 
 	/**
@@ -377,10 +389,11 @@ public:
 	 */
 	inline void pushCredentialsIfNeeded(void *tPtr,const Address &to,const int64_t now)
 	{
-		Mutex::Lock _l(_lock);
-		Membership &m = _membership(to);
+		const Epoch::Guard _g(_snapshotEpoch);
+		Mutex::Lock _l(_memberships_m);
+		Membership &m = *_membership(to);
 		if (m.shouldPushCredentials(now))
-			m.pushCredentials(RR,tPtr,now,to,_config);
+			m.pushCredentials(RR,tPtr,now,to,*_snapshot.load());
 	}
 
 	/**
@@ -414,7 +427,7 @@ private:
 	void _sendUpdatesToMembers(void *tPtr,const MulticastGroup *const newMulticastGroup);
 	void _announceMulticastGroupsTo(void *tPtr,const Address &peer,const std::vector<MulticastGroup> &allMulticastGroups);
 	std::vector<MulticastGroup> _allMulticastGroups() const;
-	Membership &_membership(const Address &a);
+	const SharedPtr<Membership> &_membership(const Address &a); // assumes _memberships_m is locked
 
 	const RuntimeEnvironment *const RR;
 	void *_uPtr;
@@ -422,14 +435,22 @@ private:
 	uint64_t _lastAnnouncedMulticastGroupsUpstream;
 	MAC _mac; // local MAC address
 	bool _portInitialized;
+	volatile bool _qosEnabled;
 
 	std::vector< MulticastGroup > _myMulticastGroups; // multicast groups that we belong to (according to tap)
 	Hashtable< MulticastGroup,uint64_t > _multicastGroupsBehindMe; // multicast groups that seem to be behind us and when we last saw them (if we are a bridge)
 	Hashtable< MAC,Address > _remoteBridgeRoutes; // remote addresses where given MACs are reachable (for tracking devices behind remote bridges)
 
-	NetworkConfig _config;
+	NetworkConfig _config; // locked by _lock, read by config() and everything outside the packet filter path
 	uint64_t _lastConfigUpdate;
 
+	// Immutable copy of the current config for packet filters and credential
+	// checks, which read it under a guard without taking _lock. It's replaced
+	// (never modified) by setConfiguration() and old copies are freed once no
+	// reader can still be using them.
+	Epoch _snapshotEpoch;
+	std::atomic<const NetworkConfig *> _snapshot;
+
 	struct _IncomingConfigChunk
 	{
 		_IncomingConfigChunk() { memset(this,0,sizeof(_IncomingConfigChunk)); }
@@ -452,7 +473,8 @@ private:
 	} _netconfFailure;
 	int _portError; // return value from port config callback
 
-	Hashtable<Address,Membership> _memberships;
+	Hashtable< Address,SharedPtr<Membership> > _memberships;
+	Mutex _memberships_m; // locks _memberships and all members' non-credential state; lock order is _lock, _memberships_m, then a Membership's credentialLock()
 
 	Mutex _lock;
 
@@ -457,6 +457,7 @@ void Node::status(ZT_NodeStatus *status) const
 	status->publicIdentity = RR->publicIdentityStr;
 	status->secretIdentity = RR->secretIdentityStr;
 	status->online = _online ? 1 : 0;
+	RR->sw->rxQueueStatistics(status->rxQueueEvicted,status->rxQueueExpired);
 }
 
 ZT_PeerList *Node::peers() const
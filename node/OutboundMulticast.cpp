@@ -65,18 +65,18 @@ void OutboundMulticast::init(
 
 	if (gatherLimit) flags |= 0x02;
 
-	_packet.setSource(RR->identity.address());
-	_packet.setVerb(Packet::VERB_MULTICAST_FRAME);
-	_packet.append((uint64_t)nwid);
-	_packet.append(flags);
-	if (gatherLimit) _packet.append((uint32_t)gatherLimit);
-	if (src) src.appendTo(_packet);
-	dest.mac().appendTo(_packet);
-	_packet.append((uint32_t)dest.adi());
-	_packet.append((uint16_t)etherType);
-	_packet.append(payload,_frameLen);
+	_packet = PacketPool::get();
+	_packet->reset(Address(),RR->identity.address(),Packet::VERB_MULTICAST_FRAME);
+	_packet->append((uint64_t)nwid);
+	_packet->append(flags);
+	if (gatherLimit) _packet->append((uint32_t)gatherLimit);
+	if (src) src.appendTo(*_packet);
+	dest.mac().appendTo(*_packet);
+	_packet->append((uint32_t)dest.adi());
+	_packet->append((uint16_t)etherType);
+	_packet->append(payload,_frameLen);
 	if (!disableCompression)
-		_packet.compress();
+		_packet->compress();
 
 	memcpy(_frameData,payload,_frameLen);
 }
@@ -87,11 +87,11 @@ void OutboundMulticast::sendOnly(const RuntimeEnvironment *RR,void *tPtr,const A
 	uint8_t QoSBucket = 255; // Dummy value
 	if ((nw)&&(nw->filterOutgoingPacket(tPtr,true,RR->identity.address(),toAddr,_macSrc,_macDest,_frameData,_frameLen,_etherType,0,QoSBucket))) {
 		nw->pushCredentialsIfNeeded(tPtr,toAddr,RR->node->now());
-		_packet.newInitializationVector();
-		_packet.setDestination(toAddr);
-		RR->node->expectReplyTo(_packet.packetId());
-		_tmp = _packet;
-		RR->sw->send(tPtr,_tmp,true);
+		_packet->newInitializationVector();
+		_packet->setDestination(toAddr);
+		RR->node->expectReplyTo(_packet->packetId());
+		PacketPool::Ptr tmp(PacketPool::get(*_packet)); // send() armors in place
+		RR->sw->send(tPtr,*tmp,true);
 	}
 }
 
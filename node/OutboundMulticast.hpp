@@ -37,6 +37,7 @@
 #include "MulticastGroup.hpp"
 #include "Address.hpp"
 #include "Packet.hpp"
+#include "PacketPool.hpp"
 
 namespace ZeroTier {
 
@@ -56,7 +57,17 @@ public:
 	 *
 	 * It must be initialized with init().
 	 */
-	OutboundMulticast() {}
+	OutboundMulticast() :
+		_timestamp(0),
+		_nwid(0),
+		_macSrc(),
+		_macDest(),
+		_limit(0),
+		_frameLen(0),
+		_etherType(0),
+		_packet(),
+		_alreadySentTo(),
+		_frameData() {}
 
 	/**
 	 * Initialize outbound multicast
@@ -161,7 +172,7 @@ private:
 	unsigned int _limit;
 	unsigned int _frameLen;
 	unsigned int _etherType;
-	Packet _packet,_tmp;
+	PacketPool::Ptr _packet;
 	std::vector<Address> _alreadySentTo;
 	uint8_t _frameData[ZT_MAX_MTU];
 };
@@ -54,9 +54,9 @@ namespace ZeroTier {
 
 /* Set up macros for fast single-pass ASM Salsa20/12 crypto, if we have it */
 
-// x64 SSE crypto
+// x64 SSE crypto (only the AVX2 and AVX-512 Salsa20 kernels beat it, SSE2 x4 is about even)
 #ifdef ZT_USE_X64_ASM_SALSA2012
-#define ZT_HAS_FAST_CRYPTO() (true)
+#define ZT_HAS_FAST_CRYPTO() ((int)Salsa20::kernel() < (int)Salsa20::KERNEL_AVX2_X8)
 #define ZT_FAST_SINGLE_PASS_SALSA2012(b,l,n,k) zt_salsa2012_amd64_xmm6(reinterpret_cast<unsigned char *>(b),(l),reinterpret_cast<const unsigned char *>(n),reinterpret_cast<const unsigned char *>(k))
 #endif
 
@@ -79,6 +79,18 @@ static const _FastCryptoChecker _ZT_FAST_CRYPTO_CHECK;
 #define ZT_FAST_SINGLE_PASS_SALSA2012(b,l,n,k) {}
 #endif
 
+// Otherwise armor() encrypts and authenticates the payload in chunks of this
+// many bytes, so each chunk is still in L1 when Poly1305 reads it right after
+// Salsa20 wrote it. (dearmor() can't do the same since it must check the whole
+// MAC before decrypting anything.) Must be a multiple of 64 (a Salsa20 block)
+// and big enough for the widest Salsa20 and Poly1305 kernels.
+#define ZT_ARMOR_CHUNK_SIZE 1024
+
+// In armorBatch() encrypted payloads shorter than this are
+// done with the batched keystream, longer ones (which fill the multi-block
+// kernels on their own) go through the chunked loop.
+#define ZT_ARMOR_BATCH_SMALL_PAYLOAD 256
+
 /************************************************************************** */
 
 /* LZ4 is shipped encapsulated into Packet in an anonymous namespace.
@@ -889,11 +901,43 @@ static inline int LZ4_decompress_safe(const char* source, char* dest, int compre
 
 const unsigned char Packet::ZERO_KEY[32] = { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 };
 
-void Packet::armor(const void *key,bool encryptPayload)
+// Encrypt then MAC payload a chunk at a time
+static inline void _armorChunks(Salsa20 &s20,Poly1305 &p1305,uint8_t *payload,const unsigned int payloadLen)
+{
+	for(unsigned int i=0;i<payloadLen;i+=ZT_ARMOR_CHUNK_SIZE) {
+		const unsigned int n = ((payloadLen - i) < ZT_ARMOR_CHUNK_SIZE) ? (payloadLen - i) : ZT_ARMOR_CHUNK_SIZE;
+		s20.crypt12(payload + i,payload + i,n);
+		p1305.update(payload + i,n);
+	}
+}
+
+// Check MAC over payload and decrypt it only if the MAC is good (payload is left untouched if not)
+static inline bool _verifyThenDecrypt(Salsa20 &s20,Poly1305 &p1305,uint8_t *payload,const unsigned int payloadLen,const uint8_t *expectedMac)
+{
+	p1305.update(payload,payloadLen);
+	uint64_t mac[2];
+	p1305.finish(mac);
+	if (!Utils::secureEq(mac,expectedMac,8))
+		return false;
+	s20.crypt12(payload,payload,payloadLen);
+	return true;
+}
+
+void Packet::armor(const void *key,bool encryptPayload,const AES *aes)
 {
 	uint8_t mangledKey[32];
 	uint8_t *const data = reinterpret_cast<uint8_t *>(unsafeData());
 
+	if (_useAesGcmSiv(encryptPayload,aes)) {
+		setCipher(ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV);
+		uint8_t nonce[12],aad[11],tag[16];
+		_aesGcmSivNonceAndAad(nonce,aad);
+		aes->gcmSivEncrypt(nonce,aad,sizeof(aad),data + ZT_PACKET_IDX_VERB,data + ZT_PACKET_IDX_VERB,size() - ZT_PACKET_IDX_VERB,tag);
+		memcpy(data + ZT_PACKET_IDX_MAC,tag,8);
+		append(tag + 8,ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH);
+		return;
+	}
+
 	// Set flag now, since it affects key mangle function
 	setCipher(encryptPayload ? ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_SALSA2012 : ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_NONE);
 
@@ -915,17 +959,21 @@ void Packet::armor(const void *key,bool encryptPayload)
 		Salsa20 s20(mangledKey,data + ZT_PACKET_IDX_IV);
 		uint64_t macKey[4];
 		s20.crypt12(ZERO_KEY,macKey,sizeof(macKey));
+		Poly1305 p1305(macKey);
 		uint8_t *const payload = data + ZT_PACKET_IDX_VERB;
 		const unsigned int payloadLen = size() - ZT_PACKET_IDX_VERB;
-		if (encryptPayload)
-			s20.crypt12(payload,payload,payloadLen);
+		if (encryptPayload) {
+			_armorChunks(s20,p1305,payload,payloadLen);
+		} else {
+			p1305.update(payload,payloadLen);
+		}
 		uint64_t mac[2];
-		Poly1305::compute(mac,payload,payloadLen,macKey);
+		p1305.finish(mac);
 		memcpy(data + ZT_PACKET_IDX_MAC,mac,8);
 	}
 }
 
-bool Packet::dearmor(const void *key)
+bool Packet::dearmor(const void *key,const AES *aes)
 {
 	uint8_t mangledKey[32];
 	uint8_t *const data = reinterpret_cast<uint8_t *>(unsafeData());
@@ -933,7 +981,16 @@ bool Packet::dearmor(const void *key)
 	unsigned char *const payload = data + ZT_PACKET_IDX_VERB;
 	const unsigned int cs = cipher();
 
-	if ((cs == ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_NONE)||(cs == ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_SALSA2012)) {
+	if (cs == ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV) {
+		if ((!aes)||(payloadLen < ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH))
+			return false;
+		uint8_t nonce[12],aad[11],tag[16];
+		_aesGcmSivNonceAndAad(nonce,aad);
+		memcpy(tag,data + ZT_PACKET_IDX_MAC,8);
+		memcpy(tag + 8,data + (size() - ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH),ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH);
+		setSize(size() - ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH);
+		return aes->gcmSivDecrypt(nonce,aad,sizeof(aad),payload,payload,payloadLen - ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH,tag);
+	} else if ((cs == ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_NONE)||(cs == ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_SALSA2012)) {
 		_salsa20MangleKey((const unsigned char *)key,mangledKey);
 		if (ZT_HAS_FAST_CRYPTO()) {
 			uint64_t keyStream[(ZT_PROTO_MAX_PACKET_LENGTH + 64 + 8) / 8];
@@ -953,8 +1010,12 @@ bool Packet::dearmor(const void *key)
 			Salsa20 s20(mangledKey,data + ZT_PACKET_IDX_IV);
 			uint64_t macKey[4];
 			s20.crypt12(ZERO_KEY,macKey,sizeof(macKey));
+			Poly1305 p1305(macKey);
+			if (cs == ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_SALSA2012)
+				return _verifyThenDecrypt(s20,p1305,payload,payloadLen,data + ZT_PACKET_IDX_MAC);
+			p1305.update(payload,payloadLen);
 			uint64_t mac[2];
-			Poly1305::compute(mac,payload,payloadLen,macKey);
+			p1305.finish(mac);
 #ifdef ZT_NO_TYPE_PUNNING
 			if (!Utils::secureEq(mac,data + ZT_PACKET_IDX_MAC,8))
 				return false;
@@ -962,8 +1023,6 @@ bool Packet::dearmor(const void *key)
 			if ((*reinterpret_cast<const uint64_t *>(data + ZT_PACKET_IDX_MAC)) != mac[0]) // also secure, constant time
 				return false;
 #endif
-			if (cs == ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_SALSA2012)
-				s20.crypt12(payload,payload,payloadLen);
 		}
 
 		return true;
@@ -972,6 +1031,71 @@ bool Packet::dearmor(const void *key)
 	}
 }
 
+void Packet::armorBatch(Packet *const *packets,const void *const *keys,const bool *encryptPayload,unsigned int count)
+{
+	if ((count < 2)||(ZT_HAS_FAST_CRYPTO())||(Salsa20::kernel() == Salsa20::KERNEL_BASELINE)) {
+		for(unsigned int p=0;p<count;++p)
+			packets[p]->armor(keys[p],encryptPayload[p]);
+		return;
+	}
+
+	// Blocks per packet: one for the MAC key plus the payload if it's short
+	const unsigned int maxBlocks = ZT_PACKET_ARMOR_BATCH_MAX * (1 + (ZT_ARMOR_BATCH_SMALL_PAYLOAD / 64));
+	Salsa20 s20[ZT_PACKET_ARMOR_BATCH_MAX];
+	const Salsa20 *streams[maxBlocks];
+	uint64_t blockNo[maxBlocks];
+	unsigned int firstBlock[ZT_PACKET_ARMOR_BATCH_MAX];
+	uint8_t keyStream[maxBlocks * 64];
+	uint8_t mangledKey[32];
+
+	while (count) {
+		const unsigned int n = (count < ZT_PACKET_ARMOR_BATCH_MAX) ? count : ZT_PACKET_ARMOR_BATCH_MAX;
+
+		unsigned int blocks = 0;
+		for(unsigned int p=0;p<n;++p) {
+			Packet &pkt = *(packets[p]);
+			pkt.setCipher(encryptPayload[p] ? ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_SALSA2012 : ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_NONE);
+			pkt._salsa20MangleKey((const unsigned char *)keys[p],mangledKey);
+			s20[p].init(mangledKey,reinterpret_cast<const uint8_t *>(pkt.data()) + ZT_PACKET_IDX_IV);
+			const unsigned int payloadLen = pkt.size() - ZT_PACKET_IDX_VERB;
+			const unsigned int pb = 1 + (((encryptPayload[p])&&(payloadLen < ZT_ARMOR_BATCH_SMALL_PAYLOAD)) ? ((payloadLen + 63) / 64) : 0);
+			firstBlock[p] = blocks;
+			for(unsigned int b=0;b<pb;++b) {
+				streams[blocks] = &(s20[p]);
+				blockNo[blocks++] = b;
+			}
+		}
+		Salsa20::keystream12(streams,blockNo,keyStream,blocks);
+
+		for(unsigned int p=0;p<n;++p) {
+			Packet &pkt = *(packets[p]);
+			uint8_t *const payload = reinterpret_cast<uint8_t *>(pkt.unsafeData()) + ZT_PACKET_IDX_VERB;
+			const unsigned int payloadLen = pkt.size() - ZT_PACKET_IDX_VERB;
+			const uint8_t *const ks = keyStream + (firstBlock[p] * 64);
+			Poly1305 p1305(ks);
+			if (encryptPayload[p]) {
+				if (payloadLen < ZT_ARMOR_BATCH_SMALL_PAYLOAD) {
+					Salsa20::memxor(payload,ks + 64,payloadLen);
+					p1305.update(payload,payloadLen);
+				} else {
+					s20[p].setBlockCounter(1);
+					_armorChunks(s20[p],p1305,payload,payloadLen);
+				}
+			} else {
+				p1305.update(payload,payloadLen);
+			}
+			uint64_t mac[2];
+			p1305.finish(mac);
+			memcpy(reinterpret_cast<uint8_t *>(pkt.unsafeData()) + ZT_PACKET_IDX_MAC,mac,8);
+		}
+
+		packets += n;
+		keys += n;
+		encryptPayload += n;
+		count -= n;
+	}
+}
+
 void Packet::cryptField(const void *key,unsigned int start,unsigned int len)
 {
 	uint8_t *const data = reinterpret_cast<uint8_t *>(unsafeData());
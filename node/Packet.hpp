@@ -37,6 +37,7 @@
 #include "Constants.hpp"
 
 #include "Address.hpp"
+#include "AES.hpp"
 #include "Poly1305.hpp"
 #include "Salsa20.hpp"
 #include "Utils.hpp"
@@ -70,6 +71,7 @@
  * 9  - 1.2.0 ... 1.2.14
  * 10 - 1.4.0 ... CURRENT
  *    + Multipath capability and load balancing
+ *    + Optional AES-GCM-SIV cipher suite, negotiated in HELLO
  */
 #define ZT_PROTO_VERSION 10
 
@@ -121,6 +123,25 @@
  */
 #define ZT_PROTO_CIPHER_SUITE__NO_CRYPTO_TRUSTED_PATH 2
 
+/**
+ * Cipher suite: Curve25519/AES-256-GCM-SIV
+ *
+ * The payload is encrypted and authenticated with AES-256-GCM-SIV (RFC
+ * 8452) under a per-peer key derived from the Curve25519 agreed key. The
+ * nonce is the 64-bit packet ID followed by four zero bytes, and the
+ * destination, source, and flags (with hop count masked off) are the
+ * additional authenticated data. The first 8 bytes of the 16-byte tag go
+ * in the MAC field and the last 8 bytes are appended to the packet.
+ *
+ * This is only used with peers that advertise it in HELLO or OK(HELLO).
+ */
+#define ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV 3
+
+/**
+ * Bytes appended to packets armored with ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV
+ */
+#define ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH 8
+
 /**
  * DEPRECATED payload encrypted flag, may be re-used in the future.
  *
@@ -251,6 +272,11 @@
  */
 #define ZT_PROTO_MIN_FRAGMENT_LENGTH ZT_PACKET_FRAGMENT_IDX_PAYLOAD
 
+/**
+ * Maximum number of packets armored together by armorBatch()
+ */
+#define ZT_PACKET_ARMOR_BATCH_MAX 16
+
 // Field indices for parsing verbs -------------------------------------------
 
 // Some verbs have variable-length fields. Those aren't fully defined here
@@ -550,6 +576,7 @@ public:
 		 *   [<[8] 64-bit world ID of moon>]
 		 *   [<[8] 64-bit timestamp of moon>]
 		 *   [... additional moon type/ID/timestamp tuples ...]
+		 *   <[2] 16-bit bit mask of supported cipher suites (1 << suite)>
 		 *
 		 * HELLO is sent in the clear as it is how peers share their identity
 		 * public keys. A few additional fields are sent in the clear too, but
@@ -559,6 +586,11 @@ public:
 		 * remainder of the packet. See cryptField(). Packet MAC is still
 		 * performed of course, so authentication occurs as normal.
 		 *
+		 * Cipher suites are optional (older versions don't send them) and
+		 * each side uses AES-GCM-SIV for encrypted packets to the other only
+		 * if both advertise it. Peers that don't advertise a suite get
+		 * Salsa20/Poly1305.
+		 *
 		 * Destination address is the actual wire address to which the packet
 		 * was sent. See InetAddress::serialize() for format.
 		 *
@@ -571,6 +603,7 @@ public:
 		 *   <[...] physical destination address of packet>
 		 *   <[2] 16-bit length of world update(s) or 0 if none>
 		 *   [[...] updates to planets and/or moons]
+		 *   <[2] 16-bit bit mask of supported cipher suites (1 << suite)>
 		 *
 		 * With the exception of the timestamp, the other fields pertain to the
 		 * respondent who is sending OK and are not echoes.
@@ -1179,6 +1212,36 @@ public:
 		else (*this)[ZT_PACKET_IDX_FLAGS] &= (char)(~ZT_PROTO_FLAG_FRAGMENTED);
 	}
 
+	/**
+	 * Turn part of this (armored) packet into a fragment without copying it
+	 *
+	 * The fragment header is written over the ZT_PROTO_MIN_FRAGMENT_LENGTH
+	 * bytes just before fragStart, so those bytes must already have been sent.
+	 * Sending the head first and then each fragment in order satisfies this.
+	 * The result is byte for byte what Fragment(*this,...) would contain.
+	 *
+	 * @param fragStart Start of fragment (raw index in packet data)
+	 * @param fragLen Length of fragment in bytes
+	 * @param fragNo Which fragment (>= 1, since 0 is Packet with end chopped off)
+	 * @param fragTotal Total number of fragments (including 0)
+	 * @return Pointer to fragment, which is fragLen + ZT_PROTO_MIN_FRAGMENT_LENGTH bytes long
+	 */
+	inline const void *fragmentInPlace(unsigned int fragStart,unsigned int fragLen,unsigned int fragNo,unsigned int fragTotal)
+	{
+		if ((fragStart < (ZT_PACKET_IDX_PAYLOAD + ZT_PROTO_MIN_FRAGMENT_LENGTH))||((fragStart + fragLen) > size()))
+			throw ZT_EXCEPTION_OUT_OF_BOUNDS;
+		unsigned char *const f = reinterpret_cast<unsigned char *>(unsafeData()) + (fragStart - ZT_PROTO_MIN_FRAGMENT_LENGTH);
+
+		// NOTE: this copies both the IV/packet ID and the destination address.
+		memcpy(f + ZT_PACKET_FRAGMENT_IDX_PACKET_ID,field(ZT_PACKET_IDX_IV,13),13);
+
+		f[ZT_PACKET_FRAGMENT_IDX_FRAGMENT_INDICATOR] = ZT_PACKET_FRAGMENT_INDICATOR;
+		f[ZT_PACKET_FRAGMENT_IDX_FRAGMENT_NO] = (unsigned char)(((fragTotal & 0xf) << 4) | (fragNo & 0xf));
+		f[ZT_PACKET_FRAGMENT_IDX_HOPS] = 0;
+
+		return f;
+	}
+
 	/**
 	 * @return True if compressed (result only valid if unencrypted)
 	 */
@@ -1278,10 +1341,26 @@ public:
 	/**
 	 * Armor packet for transport
 	 *
+	 * If aes is given and the payload is to be encrypted, AES-GCM-SIV is
+	 * used unless the packet is too full to take its tag trailer, in which
+	 * case this falls back to Salsa20/Poly1305. Use armoredSize() to get the
+	 * size that will result.
+	 *
 	 * @param key 32-byte key
 	 * @param encryptPayload If true, encrypt packet payload, else just MAC
+	 * @param aes AES-GCM-SIV key to use if negotiated with the recipient, or NULL
+	 */
+	void armor(const void *key,bool encryptPayload,const AES *aes = (const AES *)0);
+
+	/**
+	 * @param encryptPayload Value of encryptPayload that will be passed to armor()
+	 * @param aes Value of aes that will be passed to armor()
+	 * @return Size this packet will have after armor()
 	 */
-	void armor(const void *key,bool encryptPayload);
+	inline unsigned int armoredSize(bool encryptPayload,const AES *aes) const
+	{
+		return (_useAesGcmSiv(encryptPayload,aes)) ? (size() + ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH) : size();
+	}
 
 	/**
 	 * Verify and (if encrypted) decrypt packet
@@ -1290,10 +1369,28 @@ public:
 	 * for these. These are handled in IncomingPacket if the sending physical
 	 * address and MAC field match a trusted path.
 	 *
+	 * Decryption and MAC check are done in the same pass, so the payload
+	 * is garbage if this returns false and the packet must be dropped.
+	 *
 	 * @param key 32-byte key
+	 * @param aes AES-GCM-SIV key for packets from this sender, or NULL to reject AES-GCM-SIV packets
 	 * @return False if packet is invalid or failed MAC authenticity check
 	 */
-	bool dearmor(const void *key);
+	bool dearmor(const void *key,const AES *aes = (const AES *)0);
+
+	/**
+	 * Armor several packets for transport
+	 *
+	 * The result is identical to calling armor() on each packet, but the
+	 * Salsa20 blocks for all packets' MAC keys and short payloads are
+	 * generated together so vector lanes stay full when packets are small.
+	 *
+	 * @param packets Packets to armor
+	 * @param keys 32-byte key for each packet
+	 * @param encryptPayload Whether to encrypt each packet's payload
+	 * @param count Number of packets
+	 */
+	static void armorBatch(Packet *const *packets,const void *const *keys,const bool *encryptPayload,unsigned int count);
 
 	/**
 	 * Encrypt/decrypt a separately armored portion of a packet
@@ -1346,6 +1443,21 @@ private:
 	 * @param in Input key (32 bytes)
 	 * @param out Output buffer (32 bytes)
 	 */
+	inline bool _useAesGcmSiv(bool encryptPayload,const AES *aes) const
+	{
+		return ((aes)&&(encryptPayload)&&((size() + ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH) <= ZT_PROTO_MAX_PACKET_LENGTH));
+	}
+
+	// AES-GCM-SIV nonce and additional data, see ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV
+	inline void _aesGcmSivNonceAndAad(uint8_t nonce[12],uint8_t aad[11]) const
+	{
+		const uint8_t *const d = reinterpret_cast<const uint8_t *>(data());
+		memcpy(nonce,d + ZT_PACKET_IDX_IV,8);
+		memset(nonce + 8,0,4);
+		memcpy(aad,d + ZT_PACKET_IDX_DEST,10);
+		aad[10] = d[ZT_PACKET_IDX_FLAGS] & 0xf8;
+	}
+
 	inline void _salsa20MangleKey(const unsigned char *in,unsigned char *out) const
 	{
 		const unsigned char *d = (const unsigned char *)data();
@@ -0,0 +1,179 @@
+/*
+ * ZeroTier One - Network Virtualization Everywhere
+ * Copyright (C) 2011-2019  ZeroTier, Inc.  https://www.zerotier.com/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * --
+ *
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial closed-source software that incorporates or links
+ * directly against ZeroTier software without disclosing the source code
+ * of your own application.
+ */
+
+#ifndef ZT_PACKETPOOL_HPP
+#define ZT_PACKETPOOL_HPP
+
+#include <vector>
+
+#include "Constants.hpp"
+#include "Packet.hpp"
+#include "Mutex.hpp"
+
+namespace ZeroTier {
+
+/**
+ * Recycled Packet buffers for packets that wait in queues
+ *
+ * Packets that have to be held (TX queue, QoS queues, pending multicasts)
+ * are kept in pooled buffers referenced by move-only handles instead of
+ * being copied by value into list nodes. Each thread keeps a small cache
+ * of free buffers so the common case takes no lock and does not touch the
+ * heap; caches spill into and refill from a shared pool, which in turn
+ * frees buffers back to the heap once it is full.
+ */
+class PacketPool
+{
+public:
+	/**
+	 * Move-only handle to a pooled packet, returned to the pool when destroyed
+	 */
+	class Ptr
+	{
+		friend class PacketPool;
+
+	public:
+		Ptr() : _p((Packet *)0) {}
+		Ptr(Ptr &&p) : _p(p._p) { p._p = (Packet *)0; }
+		~Ptr() { PacketPool::_release(_p); }
+
+		inline Ptr &operator=(Ptr &&p)
+		{
+			if (this != &p) {
+				PacketPool::_release(_p);
+				_p = p._p;
+				p._p = (Packet *)0;
+			}
+			return *this;
+		}
+
+		Ptr(const Ptr &) = delete;
+		Ptr &operator=(const Ptr &) = delete;
+
+		inline Packet &operator*() const { return *_p; }
+		inline Packet *operator->() const { return _p; }
+		inline operator bool() const { return (_p != (Packet *)0); }
+
+	private:
+		explicit Ptr(Packet *p) : _p(p) {}
+		Packet *_p;
+	};
+
+	/**
+	 * @return Handle to a packet with unspecified contents (reset() it before use)
+	 */
+	static inline Ptr get() { return Ptr(_acquire()); }
+
+	/**
+	 * @param p Packet to copy (only its first size() bytes are copied)
+	 * @return Handle to a copy of p
+	 */
+	static inline Ptr get(const Packet &p)
+	{
+		Packet *const np = _acquire();
+		np->copyFrom(p.data(),p.size());
+		return Ptr(np);
+	}
+
+private:
+	struct _Shared
+	{
+		std::vector<Packet *> free;
+		Mutex lock;
+	};
+
+	struct _Cache
+	{
+		~_Cache()
+		{
+			// Thread is exiting, so hand what we can back for other threads to use
+			_Shared &s = _shared();
+			Mutex::Lock _l(s.lock);
+			for(std::vector<Packet *>::iterator p(free.begin());p!=free.end();++p) {
+				if (s.free.size() < ZT_PACKET_POOL_SHARED)
+					s.free.push_back(*p);
+				else delete *p;
+			}
+		}
+		std::vector<Packet *> free;
+	};
+
+	// Intentionally never destroyed: thread caches spill into it from their
+	// thread_local destructors, which can run after static destruction has begun.
+	static inline _Shared &_shared()
+	{
+		static _Shared *const s = new _Shared();
+		return *s;
+	}
+
+	static inline _Cache &_cache()
+	{
+		static thread_local _Cache c;
+		return c;
+	}
+
+	static inline Packet *_acquire()
+	{
+		_Cache &c = _cache();
+		if (c.free.empty()) {
+			_Shared &s = _shared();
+			Mutex::Lock _l(s.lock);
+			while ((!s.free.empty())&&(c.free.size() < (ZT_PACKET_POOL_THREAD_CACHE / 2))) {
+				c.free.push_back(s.free.back());
+				s.free.pop_back();
+			}
+			if (c.free.empty())
+				return new Packet();
+		}
+		Packet *const p = c.free.back();
+		c.free.pop_back();
+		return p;
+	}
+
+	static inline void _release(Packet *const p)
+	{
+		if (!p)
+			return;
+		_Cache &c = _cache();
+		if (c.free.size() >= ZT_PACKET_POOL_THREAD_CACHE) {
+			_Shared &s = _shared();
+			Mutex::Lock _l(s.lock);
+			while ((s.free.size() < ZT_PACKET_POOL_SHARED)&&(c.free.size() > (ZT_PACKET_POOL_THREAD_CACHE / 2))) {
+				s.free.push_back(c.free.back());
+				c.free.pop_back();
+			}
+			if (c.free.size() >= ZT_PACKET_POOL_THREAD_CACHE) {
+				delete p;
+				return;
+			}
+		}
+		c.free.push_back(p);
+	}
+};
+
+} // namespace ZeroTier
+
+#endif
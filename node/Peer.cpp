@@ -36,6 +36,7 @@
 #include "InetAddress.hpp"
 #include "RingBuffer.hpp"
 #include "Utils.hpp"
+#include "SHA512.hpp"
 
 namespace ZeroTier {
 
@@ -66,6 +67,7 @@ Peer::Peer(const RuntimeEnvironment *renv,const Identity &myIdentity,const Ident
 	_vMajor(0),
 	_vMinor(0),
 	_vRevision(0),
+	_remoteCipherSuites(0),
 	_id(peerIdentity),
 	_directPathPushCutoffCount(0),
 	_credentialsCutoffCount(0),
@@ -77,6 +79,12 @@ Peer::Peer(const RuntimeEnvironment *renv,const Identity &myIdentity,const Ident
 {
 	if (!myIdentity.agree(peerIdentity,_key,ZT_PEER_SECRET_KEY_LENGTH))
 		throw ZT_EXCEPTION_INVALID_ARGUMENT;
+
+	// AES-GCM-SIV gets its own key instead of sharing the raw one with Salsa20
+	uint8_t aesKey[64];
+	SHA512::hash(aesKey,_key,ZT_PEER_SECRET_KEY_LENGTH);
+	_aes.init(aesKey);
+	Utils::burn(aesKey,sizeof(aesKey));
 }
 
 void Peer::received(
@@ -729,6 +737,7 @@ void Peer::sendHELLO(void *tPtr,const int64_t localSocket,const InetAddress &atA
 		outp.append(*m);
 		outp.append((uint64_t)0);
 	}
+	outp.append((uint16_t)localCipherSuites());
 
 	outp.cryptField(_key,startCryptedPortionAt,outp.size() - startCryptedPortionAt);
 
@@ -40,6 +40,7 @@
 #include "Identity.hpp"
 #include "InetAddress.hpp"
 #include "Packet.hpp"
+#include "AES.hpp"
 #include "SharedPtr.hpp"
 #include "AtomicCounter.hpp"
 #include "Hashtable.hpp"
@@ -390,6 +391,37 @@ public:
 	 */
 	inline const unsigned char *key() const { return _key; }
 
+	/**
+	 * @return AES-GCM-SIV key for this peer (derived from key())
+	 */
+	inline const AES *aesKey() const { return &_aes; }
+
+	/**
+	 * @return Cipher suite to use for encrypted packets to this peer
+	 */
+	inline unsigned int cipherSuite() const
+	{
+		return ((localCipherSuites() & _remoteCipherSuites & (1 << ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV)) != 0) ? ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV : ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_SALSA2012;
+	}
+
+	/**
+	 * Set the cipher suites this peer said it supports in HELLO or OK(HELLO)
+	 *
+	 * @param cs Bit mask of (1 << cipher suite), or 0 if the peer didn't send one
+	 */
+	inline void setRemoteCipherSuites(unsigned int cs) { _remoteCipherSuites = (uint16_t)cs; }
+
+	/**
+	 * @return Bit mask of (1 << cipher suite) for the suites this node advertises
+	 */
+	static inline unsigned int localCipherSuites()
+	{
+		unsigned int cs = (1 << ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_NONE) | (1 << ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_SALSA2012);
+		if (AES::kernel() != AES::KERNEL_SOFTWARE) // only faster than Salsa20/Poly1305 with hardware AES
+			cs |= (1 << ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV);
+		return cs;
+	}
+
 	/**
 	 * Set the currently known remote version of this peer's client
 	 *
@@ -626,6 +658,7 @@ private:
 	};
 
 	uint8_t _key[ZT_PEER_SECRET_KEY_LENGTH];
+	AES _aes;
 
 	const RuntimeEnvironment *RR;
 
@@ -657,6 +690,7 @@ private:
 	uint16_t _vMajor;
 	uint16_t _vMinor;
 	uint16_t _vRevision;
+	uint16_t _remoteCipherSuites;
 
 	_PeerPath _paths[ZT_MAX_PEER_NETWORK_PATHS];
 	Mutex _paths_m;
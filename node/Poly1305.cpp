@@ -16,13 +16,19 @@ Public domain.
 #pragma warning(disable: 4146)
 #endif
 
+// Vector kernels are compiled with per-function target attributes and picked at runtime
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__amd64__)) && (!defined(ZT_POLY1305_NO_VECTOR))
+#define ZT_POLY1305_VECTOR 1
+#include <immintrin.h>
+#endif
+
 namespace ZeroTier {
 
 namespace {
 
 typedef struct poly1305_context {
   size_t aligner;
-  unsigned char opaque[136];
+  unsigned char opaque[512];
 } poly1305_context;
 
 #if (defined(_MSC_VER) || defined(__GNUC__)) && (defined(__amd64) || defined(__amd64__) || defined(__x86_64) || defined(__x86_64__) || defined(__AMD64) || defined(__AMD64__) || defined(_M_X64))
@@ -63,7 +69,7 @@ typedef struct poly1305_context {
 
 #define poly1305_block_size 16
 
-/* 17 + sizeof(size_t) + 8*sizeof(unsigned long long) */
+/* 17 + sizeof(size_t) + 8*sizeof(unsigned long long), plus 4 + 45*sizeof(unsigned long long) for vector kernels */
 typedef struct poly1305_state_internal_t {
   unsigned long long r[3];
   unsigned long long h[3];
@@ -71,6 +77,10 @@ typedef struct poly1305_state_internal_t {
   size_t leftover;
   unsigned char buffer[poly1305_block_size];
   unsigned char final;
+#ifdef ZT_POLY1305_VECTOR
+  unsigned int powers; /* r^1 .. r^powers in pw[] are valid (radix 2^26) */
+  unsigned long long pw[9][5];
+#endif
 } poly1305_state_internal_t;
 
 #if defined(ZT_NO_TYPE_PUNNING) || (__BYTE_ORDER != __LITTLE_ENDIAN)
@@ -129,6 +139,9 @@ static inline void poly1305_init(poly1305_context *ctx, const unsigned char key[
 
   st->leftover = 0;
   st->final = 0;
+#ifdef ZT_POLY1305_VECTOR
+  st->powers = 0;
+#endif
 }
 
 static inline void poly1305_blocks(poly1305_state_internal_t *st, const unsigned char *m, size_t bytes) {
@@ -250,8 +263,221 @@ static inline void poly1305_finish(poly1305_context *ctx, unsigned char mac[16])
   st->r[2] = 0;
   st->pad[0] = 0;
   st->pad[1] = 0;
+#ifdef ZT_POLY1305_VECTOR
+  if (st->powers) {
+    memset(st->pw,0,sizeof(st->pw));
+    st->powers = 0;
+  }
+#endif
 }
 
+#ifdef ZT_POLY1305_VECTOR
+
+//////////////////////////////////////////////////////////////////////////////
+// Vector kernels: lane i of each step accumulates blocks i, i+n, i+2n, ... in
+// radix 2^26 and is multiplied by r^n per step. At the end lane i is
+// multiplied by r^(n-i) instead and the lanes are summed, which is the same
+// as Horner's rule over all the blocks in order.
+
+#define POLY1305_VECTOR_MIN_BYTES 256
+#define POLY1305_MASK26 0x3ffffffULL
+
+/* h = h * r (mod 2^130 - 5), partially reduced; limbs must be < 2^27 */
+static inline void poly1305_mul26(unsigned long long h[5], const unsigned long long r[5]) {
+  const unsigned long long s1 = r[1] * 5, s2 = r[2] * 5, s3 = r[3] * 5, s4 = r[4] * 5;
+  unsigned long long d0,d1,d2,d3,d4,c;
+  d0 = h[0] * r[0] + h[1] * s4 + h[2] * s3 + h[3] * s2 + h[4] * s1;
+  d1 = h[0] * r[1] + h[1] * r[0] + h[2] * s4 + h[3] * s3 + h[4] * s2;
+  d2 = h[0] * r[2] + h[1] * r[1] + h[2] * r[0] + h[3] * s4 + h[4] * s3;
+  d3 = h[0] * r[3] + h[1] * r[2] + h[2] * r[1] + h[3] * r[0] + h[4] * s4;
+  d4 = h[0] * r[4] + h[1] * r[3] + h[2] * r[2] + h[3] * r[1] + h[4] * r[0];
+              c = d0 >> 26; h[0] = d0 & POLY1305_MASK26;
+  d1 += c;    c = d1 >> 26; h[1] = d1 & POLY1305_MASK26;
+  d2 += c;    c = d2 >> 26; h[2] = d2 & POLY1305_MASK26;
+  d3 += c;    c = d3 >> 26; h[3] = d3 & POLY1305_MASK26;
+  d4 += c;    c = d4 >> 26; h[4] = d4 & POLY1305_MASK26;
+  h[0] += c * 5; c = h[0] >> 26; h[0] &= POLY1305_MASK26;
+  h[1] += c;
+}
+
+/* Radix 2^44 (h0,h1 < 2^45, h2 < 2^43) to radix 2^26 */
+static inline void poly1305_44to26(const unsigned long long in[3], unsigned long long out[5]) {
+  out[0] = in[0] & POLY1305_MASK26;
+  out[1] = (in[0] >> 26) + ((in[1] & 0xff) << 18);
+  out[2] = (in[1] >> 8) & POLY1305_MASK26;
+  out[3] = (in[1] >> 34) + ((in[2] & 0xffff) << 10);
+  out[4] = in[2] >> 16;
+}
+
+/* Radix 2^26 (carried as by poly1305_mul26) back to radix 2^44 */
+static inline void poly1305_26to44(const unsigned long long in[5], unsigned long long out[3]) {
+  out[0] = in[0] + ((in[1] & 0x3ffff) << 26);
+  out[1] = (in[1] >> 18) + (in[2] << 8) + ((in[3] & 0x3ff) << 34);
+  out[2] = (in[3] >> 10) + (in[4] << 16);
+}
+
+/* H = H * R (per lane, R and S = 5R in vectors), then a partial carry */
+#define POLY1305_VMULR(T,ADD,MUL,SRL,SLL,AND,H,R,S,MASK) { \
+  T d0 = ADD(ADD(ADD(ADD(MUL(H[0],R[0]),MUL(H[1],S[4])),MUL(H[2],S[3])),MUL(H[3],S[2])),MUL(H[4],S[1])); \
+  T d1 = ADD(ADD(ADD(ADD(MUL(H[0],R[1]),MUL(H[1],R[0])),MUL(H[2],S[4])),MUL(H[3],S[3])),MUL(H[4],S[2])); \
+  T d2 = ADD(ADD(ADD(ADD(MUL(H[0],R[2]),MUL(H[1],R[1])),MUL(H[2],R[0])),MUL(H[3],S[4])),MUL(H[4],S[3])); \
+  T d3 = ADD(ADD(ADD(ADD(MUL(H[0],R[3]),MUL(H[1],R[2])),MUL(H[2],R[1])),MUL(H[3],R[0])),MUL(H[4],S[4])); \
+  T d4 = ADD(ADD(ADD(ADD(MUL(H[0],R[4]),MUL(H[1],R[3])),MUL(H[2],R[2])),MUL(H[3],R[1])),MUL(H[4],R[0])); \
+  T c; \
+                   c = SRL(d0,26); H[0] = AND(d0,MASK); \
+  d1 = ADD(d1,c);  c = SRL(d1,26); H[1] = AND(d1,MASK); \
+  d2 = ADD(d2,c);  c = SRL(d2,26); H[2] = AND(d2,MASK); \
+  d3 = ADD(d3,c);  c = SRL(d3,26); H[3] = AND(d3,MASK); \
+  d4 = ADD(d4,c);  c = SRL(d4,26); H[4] = AND(d4,MASK); \
+  H[0] = ADD(H[0],ADD(c,SLL(c,2))); \
+  c = SRL(H[0],26); H[0] = AND(H[0],MASK); \
+  H[1] = ADD(H[1],c); \
+}
+
+/* Split T0/T1 (low/high 64 bits of each lane's block) into radix 2^26 limbs with the 2^128 bit set */
+#define POLY1305_VSPLIT(OR,SRL,SLL,AND,T0,T1,M,MASK,HIBIT) { \
+  M[0] = AND(T0,MASK); \
+  M[1] = AND(SRL(T0,26),MASK); \
+  M[2] = AND(OR(SRL(T0,52),SLL(T1,12)),MASK); \
+  M[3] = AND(SRL(T1,14),MASK); \
+  M[4] = OR(SRL(T1,40),HIBIT); \
+}
+
+__attribute__((target("avx2")))
+static void poly1305_blocks_x4_avx2(unsigned long long h[5], const unsigned long long pw[9][5], const unsigned char *m, size_t blocks) {
+  const __m256i mask = _mm256_set1_epi64x((long long)POLY1305_MASK26);
+  const __m256i hibit = _mm256_set1_epi64x((long long)1 << 24);
+  __m256i R[5],S[5],H[5],M[5];
+  for (int k = 0; k < 5; k++) {
+    R[k] = _mm256_set1_epi64x((long long)pw[4][k]);
+    S[k] = _mm256_set1_epi64x((long long)(pw[4][k] * 5));
+  }
+
+  for (size_t b = 0; b < blocks; b += 4) {
+    /* blocks 0-3 become lanes 0-3 */
+    const __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(m));
+    const __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(m + 32));
+    const __m256i t0 = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a0,a1),_MM_SHUFFLE(3,1,2,0));
+    const __m256i t1 = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a0,a1),_MM_SHUFFLE(3,1,2,0));
+    POLY1305_VSPLIT(_mm256_or_si256,_mm256_srli_epi64,_mm256_slli_epi64,_mm256_and_si256,t0,t1,M,mask,hibit)
+    if (b == 0) {
+      for (int k = 0; k < 5; k++)
+        H[k] = _mm256_add_epi64(M[k],_mm256_set_epi64x(0,0,0,(long long)h[k]));
+    } else {
+      POLY1305_VMULR(__m256i,_mm256_add_epi64,_mm256_mul_epu32,_mm256_srli_epi64,_mm256_slli_epi64,_mm256_and_si256,H,R,S,mask)
+      for (int k = 0; k < 5; k++)
+        H[k] = _mm256_add_epi64(H[k],M[k]);
+    }
+    m += 64;
+  }
+
+  for (int k = 0; k < 5; k++) {
+    R[k] = _mm256_set_epi64x((long long)pw[1][k],(long long)pw[2][k],(long long)pw[3][k],(long long)pw[4][k]);
+    S[k] = _mm256_set_epi64x((long long)(pw[1][k] * 5),(long long)(pw[2][k] * 5),(long long)(pw[3][k] * 5),(long long)(pw[4][k] * 5));
+  }
+  POLY1305_VMULR(__m256i,_mm256_add_epi64,_mm256_mul_epu32,_mm256_srli_epi64,_mm256_slli_epi64,_mm256_and_si256,H,R,S,mask)
+
+  for (int k = 0; k < 5; k++) {
+    unsigned long long l[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(l),H[k]);
+    h[k] = l[0] + l[1] + l[2] + l[3];
+  }
+}
+
+// GCC's AVX-512 headers pass deliberately undefined vectors to builtins, which -Wall flags
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+static void poly1305_blocks_x8_avx512(unsigned long long h[5], const unsigned long long pw[9][5], const unsigned char *m, size_t blocks) {
+  const __m512i mask = _mm512_set1_epi64((long long)POLY1305_MASK26);
+  const __m512i hibit = _mm512_set1_epi64((long long)1 << 24);
+  const __m512i lohalves = _mm512_set_epi64(14,12,10,8,6,4,2,0);
+  const __m512i hihalves = _mm512_set_epi64(15,13,11,9,7,5,3,1);
+  __m512i R[5],S[5],H[5],M[5];
+  for (int k = 0; k < 5; k++) {
+    R[k] = _mm512_set1_epi64((long long)pw[8][k]);
+    S[k] = _mm512_set1_epi64((long long)(pw[8][k] * 5));
+  }
+
+  for (size_t b = 0; b < blocks; b += 8) {
+    /* blocks 0-7 become lanes 0-7 */
+    const __m512i a0 = _mm512_loadu_si512(m);
+    const __m512i a1 = _mm512_loadu_si512(m + 64);
+    const __m512i t0 = _mm512_permutex2var_epi64(a0,lohalves,a1);
+    const __m512i t1 = _mm512_permutex2var_epi64(a0,hihalves,a1);
+    POLY1305_VSPLIT(_mm512_or_si512,_mm512_srli_epi64,_mm512_slli_epi64,_mm512_and_si512,t0,t1,M,mask,hibit)
+    if (b == 0) {
+      for (int k = 0; k < 5; k++)
+        H[k] = _mm512_add_epi64(M[k],_mm512_set_epi64(0,0,0,0,0,0,0,(long long)h[k]));
+    } else {
+      POLY1305_VMULR(__m512i,_mm512_add_epi64,_mm512_mul_epu32,_mm512_srli_epi64,_mm512_slli_epi64,_mm512_and_si512,H,R,S,mask)
+      for (int k = 0; k < 5; k++)
+        H[k] = _mm512_add_epi64(H[k],M[k]);
+    }
+    m += 128;
+  }
+
+  for (int k = 0; k < 5; k++) {
+    R[k] = _mm512_set_epi64((long long)pw[1][k],(long long)pw[2][k],(long long)pw[3][k],(long long)pw[4][k],(long long)pw[5][k],(long long)pw[6][k],(long long)pw[7][k],(long long)pw[8][k]);
+    S[k] = _mm512_add_epi64(R[k],_mm512_slli_epi64(R[k],2));
+  }
+  POLY1305_VMULR(__m512i,_mm512_add_epi64,_mm512_mul_epu32,_mm512_srli_epi64,_mm512_slli_epi64,_mm512_and_si512,H,R,S,mask)
+
+  for (int k = 0; k < 5; k++) {
+    unsigned long long l[8];
+    _mm512_storeu_si512(l,H[k]);
+    h[k] = l[0] + l[1] + l[2] + l[3] + l[4] + l[5] + l[6] + l[7];
+  }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+/* Hash as many whole steps of blocks as the current kernel takes, returning bytes consumed */
+static inline size_t poly1305_blocks_vector(poly1305_state_internal_t *st, const unsigned char *m, size_t bytes) {
+  const Poly1305::Kernel kernel = Poly1305::kernel();
+  if ((kernel == Poly1305::KERNEL_SCALAR)||(bytes < POLY1305_VECTOR_MIN_BYTES))
+    return 0;
+  const unsigned int n = (kernel == Poly1305::KERNEL_AVX512_X8) ? 8 : 4;
+  const size_t want = bytes - (bytes % (n * poly1305_block_size));
+
+  /* powers of r are computed once per message and kept for later updates */
+  if (!st->powers) {
+    poly1305_44to26(st->r,st->pw[1]);
+    st->powers = 1;
+  }
+  for (; st->powers < n; st->powers++) {
+    memcpy(st->pw[st->powers + 1],st->pw[st->powers],sizeof(st->pw[0]));
+    poly1305_mul26(st->pw[st->powers + 1],st->pw[1]);
+  }
+
+  unsigned long long h[5];
+  poly1305_44to26(st->h,h);
+  if (kernel == Poly1305::KERNEL_AVX512_X8)
+    poly1305_blocks_x8_avx512(h,st->pw,m,want / poly1305_block_size);
+  else poly1305_blocks_x4_avx2(h,st->pw,m,want / poly1305_block_size);
+
+  /* lane sums can exceed 2^26 per limb, so carry before converting back */
+  unsigned long long c;
+              c = h[0] >> 26; h[0] &= POLY1305_MASK26;
+  h[1] += c;  c = h[1] >> 26; h[1] &= POLY1305_MASK26;
+  h[2] += c;  c = h[2] >> 26; h[2] &= POLY1305_MASK26;
+  h[3] += c;  c = h[3] >> 26; h[3] &= POLY1305_MASK26;
+  h[4] += c;  c = h[4] >> 26; h[4] &= POLY1305_MASK26;
+  h[0] += c * 5; c = h[0] >> 26; h[0] &= POLY1305_MASK26;
+  h[1] += c;
+  poly1305_26to44(h,st->h);
+
+  return want;
+}
+
+#endif // ZT_POLY1305_VECTOR
+
 //////////////////////////////////////////////////////////////////////////////
 
 #else
@@ -490,7 +716,14 @@ static inline void poly1305_update(poly1305_context *ctx, const unsigned char *m
     st->leftover = 0;
   }
 
-  /* process full blocks */
+  /* process full blocks, as many as possible with the vector kernels */
+#ifdef ZT_POLY1305_VECTOR
+  if (bytes >= POLY1305_VECTOR_MIN_BYTES) {
+    size_t done = poly1305_blocks_vector(st, m, bytes);
+    m += done;
+    bytes -= done;
+  }
+#endif
   if (bytes >= poly1305_block_size) {
     size_t want = (bytes & ~(poly1305_block_size - 1));
     poly1305_blocks(st, m, want);
@@ -506,8 +739,35 @@ static inline void poly1305_update(poly1305_context *ctx, const unsigned char *m
   }
 }
 
+static Poly1305::Kernel p1305BestKernel() {
+#ifdef ZT_POLY1305_VECTOR
+  __builtin_cpu_init();
+  if ((__builtin_cpu_supports("avx512f"))&&(__builtin_cpu_supports("avx2")))
+    return Poly1305::KERNEL_AVX512_X8;
+  if (__builtin_cpu_supports("avx2"))
+    return Poly1305::KERNEL_AVX2_X4;
+#endif
+  return Poly1305::KERNEL_SCALAR;
+}
+
 } // anonymous namespace
 
+// Anything that runs before this initializer sees KERNEL_SCALAR, which is always safe
+Poly1305::Kernel Poly1305::_kernel = p1305BestKernel();
+
+bool Poly1305::kernelSupported(Kernel k)
+{
+  return ((unsigned int)k <= (unsigned int)p1305BestKernel());
+}
+
+bool Poly1305::setKernel(Kernel k)
+{
+  if (!kernelSupported(k))
+    return false;
+  _kernel = k;
+  return true;
+}
+
 void Poly1305::compute(void *auth,const void *data,unsigned int len,const void *key)
 {
   poly1305_context ctx;
@@ -516,4 +776,19 @@ void Poly1305::compute(void *auth,const void *data,unsigned int len,const void *
   poly1305_finish(&ctx,reinterpret_cast<unsigned char *>(auth));
 }
 
+void Poly1305::init(const void *key)
+{
+  poly1305_init(reinterpret_cast<poly1305_context *>(&_ctx),reinterpret_cast<const unsigned char *>(key));
+}
+
+void Poly1305::update(const void *data,unsigned int len)
+{
+  poly1305_update(reinterpret_cast<poly1305_context *>(&_ctx),reinterpret_cast<const unsigned char *>(data),(size_t)len);
+}
+
+void Poly1305::finish(void *auth)
+{
+  poly1305_finish(reinterpret_cast<poly1305_context *>(&_ctx),reinterpret_cast<unsigned char *>(auth));
+}
+
 } // namespace ZeroTier
@@ -27,6 +27,8 @@
 #ifndef ZT_POLY1305_HPP
 #define ZT_POLY1305_HPP
 
+#include <stddef.h>
+
 namespace ZeroTier {
 
 #define ZT_POLY1305_KEY_LEN 32
@@ -42,10 +44,28 @@ namespace ZeroTier {
  * In Packet this is done by using the first 32 bytes of the stream cipher
  * keystream as a one-time-use key. These 32 bytes are then discarded and
  * the packet is encrypted with the next N bytes.
+ *
+ * Instances compute a code incrementally so that a caller can interleave
+ * MAC and cipher passes over the same data. The static compute() method
+ * does all of it in one call.
  */
 class Poly1305
 {
 public:
+	/**
+	 * Block-processing kernels, in order of preference
+	 *
+	 * The vector kernels hash 4 or 8 blocks per step using precomputed
+	 * powers of r and are used for the bulk of longer messages. Anything
+	 * left over is finished by the scalar code.
+	 */
+	enum Kernel
+	{
+		KERNEL_SCALAR = 0,     // one block at a time (donna)
+		KERNEL_AVX2_X4 = 1,    // 4 blocks per step with AVX2
+		KERNEL_AVX512_X8 = 2   // 8 blocks per step with AVX-512F
+	};
+
 	/**
 	 * Compute a one-time authentication code
 	 *
@@ -55,6 +75,66 @@ public:
 	 * @param key 32-byte one-time use key to authenticate data (must not be reused)
 	 */
 	static void compute(void *auth,const void *data,unsigned int len,const void *key);
+
+	Poly1305() {}
+
+	/**
+	 * @param key 32-byte one-time use key to authenticate data (must not be reused)
+	 */
+	Poly1305(const void *key) { init(key); }
+
+	/**
+	 * Start computing a new code
+	 *
+	 * @param key 32-byte one-time use key to authenticate data (must not be reused)
+	 */
+	void init(const void *key);
+
+	/**
+	 * Add data to the code
+	 *
+	 * Splitting data into several calls gives the same code as one call as
+	 * long as every piece but the last is a multiple of 16 bytes long.
+	 * (Other splits still work but are slower.)
+	 *
+	 * @param data Data to authenticate
+	 * @param len Length of data in bytes
+	 */
+	void update(const void *data,unsigned int len);
+
+	/**
+	 * Finish and output code, after which init() must be called again before reuse
+	 *
+	 * @param auth Buffer to receive code -- MUST be 16 bytes in length
+	 */
+	void finish(void *auth);
+
+	/**
+	 * @return Kernel currently in use, selected from CPU features at startup
+	 */
+	static inline Kernel kernel() { return _kernel; }
+
+	/**
+	 * @param k Kernel to check
+	 * @return True if this build and this CPU can run k
+	 */
+	static bool kernelSupported(Kernel k);
+
+	/**
+	 * Override the kernel selected at startup (used by self-test and benchmarks)
+	 *
+	 * @param k Kernel to use
+	 * @return False if k is not supported (in which case nothing changes)
+	 */
+	static bool setKernel(Kernel k);
+
+private:
+	static Kernel _kernel;
+
+	struct {
+		size_t aligner;
+		unsigned char opaque[512]; // includes room for powers of r cached by the vector kernels
+	} _ctx;
 };
 
 } // namespace ZeroTier
@@ -64,8 +64,213 @@ public:
 static const _s20sseconsts _S20SSECONSTANTS;
 #endif
 
+#ifdef ZT_SALSA20_MULTIBLOCK
+
+#include <immintrin.h>
+
+// Word-sliced multi-block kernels: lane n of vector X[w] holds word w of block
+// n, so one quarter-round on X[] advances every block at once. Input state is
+// J[w * lanes + n] for word w (standard, not SSE-permuted, order) of block n,
+// so lanes can be consecutive blocks of one stream or blocks of different
+// streams. Each call produces exactly 4, 8, or 16 whole blocks, XORed with m
+// or written out as raw keystream if m is NULL.
+
+#define ZT_S20_QR(ADD,XOR,ROL,a,b,c,d) \
+	b = XOR(b,ROL(ADD(a,d),7)); \
+	c = XOR(c,ROL(ADD(b,a),9)); \
+	d = XOR(d,ROL(ADD(c,b),13)); \
+	a = XOR(a,ROL(ADD(d,c),18));
+
+#define ZT_S20_DOUBLEROUND(ADD,XOR,ROL,X) \
+	ZT_S20_QR(ADD,XOR,ROL,X[0],X[4],X[8],X[12]) \
+	ZT_S20_QR(ADD,XOR,ROL,X[5],X[9],X[13],X[1]) \
+	ZT_S20_QR(ADD,XOR,ROL,X[10],X[14],X[2],X[6]) \
+	ZT_S20_QR(ADD,XOR,ROL,X[15],X[3],X[7],X[11]) \
+	ZT_S20_QR(ADD,XOR,ROL,X[0],X[1],X[2],X[3]) \
+	ZT_S20_QR(ADD,XOR,ROL,X[5],X[6],X[7],X[4]) \
+	ZT_S20_QR(ADD,XOR,ROL,X[10],X[11],X[8],X[9]) \
+	ZT_S20_QR(ADD,XOR,ROL,X[15],X[12],X[13],X[14])
+
+// Fill J for consecutive blocks of one stream starting at block ctr
+static inline void _s20Lanes(const uint32_t *j,uint64_t ctr,uint32_t *J,unsigned int lanes)
+{
+	for(unsigned int w=0;w<16;++w) {
+		for(unsigned int b=0;b<lanes;++b)
+			J[(w * lanes) + b] = j[w];
+	}
+	for(unsigned int b=0;b<lanes;++b) {
+		J[(8 * lanes) + b] = (uint32_t)(ctr + b);
+		J[(9 * lanes) + b] = (uint32_t)((ctr + b) >> 32);
+	}
+}
+
+#define ZT_S20_ROL128(v,r) _mm_or_si128(_mm_slli_epi32((v),(r)),_mm_srli_epi32((v),32 - (r)))
+
+static void _s20_x4_sse2(const uint32_t *state,const uint8_t *m,uint8_t *c,unsigned int doubleRounds)
+{
+	__m128i J[16],X[16];
+	for(unsigned int w=0;w<16;++w)
+		X[w] = J[w] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + (w * 4)));
+
+	for(unsigned int r=doubleRounds;r>0;--r) {
+		ZT_S20_DOUBLEROUND(_mm_add_epi32,_mm_xor_si128,ZT_S20_ROL128,X)
+	}
+
+	// Transpose each group of four words back into block order and XOR
+	for(unsigned int w=0;w<16;w+=4) {
+		const __m128i a = _mm_add_epi32(X[w],J[w]);
+		const __m128i b = _mm_add_epi32(X[w+1],J[w+1]);
+		const __m128i cc = _mm_add_epi32(X[w+2],J[w+2]);
+		const __m128i d = _mm_add_epi32(X[w+3],J[w+3]);
+		const __m128i t0 = _mm_unpacklo_epi32(a,b);
+		const __m128i t1 = _mm_unpacklo_epi32(cc,d);
+		const __m128i t2 = _mm_unpackhi_epi32(a,b);
+		const __m128i t3 = _mm_unpackhi_epi32(cc,d);
+		const __m128i B[4] = { _mm_unpacklo_epi64(t0,t1),_mm_unpackhi_epi64(t0,t1),_mm_unpacklo_epi64(t2,t3),_mm_unpackhi_epi64(t2,t3) };
+		for(unsigned int k=0;k<4;++k) {
+			const unsigned int o = (k * 64) + (w * 4);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(c + o),(m) ? _mm_xor_si128(B[k],_mm_loadu_si128(reinterpret_cast<const __m128i *>(m + o))) : B[k]);
+		}
+	}
+}
+
+#define ZT_S20_ROL256(v,r) _mm256_or_si256(_mm256_slli_epi32((v),(r)),_mm256_srli_epi32((v),32 - (r)))
+
+__attribute__((target("avx2")))
+static void _s20_x8_avx2(const uint32_t *state,const uint8_t *m,uint8_t *c,unsigned int doubleRounds)
+{
+	__m256i J[16],X[16];
+	for(unsigned int w=0;w<16;++w)
+		X[w] = J[w] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state + (w * 8)));
+
+	for(unsigned int r=doubleRounds;r>0;--r) {
+		ZT_S20_DOUBLEROUND(_mm256_add_epi32,_mm256_xor_si256,ZT_S20_ROL256,X)
+	}
+
+	// Transpose within each 128-bit lane (blocks 0-3 low, 4-7 high), then
+	// pair up word groups 0-3/4-7 and 8-11/12-15 into 32-byte half blocks.
+	__m256i B[4][4];
+	for(unsigned int g=0;g<4;++g) {
+		const unsigned int w = g * 4;
+		const __m256i a = _mm256_add_epi32(X[w],J[w]);
+		const __m256i b = _mm256_add_epi32(X[w+1],J[w+1]);
+		const __m256i cc = _mm256_add_epi32(X[w+2],J[w+2]);
+		const __m256i d = _mm256_add_epi32(X[w+3],J[w+3]);
+		const __m256i t0 = _mm256_unpacklo_epi32(a,b);
+		const __m256i t1 = _mm256_unpacklo_epi32(cc,d);
+		const __m256i t2 = _mm256_unpackhi_epi32(a,b);
+		const __m256i t3 = _mm256_unpackhi_epi32(cc,d);
+		B[g][0] = _mm256_unpacklo_epi64(t0,t1);
+		B[g][1] = _mm256_unpackhi_epi64(t0,t1);
+		B[g][2] = _mm256_unpacklo_epi64(t2,t3);
+		B[g][3] = _mm256_unpackhi_epi64(t2,t3);
+	}
+	for(unsigned int k=0;k<4;++k) {
+		for(unsigned int h=0;h<2;++h) {
+			const __m256i lo4 = _mm256_permute2x128_si256(B[h*2][k],B[(h*2)+1][k],0x20);
+			const __m256i hi4 = _mm256_permute2x128_si256(B[h*2][k],B[(h*2)+1][k],0x31);
+			const unsigned int o0 = (k * 64) + (h * 32);
+			const unsigned int o1 = o0 + 256;
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(c + o0),(m) ? _mm256_xor_si256(lo4,_mm256_loadu_si256(reinterpret_cast<const __m256i *>(m + o0))) : lo4);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(c + o1),(m) ? _mm256_xor_si256(hi4,_mm256_loadu_si256(reinterpret_cast<const __m256i *>(m + o1))) : hi4);
+		}
+	}
+}
+
+// GCC's AVX-512 headers pass deliberately undefined vectors to builtins, which -Wall flags
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#define ZT_S20_ROL512(v,r) _mm512_rol_epi32((v),(r))
+
+__attribute__((target("avx512f")))
+static void _s20_x16_avx512(const uint32_t *state,const uint8_t *m,uint8_t *c,unsigned int doubleRounds)
+{
+	__m512i J[16],X[16];
+	for(unsigned int w=0;w<16;++w)
+		X[w] = J[w] = _mm512_loadu_si512(state + (w * 16));
+
+	for(unsigned int r=doubleRounds;r>0;--r) {
+		ZT_S20_DOUBLEROUND(_mm512_add_epi32,_mm512_xor_si512,ZT_S20_ROL512,X)
+	}
+
+	// Transpose within each 128-bit lane L (blocks 4L..4L+3), then gather the
+	// four word groups of block 4L+k from lane L of each group's vector.
+	__m512i B[4][4];
+	for(unsigned int g=0;g<4;++g) {
+		const unsigned int w = g * 4;
+		const __m512i a = _mm512_add_epi32(X[w],J[w]);
+		const __m512i b = _mm512_add_epi32(X[w+1],J[w+1]);
+		const __m512i cc = _mm512_add_epi32(X[w+2],J[w+2]);
+		const __m512i d = _mm512_add_epi32(X[w+3],J[w+3]);
+		const __m512i t0 = _mm512_unpacklo_epi32(a,b);
+		const __m512i t1 = _mm512_unpacklo_epi32(cc,d);
+		const __m512i t2 = _mm512_unpackhi_epi32(a,b);
+		const __m512i t3 = _mm512_unpackhi_epi32(cc,d);
+		B[g][0] = _mm512_unpacklo_epi64(t0,t1);
+		B[g][1] = _mm512_unpackhi_epi64(t0,t1);
+		B[g][2] = _mm512_unpacklo_epi64(t2,t3);
+		B[g][3] = _mm512_unpackhi_epi64(t2,t3);
+	}
+	for(unsigned int k=0;k<4;++k) {
+		const __m512i p = _mm512_shuffle_i32x4(B[0][k],B[1][k],_MM_SHUFFLE(1,0,1,0));
+		const __m512i q = _mm512_shuffle_i32x4(B[0][k],B[1][k],_MM_SHUFFLE(3,2,3,2));
+		const __m512i r = _mm512_shuffle_i32x4(B[2][k],B[3][k],_MM_SHUFFLE(1,0,1,0));
+		const __m512i s = _mm512_shuffle_i32x4(B[2][k],B[3][k],_MM_SHUFFLE(3,2,3,2));
+		const __m512i blk[4] = {
+			_mm512_shuffle_i32x4(p,r,_MM_SHUFFLE(2,0,2,0)),
+			_mm512_shuffle_i32x4(p,r,_MM_SHUFFLE(3,1,3,1)),
+			_mm512_shuffle_i32x4(q,s,_MM_SHUFFLE(2,0,2,0)),
+			_mm512_shuffle_i32x4(q,s,_MM_SHUFFLE(3,1,3,1))
+		};
+		for(unsigned int l=0;l<4;++l) {
+			const unsigned int o = ((l * 4) + k) * 64;
+			_mm512_storeu_si512(c + o,(m) ? _mm512_xor_si512(blk[l],_mm512_loadu_si512(m + o)) : blk[l]);
+		}
+	}
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // ZT_SALSA20_MULTIBLOCK
+
 namespace ZeroTier {
 
+static Salsa20::Kernel _s20BestKernel()
+{
+#ifdef ZT_SALSA20_MULTIBLOCK
+	__builtin_cpu_init();
+	if ((__builtin_cpu_supports("avx512f"))&&(__builtin_cpu_supports("avx2")))
+		return Salsa20::KERNEL_AVX512_X16;
+	if (__builtin_cpu_supports("avx2"))
+		return Salsa20::KERNEL_AVX2_X8;
+	return Salsa20::KERNEL_SSE2_X4;
+#else
+	return Salsa20::KERNEL_BASELINE;
+#endif
+}
+
+// Anything that runs before this initializer sees KERNEL_BASELINE, which is always safe
+Salsa20::Kernel Salsa20::_kernel = _s20BestKernel();
+
+bool Salsa20::kernelSupported(Kernel k)
+{
+	return ((unsigned int)k <= (unsigned int)_s20BestKernel());
+}
+
+bool Salsa20::setKernel(Kernel k)
+{
+	if (!kernelSupported(k))
+		return false;
+	_kernel = k;
+	return true;
+}
+
 void Salsa20::init(const void *key,const void *iv)
 {
 #ifdef ZT_SALSA20_SSE
@@ -121,6 +326,11 @@ void Salsa20::crypt12(const void *in,void *out,unsigned int bytes)
 	uint32_t j0, j1, j2, j3, j4, j5, j6, j7, j8, j9, j10, j11, j12, j13, j14, j15;
 #endif
 
+#ifdef ZT_SALSA20_MULTIBLOCK
+	if ((bytes >= 256)&&(_kernel != KERNEL_BASELINE))
+		_multiBlock(m,c,bytes,6);
+#endif
+
 	if (!bytes)
 		return;
 
@@ -620,6 +830,11 @@ void Salsa20::crypt20(const void *in,void *out,unsigned int bytes)
 	uint32_t j0, j1, j2, j3, j4, j5, j6, j7, j8, j9, j10, j11, j12, j13, j14, j15;
 #endif
 
+#ifdef ZT_SALSA20_MULTIBLOCK
+	if ((bytes >= 256)&&(_kernel != KERNEL_BASELINE))
+		_multiBlock(m,c,bytes,10);
+#endif
+
 	if (!bytes)
 		return;
 
@@ -1338,4 +1553,156 @@ void Salsa20::crypt20(const void *in,void *out,unsigned int bytes)
 	}
 }
 
+void Salsa20::setBlockCounter(uint64_t b)
+{
+#ifdef ZT_SALSA20_SSE
+	_state.i[8] = (uint32_t)b;
+	_state.i[5] = (uint32_t)(b >> 32); // state reordered for SSE
+#else
+	_state.i[8] = (uint32_t)b;
+	_state.i[9] = (uint32_t)(b >> 32);
+#endif
+}
+
+void Salsa20::keystream12(const Salsa20 *const *s,const uint64_t *blockNo,uint8_t *out,unsigned int n)
+{
+#ifdef ZT_SALSA20_MULTIBLOCK
+	const Kernel k = _kernel;
+	if (k != KERNEL_BASELINE) {
+		uint32_t J[16 * 16],j[16];
+		while (n) {
+			// Widest kernel that won't waste more than half its lanes
+			unsigned int lanes = 4;
+			if ((k >= KERNEL_AVX512_X16)&&(n > 8))
+				lanes = 16;
+			else if ((k >= KERNEL_AVX2_X8)&&(n > 4))
+				lanes = 8;
+			const unsigned int used = (n < lanes) ? n : lanes;
+			for(unsigned int b=0;b<lanes;++b) {
+				const unsigned int src = (b < used) ? b : (used - 1); // pad by repeating the last one
+				s[src]->_standardState(j);
+				j[8] = (uint32_t)blockNo[src];
+				j[9] = (uint32_t)(blockNo[src] >> 32);
+				for(unsigned int w=0;w<16;++w)
+					J[(w * lanes) + b] = j[w];
+			}
+			if (used == lanes) {
+				if (lanes == 16)
+					_s20_x16_avx512(J,(const uint8_t *)0,out,6);
+				else if (lanes == 8)
+					_s20_x8_avx2(J,(const uint8_t *)0,out,6);
+				else _s20_x4_sse2(J,(const uint8_t *)0,out,6);
+			} else {
+				uint8_t tmp[64 * 16];
+				if (lanes == 16)
+					_s20_x16_avx512(J,(const uint8_t *)0,tmp,6);
+				else if (lanes == 8)
+					_s20_x8_avx2(J,(const uint8_t *)0,tmp,6);
+				else _s20_x4_sse2(J,(const uint8_t *)0,tmp,6);
+				memcpy(out,tmp,64 * used);
+			}
+			s += used;
+			blockNo += used;
+			out += 64 * used;
+			n -= used;
+		}
+		return;
+	}
+#endif
+	for(unsigned int i=0;i<n;++i) {
+		Salsa20 tmp(*(s[i]));
+		tmp.setBlockCounter(blockNo[i]);
+		memset(out,0,64);
+		tmp.crypt12(out,out,64);
+		out += 64;
+	}
+}
+
+void Salsa20::_standardState(uint32_t j[16]) const
+{
+#ifdef ZT_SALSA20_SSE
+	// Undo the permutation done by init()
+	j[0] = _state.i[0];
+	j[1] = _state.i[13];
+	j[2] = _state.i[10];
+	j[3] = _state.i[7];
+	j[4] = _state.i[4];
+	j[5] = _state.i[1];
+	j[6] = _state.i[14];
+	j[7] = _state.i[11];
+	j[8] = _state.i[8];
+	j[9] = _state.i[5];
+	j[10] = _state.i[2];
+	j[11] = _state.i[15];
+	j[12] = _state.i[12];
+	j[13] = _state.i[9];
+	j[14] = _state.i[6];
+	j[15] = _state.i[3];
+#else
+	for(unsigned int w=0;w<16;++w)
+		j[w] = _state.i[w];
+#endif
+}
+
+#ifdef ZT_SALSA20_MULTIBLOCK
+void Salsa20::_multiBlock(const uint8_t *&m,uint8_t *&c,unsigned int &bytes,unsigned int doubleRounds)
+{
+	uint32_t j[16],J[16 * 16];
+	_standardState(j);
+	uint64_t ctr = ((uint64_t)j[9] << 32) | (uint64_t)j[8];
+
+	const Kernel k = _kernel;
+	if ((k >= KERNEL_AVX512_X16)&&(bytes >= 1024)) {
+		_s20Lanes(j,ctr,J,16);
+		for(;;) {
+			_s20_x16_avx512(J,m,c,doubleRounds);
+			ctr += 16;
+			m += 1024;
+			c += 1024;
+			bytes -= 1024;
+			if (bytes < 1024)
+				break;
+			for(unsigned int b=0;b<16;++b) {
+				J[(8 * 16) + b] = (uint32_t)(ctr + b);
+				J[(9 * 16) + b] = (uint32_t)((ctr + b) >> 32);
+			}
+		}
+	}
+	if ((k >= KERNEL_AVX2_X8)&&(bytes >= 512)) {
+		_s20Lanes(j,ctr,J,8);
+		for(;;) {
+			_s20_x8_avx2(J,m,c,doubleRounds);
+			ctr += 8;
+			m += 512;
+			c += 512;
+			bytes -= 512;
+			if (bytes < 512)
+				break;
+			for(unsigned int b=0;b<8;++b) {
+				J[(8 * 8) + b] = (uint32_t)(ctr + b);
+				J[(9 * 8) + b] = (uint32_t)((ctr + b) >> 32);
+			}
+		}
+	}
+	if (bytes >= 256) {
+		_s20Lanes(j,ctr,J,4);
+		for(;;) {
+			_s20_x4_sse2(J,m,c,doubleRounds);
+			ctr += 4;
+			m += 256;
+			c += 256;
+			bytes -= 256;
+			if (bytes < 256)
+				break;
+			for(unsigned int b=0;b<4;++b) {
+				J[(8 * 4) + b] = (uint32_t)(ctr + b);
+				J[(9 * 4) + b] = (uint32_t)((ctr + b) >> 32);
+			}
+		}
+	}
+
+	setBlockCounter(ctr);
+}
+#endif // ZT_SALSA20_MULTIBLOCK
+
 } // namespace ZeroTier
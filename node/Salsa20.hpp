@@ -23,6 +23,11 @@
 #include <emmintrin.h>
 #endif // ZT_SALSA20_SSE
 
+// Multi-block kernels are compiled with per-function target attributes and picked at runtime
+#if defined(ZT_SALSA20_SSE) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && (!defined(ZT_SALSA20_NO_MULTIBLOCK))
+#define ZT_SALSA20_MULTIBLOCK 1
+#endif
+
 namespace ZeroTier {
 
 /**
@@ -31,6 +36,21 @@ namespace ZeroTier {
 class Salsa20
 {
 public:
+	/**
+	 * Keystream kernels, in order of preference
+	 *
+	 * The multi-block kernels compute 4, 8, or 16 blocks at once and are
+	 * used for the bulk of any message of 256 bytes or more. The remainder
+	 * and shorter messages always go through the one-block-at-a-time code.
+	 */
+	enum Kernel
+	{
+		KERNEL_BASELINE = 0,    // one block at a time (SSE2 or plain C)
+		KERNEL_SSE2_X4 = 1,     // 4 blocks in parallel with SSE2
+		KERNEL_AVX2_X8 = 2,     // 8 blocks in parallel with AVX2
+		KERNEL_AVX512_X16 = 3   // 16 blocks in parallel with AVX-512F
+	};
+
 	Salsa20() {}
 	~Salsa20() { Utils::burn(&_state,sizeof(_state)); }
 
@@ -145,7 +165,55 @@ public:
 	 */
 	void crypt20(const void *in,void *out,unsigned int bytes);
 
+	/**
+	 * Set the position in the keystream
+	 *
+	 * @param b Block counter (position in 64-byte blocks)
+	 */
+	void setBlockCounter(uint64_t b);
+
+	/**
+	 * Generate Salsa20/12 keystream blocks from several independent streams at once
+	 *
+	 * This keeps vector lanes full when each stream only needs a block or
+	 * two, e.g. one-time MAC keys and short payloads of many packets. The
+	 * states themselves are not modified.
+	 *
+	 * @param s Cipher state for each block (the same state may appear more than once)
+	 * @param blockNo Block counter for each block
+	 * @param out Output buffer, receives 64 bytes of keystream per block
+	 * @param n Number of blocks
+	 */
+	static void keystream12(const Salsa20 *const *s,const uint64_t *blockNo,uint8_t *out,unsigned int n);
+
+	/**
+	 * @return Kernel currently in use, selected from CPU features at startup
+	 */
+	static inline Kernel kernel() { return _kernel; }
+
+	/**
+	 * @param k Kernel to check
+	 * @return True if this build and this CPU can run k
+	 */
+	static bool kernelSupported(Kernel k);
+
+	/**
+	 * Override the kernel selected at startup (used by self-test and benchmarks)
+	 *
+	 * @param k Kernel to use
+	 * @return False if k is not supported (in which case nothing changes)
+	 */
+	static bool setKernel(Kernel k);
+
 private:
+	void _standardState(uint32_t j[16]) const;
+
+#ifdef ZT_SALSA20_MULTIBLOCK
+	void _multiBlock(const uint8_t *&m,uint8_t *&c,unsigned int &bytes,unsigned int doubleRounds);
+#endif
+
+	static Kernel _kernel;
+
 	union {
 #ifdef ZT_SALSA20_SSE
 		__m128i v[4];
@@ -47,6 +47,11 @@ public:
 	SharedPtr(T *obj) : _ptr(obj) { ++obj->__refCount; }
 	SharedPtr(const SharedPtr &sp) : _ptr(sp._getAndInc()) {}
 
+	/**
+	 * Take over another pointer's reference, leaving it NULL (no ref count overhead)
+	 */
+	SharedPtr(SharedPtr &&sp) : _ptr(sp._ptr) { sp._ptr = (T *)0; }
+
 	~SharedPtr()
 	{
 		if (_ptr) {
@@ -68,6 +73,20 @@ public:
 		return *this;
 	}
 
+	inline SharedPtr &operator=(SharedPtr &&sp)
+	{
+		if (this != &sp) {
+			T *p = sp._ptr;
+			sp._ptr = (T *)0;
+			if (_ptr) {
+				if (--_ptr->__refCount <= 0)
+					delete _ptr;
+			}
+			_ptr = p;
+		}
+		return *this;
+	}
+
 	/**
 	 * Set to a naked pointer and increment its reference count
 	 *
@@ -119,7 +138,7 @@ public:
 	/**
 	 * @return Number of references according to this object's ref count or 0 if NULL
 	 */
-	inline int references()
+	inline int references() const
 	{
 		if (_ptr)
 			return _ptr->__refCount.load();
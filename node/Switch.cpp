@@ -51,8 +51,28 @@ Switch::Switch(const RuntimeEnvironment *renv) :
 	RR(renv),
 	_lastBeaconResponse(0),
 	_lastCheckedQueues(0),
+	_rxQueue(32),
+	_rxQueueSources(16),
+	_rxQueueOldest((RXQueueEntry *)0),
+	_rxQueueNewest((RXQueueEntry *)0),
+	_rxQueueEvicted(0),
+	_rxQueueExpired(0),
+	_txQueue(32),
+	_txQueueSize(0),
 	_lastUniteAttempt(8) // only really used on root servers and upstreams, and it'll grow there just fine
 {
+	Utils::getSecureRandom(_qosFlowKey,sizeof(_qosFlowKey));
+}
+
+Switch::~Switch()
+{
+	Hashtable< uint64_t,RXQueueEntry * >::Iterator i(_rxQueue);
+	uint64_t *k = (uint64_t *)0;
+	RXQueueEntry **v = (RXQueueEntry **)0;
+	while (i.next(k,v))
+		delete *v;
+	for(std::vector< RXQueueEntry * >::iterator rq(_rxQueueFree.begin());rq!=_rxQueueFree.end();++rq)
+		delete *rq;
 }
 
 void Switch::onRemotePacket(void *tPtr,const int64_t localSocket,const InetAddress &fromAddr,const void *data,unsigned int len)
@@ -100,12 +120,13 @@ void Switch::onRemotePacket(void *tPtr,const int64_t localSocket,const InetAddre
 
 						// Note: we don't bother initiating NAT-t for fragments, since heads will set that off.
 						// It wouldn't hurt anything, just redundant and unnecessary.
-						SharedPtr<Peer> relayTo = RR->topology->getPeer(tPtr,destination);
+						const Epoch::Guard _g(RR->topology->epoch());
+						const BorrowedPtr<Peer> relayTo(RR->topology->getPeer(tPtr,destination,_g));
 						if ((!relayTo)||(!relayTo->sendDirect(tPtr,fragment.data(),fragment.size(),now,false))) {
 							// Don't know peer or no direct path -- so relay via someone upstream
-							relayTo = RR->topology->getUpstreamPeer();
-							if (relayTo)
-								relayTo->sendDirect(tPtr,fragment.data(),fragment.size(),now,true);
+							const SharedPtr<Peer> upstream(RR->topology->getUpstreamPeer());
+							if (upstream)
+								upstream->sendDirect(tPtr,fragment.data(),fragment.size(),now,true);
 						}
 					}
 				} else {
@@ -114,42 +135,26 @@ void Switch::onRemotePacket(void *tPtr,const int64_t localSocket,const InetAddre
 					const unsigned int fragmentNumber = fragment.fragmentNumber();
 					const unsigned int totalFragments = fragment.totalFragments();
 
-					if ((totalFragments <= ZT_MAX_PACKET_FRAGMENTS)&&(fragmentNumber < ZT_MAX_PACKET_FRAGMENTS)&&(fragmentNumber > 0)&&(totalFragments > 1)) {
+					if ((totalFragments <= ZT_MAX_PACKET_FRAGMENTS)&&(fragmentNumber < totalFragments)&&(fragmentNumber > 0)) {
 						// Fragment appears basically sane. Its fragment number must be
-						// 1 or more, since a Packet with fragmented bit set is fragment 0.
-						// Total fragments must be more than 1, otherwise why are we
-						// seeing a Packet::Fragment?
-
-						RXQueueEntry *const rq = _findRXQueueEntry(fragmentPacketId);
-						Mutex::Lock rql(rq->lock);
-						if (rq->packetId != fragmentPacketId) {
-							// No packet found, so we received a fragment without its head.
-
-							rq->timestamp = now;
-							rq->packetId = fragmentPacketId;
-							rq->frags[fragmentNumber - 1] = fragment;
-							rq->totalFragments = totalFragments; // total fragment count is known
-							rq->haveFragments = 1 << fragmentNumber; // we have only this fragment
-							rq->complete = false;
-						} else if (!(rq->haveFragments & (1 << fragmentNumber))) {
-							// We have other fragments and maybe the head, so add this one and check
-
-							rq->frags[fragmentNumber - 1] = fragment;
-							rq->totalFragments = totalFragments;
-
-							if (Utils::countBits(rq->haveFragments |= (1 << fragmentNumber)) == totalFragments) {
-								// We have all fragments -- assemble and process full Packet
-
-								for(unsigned int f=1;f<totalFragments;++f)
-									rq->frag0.append(rq->frags[f - 1].payload(),rq->frags[f - 1].payloadLength());
-
-								if (rq->frag0.tryDecode(RR,tPtr)) {
-									rq->timestamp = 0; // packet decoded, free entry
-								} else {
-									rq->complete = true; // set complete flag but leave entry since it probably needs WHOIS or something
-								}
+						// 1 or more, since a Packet with fragmented bit set is fragment 0,
+						// and less than its total, which therefore must be more than 1.
+						// addFragment() also drops it if its total disagrees with one
+						// already seen for this packet, as well as duplicates.
+
+						RXQueueEntry *done = (RXQueueEntry *)0;
+						{
+							Mutex::Lock _l(_rxQueue_m);
+							RXQueueEntry **const e = _rxQueue.get(fragmentPacketId);
+							RXQueueEntry *const rq = (e) ? *e : _rxQueueNew(now,fragmentPacketId,fromAddr.hashCode());
+							if (rq->addFragment(fragmentNumber,totalFragments,fragment.payload(),fragment.payloadLength())) {
+								// We have all fragments, take the entry out of the table so we can decode without holding the lock
+								_rxQueueRemove(rq);
+								done = rq;
 							}
-						} // else this is a duplicate fragment, ignore
+						}
+						if (done)
+							_rxQueueDecode(tPtr,now,done,true);
 					}
 				}
 
@@ -171,7 +176,8 @@ void Switch::onRemotePacket(void *tPtr,const int64_t localSocket,const InetAddre
 
 					if (packet.hops() < ZT_RELAY_MAX_HOPS) {
 						packet.incrementHops();
-						SharedPtr<Peer> relayTo = RR->topology->getPeer(tPtr,destination);
+						const Epoch::Guard _g(RR->topology->epoch());
+						const BorrowedPtr<Peer> relayTo(RR->topology->getPeer(tPtr,destination,_g));
 						if ((relayTo)&&(relayTo->sendDirect(tPtr,packet.data(),packet.size(),now,false))) {
 							if ((source != RR->identity.address())&&(_shouldUnite(now,source,destination))) {
 								const SharedPtr<Peer> sourcePeer(RR->topology->getPeer(tPtr,source));
@@ -179,12 +185,12 @@ void Switch::onRemotePacket(void *tPtr,const int64_t localSocket,const InetAddre
 									relayTo->introduce(tPtr,now,sourcePeer);
 							}
 						} else {
-							relayTo = RR->topology->getUpstreamPeer();
-							if ((relayTo)&&(relayTo->address() != source)) {
-								if (relayTo->sendDirect(tPtr,packet.data(),packet.size(),now,true)) {
+							const SharedPtr<Peer> upstream(RR->topology->getUpstreamPeer());
+							if ((upstream)&&(upstream->address() != source)) {
+								if (upstream->sendDirect(tPtr,packet.data(),packet.size(),now,true)) {
 									const SharedPtr<Peer> sourcePeer(RR->topology->getPeer(tPtr,source));
 									if (sourcePeer)
-										relayTo->introduce(tPtr,now,sourcePeer);
+										upstream->introduce(tPtr,now,sourcePeer);
 								}
 							}
 						}
@@ -203,49 +209,39 @@ void Switch::onRemotePacket(void *tPtr,const int64_t localSocket,const InetAddre
 						((uint64_t)reinterpret_cast<const uint8_t *>(data)[7])
 					);
 
-					RXQueueEntry *const rq = _findRXQueueEntry(packetId);
-					Mutex::Lock rql(rq->lock);
-					if (rq->packetId != packetId) {
-						// If we have no other fragments yet, create an entry and save the head
-
-						rq->timestamp = now;
-						rq->packetId = packetId;
-						rq->frag0.init(data,len,path,now);
-						rq->totalFragments = 0;
-						rq->haveFragments = 1;
-						rq->complete = false;
-					} else if (!(rq->haveFragments & 1)) {
-						// If we have other fragments but no head, see if we are complete with the head
-
-						if ((rq->totalFragments > 1)&&(Utils::countBits(rq->haveFragments |= 1) == rq->totalFragments)) {
-							// We have all fragments -- assemble and process full Packet
-
+					RXQueueEntry *done = (RXQueueEntry *)0;
+					{
+						Mutex::Lock _l(_rxQueue_m);
+						RXQueueEntry **const e = _rxQueue.get(packetId);
+						if (!e) {
+							// If we have no other fragments yet, create an entry and save the head
+							RXQueueEntry *const rq = _rxQueueNew(now,packetId,fromAddr.hashCode());
 							rq->frag0.init(data,len,path,now);
-							for(unsigned int f=1;f<rq->totalFragments;++f)
-								rq->frag0.append(rq->frags[f - 1].payload(),rq->frags[f - 1].payloadLength());
-
-							if (rq->frag0.tryDecode(RR,tPtr)) {
-								rq->timestamp = 0; // packet decoded, free entry
-							} else {
-								rq->complete = true; // set complete flag but leave entry since it probably needs WHOIS or something
-							}
-						} else {
-							// Still waiting on more fragments, but keep the head
+							rq->addHead();
+						} else if (!((*e)->haveFragments & 1)) {
+							// If we have other fragments but no head, see if we are complete with the head
+							RXQueueEntry *const rq = *e;
 							rq->frag0.init(data,len,path,now);
-						}
-					} // else this is a duplicate head, ignore
+							if (rq->addHead()) {
+								_rxQueueRemove(rq);
+								done = rq;
+							}
+						} // else this is a duplicate head, ignore
+					}
+					if (done)
+						_rxQueueDecode(tPtr,now,done,true);
 				} else {
 					// Packet is unfragmented, so just process it
 					IncomingPacket packet(data,len,path,now);
 					if (!packet.tryDecode(RR,tPtr)) {
-						RXQueueEntry *const rq = _nextRXQueueEntry();
-						Mutex::Lock rql(rq->lock);
-						rq->timestamp = now;
-						rq->packetId = packet.packetId();
-						rq->frag0 = packet;
-						rq->totalFragments = 1;
-						rq->haveFragments = 1;
-						rq->complete = true;
+						Mutex::Lock _l(_rxQueue_m);
+						if (!_rxQueue.contains(packet.packetId())) {
+							RXQueueEntry *const rq = _rxQueueNew(now,packet.packetId(),fromAddr.hashCode());
+							rq->frag0 = packet;
+							rq->totalFragments = 1;
+							rq->haveFragments = 1;
+							rq->complete = true;
+						}
 					}
 				}
 
@@ -429,7 +425,7 @@ void Switch::onLocalEthernet(void *tPtr,const SharedPtr<Network> &network,const
 			outp.append(data,len);
 			if (!network->config().disableCompression())
 				outp.compress();
-			aqm_enqueue(tPtr,network,outp,true,qosBucket);
+			aqm_enqueue(tPtr,network,outp,true,qosBucket,(network->qosEnabled()) ? qosFlowId(from,to,etherType,data,len) : 0);
 		} else {
 			Packet outp(toZT,RR->identity.address(),Packet::VERB_FRAME);
 			outp.append(network->id());
@@ -437,7 +433,7 @@ void Switch::onLocalEthernet(void *tPtr,const SharedPtr<Network> &network,const
 			outp.append(data,len);
 			if (!network->config().disableCompression())
 				outp.compress();
-			aqm_enqueue(tPtr,network,outp,true,qosBucket);
+			aqm_enqueue(tPtr,network,outp,true,qosBucket,(network->qosEnabled()) ? qosFlowId(from,to,etherType,data,len) : 0);
 		}
 	} else {
 		// Destination is bridged behind a remote peer
@@ -493,7 +489,7 @@ void Switch::onLocalEthernet(void *tPtr,const SharedPtr<Network> &network,const
 				outp.append(data,len);
 				if (!network->config().disableCompression())
 					outp.compress();
-				aqm_enqueue(tPtr,network,outp,true,qosBucket);
+				aqm_enqueue(tPtr,network,outp,true,qosBucket,(network->qosEnabled()) ? qosFlowId(from,to,etherType,data,len) : 0);
 			} else {
 				RR->t->outgoingNetworkFrameDropped(tPtr,network,from,to,etherType,vlanId,len,"filter blocked (bridge replication)");
 			}
@@ -501,103 +497,69 @@ void Switch::onLocalEthernet(void *tPtr,const SharedPtr<Network> &network,const
 	}
 }
 
-void Switch::aqm_enqueue(void *tPtr, const SharedPtr<Network> &network, Packet &packet,bool encrypt,int qosBucket)
+void Switch::aqm_enqueue(void *tPtr, const SharedPtr<Network> &network, Packet &packet,bool encrypt,int qosBucket,unsigned long flowId)
 {
-	if(!network->qosEnabled()) {
-		send(tPtr, packet, encrypt);
-		return;
-	}
-	NetworkQoSControlBlock *nqcb = _netQueueControlBlock[network->id()];
-	if (!nqcb) {
-		// DEBUG_INFO("creating network QoS control block (NQCB) for network %llx", network->id());
-		nqcb = new NetworkQoSControlBlock();
-		_netQueueControlBlock[network->id()] = nqcb;
-		// Initialize ZT_QOS_NUM_BUCKETS queues and place them in the INACTIVE list
-		// These queues will be shuffled between the new/old/inactive lists by the enqueue/dequeue algorithm
-		for (int i=0; i<ZT_QOS_NUM_BUCKETS; i++) {
-			nqcb->inactiveQueues.push_back(new ManagedQueue(i));
-		}
-	}
-
-	if (packet.verb() != Packet::VERB_FRAME && packet.verb() != Packet::VERB_EXT_FRAME) {
-		// DEBUG_INFO("skipping, no QoS for this packet, verb=%x", packet.verb());
+	if ((!network->qosEnabled())||((packet.verb() != Packet::VERB_FRAME)&&(packet.verb() != Packet::VERB_EXT_FRAME))) {
 		// just send packet normally, no QoS for ZT protocol traffic
 		send(tPtr, packet, encrypt);
-	} 
-
-	_aqm_m.lock();
-
-	// Enqueue packet and move queue to appropriate list
-
-	const Address dest(packet.destination());
-	TXQueueEntry *txEntry = new TXQueueEntry(dest,RR->node->now(),packet,encrypt);
-	
-	ManagedQueue *selectedQueue = nullptr;
-	for (size_t i=0; i<ZT_QOS_NUM_BUCKETS; i++) {
-		if (i < nqcb->oldQueues.size()) { // search old queues first (I think this is best since old would imply most recent usage of the queue)
-			if (nqcb->oldQueues[i]->id == qosBucket) {
-				selectedQueue = nqcb->oldQueues[i];
-			}
-		} if (i < nqcb->newQueues.size()) { // search new queues (this would imply not often-used queues)
-			if (nqcb->newQueues[i]->id == qosBucket) {
-				selectedQueue = nqcb->newQueues[i];
-			}
-		} if (i < nqcb->inactiveQueues.size()) { // search inactive queues
-			if (nqcb->inactiveQueues[i]->id == qosBucket) {
-				selectedQueue = nqcb->inactiveQueues[i];
-				// move queue to end of NEW queue list
-				selectedQueue->byteCredit = ZT_QOS_QUANTUM;
-				// DEBUG_INFO("moving q=%p from INACTIVE to NEW list", selectedQueue);
-				nqcb->newQueues.push_back(selectedQueue);
-				nqcb->inactiveQueues.erase(nqcb->inactiveQueues.begin() + i);
-			}
-		}
-	}
-	if (!selectedQueue) {
 		return;
 	}
 
-	selectedQueue->q.push_back(txEntry);
-	selectedQueue->byteLength+=txEntry->packet.payloadLength();
-	nqcb->_currEnqueuedPackets++;
+	SharedPtr<NetworkQoSControlBlock> nqcb;
+	{
+		Mutex::Lock _l(_aqm_m);
+		SharedPtr<NetworkQoSControlBlock> &n = _netQueueControlBlock[network->id()];
+		if (!n)
+			n.set(new NetworkQoSControlBlock());
+		nqcb = n;
+	}
 
-	// DEBUG_INFO("nq=%2lu, oq=%2lu, iq=%2lu, nqcb.size()=%3d, bucket=%2d, q=%p", nqcb->newQueues.size(), nqcb->oldQueues.size(), nqcb->inactiveQueues.size(), nqcb->_currEnqueuedPackets, qosBucket, selectedQueue);
+	if ((qosBucket < 0)||(qosBucket >= ZT_QOS_NUM_BUCKETS))
+		qosBucket = ZT_QOS_DEFAULT_BUCKET;
 
-	// Drop a packet if necessary
-	ManagedQueue *selectedQueueToDropFrom = nullptr;
-	if (nqcb->_currEnqueuedPackets > ZT_QOS_MAX_ENQUEUED_PACKETS)
 	{
-		// DEBUG_INFO("too many enqueued packets (%d), finding packet to drop", nqcb->_currEnqueuedPackets);
-		int maxQueueLength = 0;
-		for (size_t i=0; i<ZT_QOS_NUM_BUCKETS; i++) {
-			if (i < nqcb->oldQueues.size()) {
-				if (nqcb->oldQueues[i]->byteLength > maxQueueLength) {
-					maxQueueLength = nqcb->oldQueues[i]->byteLength;
-					selectedQueueToDropFrom = nqcb->oldQueues[i];
-				}
-			} if (i < nqcb->newQueues.size()) {
-				if (nqcb->newQueues[i]->byteLength > maxQueueLength) {
-					maxQueueLength = nqcb->newQueues[i]->byteLength;
-					selectedQueueToDropFrom = nqcb->newQueues[i];
-				}
-			} if (i < nqcb->inactiveQueues.size()) {
-				if (nqcb->inactiveQueues[i]->byteLength > maxQueueLength) {
-					maxQueueLength = nqcb->inactiveQueues[i]->byteLength;
-					selectedQueueToDropFrom = nqcb->inactiveQueues[i];
+		Mutex::Lock _l(nqcb->lock);
+
+		// Enqueue packet in its flow and schedule the flow and its bucket if they are idle
+
+		QoSBucket *const bucket = &(nqcb->buckets[qosBucket]);
+		ManagedQueue *const flow = &(bucket->flows[flowId % ZT_QOS_FLOWS_PER_BUCKET]);
+		TXQueueEntry *const txEntry = new TXQueueEntry(packet.destination(),RR->node->now(),packet,encrypt);
+		flow->q.push_back(txEntry);
+		flow->byteLength += txEntry->packet->payloadLength();
+		nqcb->_currEnqueuedPackets++;
+		if (!flow->scheduled) {
+			flow->scheduled = true;
+			flow->byteCredit = ZT_QOS_QUANTUM;
+			bucket->newFlows.push_back(flow);
+			nqcb->activeFlows++;
+		}
+		if (!bucket->scheduled) {
+			bucket->scheduled = true;
+			bucket->byteCredit = ZT_QOS_QUANTUM;
+			nqcb->newQueues.push_back(bucket);
+		}
+
+		// Drop a packet from the head of the longest flow if necessary
+		if (nqcb->_currEnqueuedPackets > ZT_QOS_MAX_ENQUEUED_PACKETS) {
+			ManagedQueue *selectedQueueToDropFrom = nullptr;
+			for(unsigned int b=0;b<ZT_QOS_NUM_BUCKETS;++b) {
+				for(int l=0;l<2;++l) {
+					std::list< ManagedQueue * > &flows = (l) ? nqcb->buckets[b].oldFlows : nqcb->buckets[b].newFlows;
+					for(std::list< ManagedQueue * >::iterator f(flows.begin());f!=flows.end();++f) {
+						if ((!selectedQueueToDropFrom)||((*f)->byteLength > selectedQueueToDropFrom->byteLength))
+							selectedQueueToDropFrom = *f;
+					}
 				}
 			}
-		}
-		if (selectedQueueToDropFrom) {
-			// DEBUG_INFO("dropping packet from head of largest queue (%d payload bytes)", maxQueueLength);
-			int sizeOfDroppedPacket = selectedQueueToDropFrom->q.front()->packet.payloadLength();
-			delete selectedQueueToDropFrom->q.front();
-			selectedQueueToDropFrom->q.pop_front();
-			selectedQueueToDropFrom->byteLength-=sizeOfDroppedPacket;
-			nqcb->_currEnqueuedPackets--;
+			if ((selectedQueueToDropFrom)&&(!selectedQueueToDropFrom->q.empty())) {
+				_aqmDrop(&(*nqcb),selectedQueueToDropFrom);
+				nqcb->overflowDrops++;
+			}
 		}
 	}
-	_aqm_m.unlock();
-	aqm_dequeue(tPtr);
+
+	_aqmDequeue(tPtr,nqcb);
 }
 
 uint64_t Switch::control_law(uint64_t t, int count)
@@ -605,11 +567,11 @@ uint64_t Switch::control_law(uint64_t t, int count)
 	return (uint64_t)(t + ZT_QOS_INTERVAL / sqrt(count));
 }
 
-Switch::dqr Switch::dodequeue(ManagedQueue *q, uint64_t now) 
+Switch::dqr Switch::dodequeue(ManagedQueue *q, uint64_t now)
 {
 	dqr r;
 	r.ok_to_drop = false;
-	r.p = q->q.front();
+	r.p = (q->q.empty()) ? (TXQueueEntry *)0 : q->q.front();
 
 	if (r.p == NULL) {
 		q->first_above_time = 0;
@@ -631,7 +593,7 @@ Switch::dqr Switch::dodequeue(ManagedQueue *q, uint64_t now)
 	return r;
 }
 
-Switch::TXQueueEntry * Switch::CoDelDequeue(ManagedQueue *q, bool isNew, uint64_t now)
+Switch::TXQueueEntry * Switch::CoDelDequeue(NetworkQoSControlBlock *nqcb, ManagedQueue *q, uint64_t now)
 {
 	dqr r = dodequeue(q, now);
 
@@ -640,7 +602,8 @@ Switch::TXQueueEntry * Switch::CoDelDequeue(ManagedQueue *q, bool isNew, uint64_
 			q->dropping = false;
 		}
 		while (now >= q->drop_next && q->dropping) {
-			q->q.pop_front(); // drop
+			_aqmDrop(nqcb, q); // drop
+			nqcb->codelDrops++;
 			r = dodequeue(q, now);
 			if (!r.ok_to_drop) {
 				// leave dropping state
@@ -652,7 +615,8 @@ Switch::TXQueueEntry * Switch::CoDelDequeue(ManagedQueue *q, bool isNew, uint64_
 			}
 		}
 	} else if (r.ok_to_drop) {
-		q->q.pop_front(); // drop
+		_aqmDrop(nqcb, q); // drop
+		nqcb->codelDrops++;
 		r = dodequeue(q, now);
 		q->dropping = true;
 		q->count = (q->count > 2 && now - q->drop_next < 8*ZT_QOS_INTERVAL)?
@@ -665,99 +629,89 @@ Switch::TXQueueEntry * Switch::CoDelDequeue(ManagedQueue *q, bool isNew, uint64_
 void Switch::aqm_dequeue(void *tPtr)
 {
 	// Cycle through network-specific QoS control blocks
-	for(std::map<uint64_t,NetworkQoSControlBlock*>::iterator nqcb(_netQueueControlBlock.begin());nqcb!=_netQueueControlBlock.end();) {
-		if (!(*nqcb).second->_currEnqueuedPackets) {
-			return;
-		}
+	std::vector< SharedPtr<NetworkQoSControlBlock> > nqcbs;
+	{
+		Mutex::Lock _l(_aqm_m);
+		for(std::map< uint64_t,SharedPtr<NetworkQoSControlBlock> >::iterator nqcb(_netQueueControlBlock.begin());nqcb!=_netQueueControlBlock.end();++nqcb)
+			nqcbs.push_back(nqcb->second);
+	}
+	for(std::vector< SharedPtr<NetworkQoSControlBlock> >::iterator nqcb(nqcbs.begin());nqcb!=nqcbs.end();++nqcb)
+		_aqmDequeue(tPtr,*nqcb);
+}
 
-		uint64_t now = RR->node->now();
-		TXQueueEntry *entryToEmit = nullptr;
-		std::vector<ManagedQueue*> *currQueues = &((*nqcb).second->newQueues);
-		std::vector<ManagedQueue*> *oldQueues = &((*nqcb).second->oldQueues);
-		std::vector<ManagedQueue*> *inactiveQueues = &((*nqcb).second->inactiveQueues);
-
-		_aqm_m.lock();
-
-		// Attempt dequeue from queues in NEW list
-		bool examiningNewQueues = true;
-		while (currQueues->size()) {
-			ManagedQueue *queueAtFrontOfList = currQueues->front();
-			if (queueAtFrontOfList->byteCredit < 0) {
-				queueAtFrontOfList->byteCredit += ZT_QOS_QUANTUM;
-				// Move to list of OLD queues
-				// DEBUG_INFO("moving q=%p from NEW to OLD list", queueAtFrontOfList);
-				oldQueues->push_back(queueAtFrontOfList);
-				currQueues->erase(currQueues->begin());
-			} else {
-				entryToEmit = CoDelDequeue(queueAtFrontOfList, examiningNewQueues, now);
-				if (!entryToEmit) {
-					// Move to end of list of OLD queues
-					// DEBUG_INFO("moving q=%p from NEW to OLD list", queueAtFrontOfList);
-					oldQueues->push_back(queueAtFrontOfList);
-					currQueues->erase(currQueues->begin());
-				}
-				else {
-					int len = entryToEmit->packet.payloadLength();
-					queueAtFrontOfList->byteLength -= len;
-					queueAtFrontOfList->byteCredit -= len;
-					// Send the packet!
-					queueAtFrontOfList->q.pop_front();
-					send(tPtr, entryToEmit->packet, entryToEmit->encrypt);
-					(*nqcb).second->_currEnqueuedPackets--;
-				}
-				if (queueAtFrontOfList) {
-					//DEBUG_INFO("dequeuing from q=%p, len=%lu in NEW list (byteCredit=%d)", queueAtFrontOfList, queueAtFrontOfList->q.size(), queueAtFrontOfList->byteCredit);
-				}
-				break;
-			}
+unsigned long Switch::qosFlowId(const MAC &from,const MAC &to,unsigned int etherType,const void *data,unsigned int len) const
+{
+	// Byte order doesn't matter here since fields are only hashed
+	const uint8_t *const p = reinterpret_cast<const uint8_t *>(data);
+	uint64_t f[4];
+	unsigned int fc = 0;
+	uint32_t ports = 0;
+	if ((etherType == ZT_ETHERTYPE_IPV4)&&(len >= 20)&&((p[0] >> 4) == 4)) {
+		const unsigned int hl = ((unsigned int)p[0] & 0xf) << 2;
+		f[fc++] = p[9]; // protocol
+		memcpy(&(f[fc++]),p + 12,8); // source and destination
+		// Ports for TCP, UDP, and SCTP if this is a first or only fragment
+		if (((p[9] == 6)||(p[9] == 17)||(p[9] == 132))&&(((p[6] & 0x1f) | p[7]) == 0)&&(len >= (hl + 4))) {
+			memcpy(&ports,p + hl,4);
+			f[fc++] = ports;
 		}
-
-		// Attempt dequeue from queues in OLD list
-		examiningNewQueues = false;
-		currQueues = &((*nqcb).second->oldQueues);
-		while (currQueues->size()) {
-			ManagedQueue *queueAtFrontOfList = currQueues->front();
-			if (queueAtFrontOfList->byteCredit < 0) {
-				queueAtFrontOfList->byteCredit += ZT_QOS_QUANTUM;
-				oldQueues->push_back(queueAtFrontOfList);
-				currQueues->erase(currQueues->begin());
-			} else {
-				entryToEmit = CoDelDequeue(queueAtFrontOfList, examiningNewQueues, now);
-				if (!entryToEmit) {
-					//DEBUG_INFO("moving q=%p from OLD to INACTIVE list", queueAtFrontOfList);
-					// Move to inactive list of queues
-					inactiveQueues->push_back(queueAtFrontOfList);
-					currQueues->erase(currQueues->begin());
-				}
-				else {
-					int len = entryToEmit->packet.payloadLength();
-					queueAtFrontOfList->byteLength -= len;
-					queueAtFrontOfList->byteCredit -= len;
-					queueAtFrontOfList->q.pop_front();
-					send(tPtr, entryToEmit->packet, entryToEmit->encrypt);
-					(*nqcb).second->_currEnqueuedPackets--;
-				}
-				if (queueAtFrontOfList) {
-					//DEBUG_INFO("dequeuing from q=%p, len=%lu in OLD list (byteCredit=%d)", queueAtFrontOfList, queueAtFrontOfList->q.size(), queueAtFrontOfList->byteCredit);
-				}
-				break;
-			}
+	} else if ((etherType == ZT_ETHERTYPE_IPV6)&&(len >= 40)&&((p[0] >> 4) == 6)) {
+		f[fc++] = ((uint64_t)p[6] << 24) | ((uint64_t)(p[1] & 0xf) << 16) | ((uint64_t)p[2] << 8) | (uint64_t)p[3]; // next header and flow label
+		uint64_t a[4];
+		memcpy(a,p + 8,32); // source and destination
+		f[fc++] = a[0] ^ a[1];
+		f[fc++] = a[2] ^ a[3];
+		if (((p[6] == 6)||(p[6] == 17)||(p[6] == 132))&&(len >= 44)) {
+			memcpy(&ports,p + 40,4);
+			f[fc++] = ports;
 		}
-		nqcb++;
-		_aqm_m.unlock();
+	} else {
+		f[fc++] = etherType;
+		f[fc++] = from.toInt();
+		f[fc++] = to.toInt();
+	}
+
+	// Keyed multiply/xorshift mix: not cryptographic, but unpredictable to remote hosts
+	uint64_t h = _qosFlowKey[0];
+	for(unsigned int i=0;i<fc;++i) {
+		h ^= f[i] + _qosFlowKey[1];
+		h *= 0x9e3779b97f4a7c15ULL;
+		h ^= h >> 29;
 	}
+	h *= 0xbf58476d1ce4e5b9ULL;
+	h ^= h >> 32;
+	return (unsigned long)h;
 }
 
-void Switch::removeNetworkQoSControlBlock(uint64_t nwid)
+void Switch::aqmStatistics(uint64_t nwid,unsigned int &queuedPackets,unsigned int &activeFlows,uint64_t &overflowDrops,uint64_t &codelDrops)
 {
-	NetworkQoSControlBlock *nq = _netQueueControlBlock[nwid];
-	if (nq) {
-		_netQueueControlBlock.erase(nwid);
-		delete nq;
-		nq = NULL;
+	SharedPtr<NetworkQoSControlBlock> nqcb;
+	{
+		Mutex::Lock _l(_aqm_m);
+		std::map< uint64_t,SharedPtr<NetworkQoSControlBlock> >::iterator n(_netQueueControlBlock.find(nwid));
+		if (n != _netQueueControlBlock.end())
+			nqcb = n->second;
+	}
+	if (nqcb) {
+		Mutex::Lock _l(nqcb->lock);
+		queuedPackets = (unsigned int)nqcb->_currEnqueuedPackets;
+		activeFlows = nqcb->activeFlows;
+		overflowDrops = nqcb->overflowDrops;
+		codelDrops = nqcb->codelDrops;
+	} else {
+		queuedPackets = 0;
+		activeFlows = 0;
+		overflowDrops = 0;
+		codelDrops = 0;
 	}
 }
 
+void Switch::removeNetworkQoSControlBlock(uint64_t nwid)
+{
+	Mutex::Lock _l(_aqm_m);
+	_netQueueControlBlock.erase(nwid);
+}
+
 void Switch::send(void *tPtr,Packet &packet,bool encrypt)
 {
 	const Address dest(packet.destination());
@@ -765,11 +719,28 @@ void Switch::send(void *tPtr,Packet &packet,bool encrypt)
 		return;
 	if (!_trySend(tPtr,packet,encrypt)) {
 		{
+			const int64_t now = RR->node->now();
 			Mutex::Lock _l(_txQueue_m);
-			if (_txQueue.size() >= ZT_TX_QUEUE_SIZE) {
-				_txQueue.pop_front();
+			_txQueueExpire(now);
+			while ((_txQueueSize >= ZT_TX_QUEUE_MAX_TOTAL)&&(!_txQueueExpiry.empty())) {
+				// Drop oldest queued packet of any destination, skipping markers for packets already sent
+				std::list< TXQueueEntry > *const q = _txQueue.get(_txQueueExpiry.front().second);
+				if ((q)&&((int64_t)q->front().creationTime <= _txQueueExpiry.front().first)) {
+					q->pop_front();
+					--_txQueueSize;
+					if (q->empty())
+						_txQueue.erase(_txQueueExpiry.front().second);
+				}
+				_txQueueExpiry.pop_front();
 			}
-			_txQueue.push_back(TXQueueEntry(dest,RR->node->now(),packet,encrypt));
+			std::list< TXQueueEntry > &q = _txQueue[dest];
+			if (q.size() >= ZT_TX_QUEUE_SIZE) {
+				q.pop_front();
+				--_txQueueSize;
+			}
+			q.emplace_back(dest,now,packet,encrypt);
+			++_txQueueSize;
+			_txQueueExpiry.push_back(std::pair< int64_t,Address >(now,dest));
 		}
 		if (!RR->topology->getPeer(tPtr,dest))
 			requestWhois(tPtr,RR->node->now(),dest);
@@ -806,27 +777,35 @@ void Switch::doAnythingWaitingForPeer(void *tPtr,const SharedPtr<Peer> &peer)
 	}
 
 	const int64_t now = RR->node->now();
-	for(unsigned int ptr=0;ptr<ZT_RX_QUEUE_SIZE;++ptr) {
-		RXQueueEntry *const rq = &(_rxQueue[ptr]);
-		Mutex::Lock rql(rq->lock);
-		if ((rq->timestamp)&&(rq->complete)) {
-			if ((rq->frag0.tryDecode(RR,tPtr))||((now - rq->timestamp) > ZT_RECEIVE_QUEUE_TIMEOUT))
-				rq->timestamp = 0;
+	std::vector< RXQueueEntry * > waiting;
+	{
+		Mutex::Lock _l(_rxQueue_m);
+		Hashtable< uint64_t,RXQueueEntry * >::Iterator i(_rxQueue);
+		uint64_t *k = (uint64_t *)0;
+		RXQueueEntry **v = (RXQueueEntry **)0;
+		while (i.next(k,v)) {
+			RXQueueEntry *const rq = *v;
+			if (rq->complete) {
+				_rxQueueRemove(rq);
+				if ((now - rq->timestamp) > ZT_RECEIVE_QUEUE_TIMEOUT) {
+					++_rxQueueExpired;
+					_rxQueueRecycle(rq);
+				} else {
+					waiting.push_back(rq);
+				}
+			}
 		}
 	}
+	for(std::vector< RXQueueEntry * >::iterator rq(waiting.begin());rq!=waiting.end();++rq)
+		_rxQueueDecode(tPtr,now,*rq,false);
 
 	{
 		Mutex::Lock _l(_txQueue_m);
-		for(std::list< TXQueueEntry >::iterator txi(_txQueue.begin());txi!=_txQueue.end();) {
-			if (txi->dest == peer->address()) {
-				if (_trySend(tPtr,txi->packet,txi->encrypt)) {
-					_txQueue.erase(txi++);
-				} else {
-					++txi;
-				}
-			} else {
-				++txi;
-			}
+		std::list< TXQueueEntry > *const q = _txQueue.get(peer->address());
+		if (q) {
+			_txQueueFlush(tPtr,peer->address(),*q);
+			if (q->empty())
+				_txQueue.erase(peer->address());
 		}
 	}
 }
@@ -841,35 +820,52 @@ unsigned long Switch::doTimerTasks(void *tPtr,int64_t now)
 	std::vector<Address> needWhois;
 	{
 		Mutex::Lock _l(_txQueue_m);
-
-		for(std::list< TXQueueEntry >::iterator txi(_txQueue.begin());txi!=_txQueue.end();) {
-			if (_trySend(tPtr,txi->packet,txi->encrypt)) {
-				_txQueue.erase(txi++);
-			} else if ((now - txi->creationTime) > ZT_TRANSMIT_QUEUE_TIMEOUT) {
-				_txQueue.erase(txi++);
-			} else {
-				if (!RR->topology->getPeer(tPtr,txi->dest))
-					needWhois.push_back(txi->dest);
-				++txi;
+		_txQueueExpire(now);
+
+		Hashtable< Address,std::list< TXQueueEntry > >::Iterator i(_txQueue);
+		Address *dest = (Address *)0;
+		std::list< TXQueueEntry > *q = (std::list< TXQueueEntry > *)0;
+		while (i.next(dest,q)) {
+			if (!RR->topology->getPeer(tPtr,*dest)) {
+				needWhois.push_back(*dest);
+				continue;
 			}
+			_txQueueFlush(tPtr,*dest,*q);
+			if (q->empty())
+				_txQueue.erase(*dest);
 		}
 	}
 	for(std::vector<Address>::const_iterator i(needWhois.begin());i!=needWhois.end();++i)
 		requestWhois(tPtr,now,*i);
 
-	for(unsigned int ptr=0;ptr<ZT_RX_QUEUE_SIZE;++ptr) {
-		RXQueueEntry *const rq = &(_rxQueue[ptr]);
-		Mutex::Lock rql(rq->lock);
-		if ((rq->timestamp)&&(rq->complete)) {
-			if ((rq->frag0.tryDecode(RR,tPtr))||((now - rq->timestamp) > ZT_RECEIVE_QUEUE_TIMEOUT)) {
-				rq->timestamp = 0;
-			} else {
-				const Address src(rq->frag0.source());
-				if (!RR->topology->getPeer(tPtr,src))
-					requestWhois(tPtr,now,src);
+	std::vector< RXQueueEntry * > waiting;
+	{
+		Mutex::Lock _l(_rxQueue_m);
+		Hashtable< uint64_t,RXQueueEntry * >::Iterator i(_rxQueue);
+		uint64_t *k = (uint64_t *)0;
+		RXQueueEntry **v = (RXQueueEntry **)0;
+		while (i.next(k,v)) {
+			RXQueueEntry *const rq = *v;
+			if ((now - rq->timestamp) > ZT_RECEIVE_QUEUE_TIMEOUT) {
+				++_rxQueueExpired;
+				_rxQueueRemove(rq);
+				_rxQueueRecycle(rq);
+			} else if (rq->complete) {
+				_rxQueueRemove(rq);
+				waiting.push_back(rq);
 			}
 		}
 	}
+	needWhois.clear();
+	for(std::vector< RXQueueEntry * >::iterator rq(waiting.begin());rq!=waiting.end();++rq) {
+		const Address src((*rq)->frag0.source());
+		if (!_rxQueueDecode(tPtr,now,*rq,false)) {
+			if (!RR->topology->getPeer(tPtr,src))
+				needWhois.push_back(src);
+		}
+	}
+	for(std::vector<Address>::const_iterator i(needWhois.begin());i!=needWhois.end();++i)
+		requestWhois(tPtr,now,*i);
 
 	{
 		Mutex::Lock _l(_lastUniteAttempt_m);
@@ -896,6 +892,210 @@ unsigned long Switch::doTimerTasks(void *tPtr,int64_t now)
 	return ZT_WHOIS_RETRY_DELAY;
 }
 
+Switch::RXQueueEntry *Switch::_rxQueueNew(const int64_t now,const uint64_t packetId,const unsigned long source)
+{
+	RXQueueEntry *rq;
+	if (_rxQueueFree.empty()) {
+		rq = new RXQueueEntry();
+	} else {
+		rq = _rxQueueFree.back();
+		_rxQueueFree.pop_back();
+	}
+	rq->reset(now,packetId,source);
+	_rxQueueInsert(now,rq);
+	return rq;
+}
+
+void Switch::_rxQueueInsert(const int64_t now,RXQueueEntry *rq)
+{
+	// If this source is over its share, or the table is full, drop the oldest
+	// entry from this source or from the whole table respectively. This keeps
+	// one flooding source from pushing everyone else's partially received
+	// packets out of the queue. Both are the heads of lists kept in queue
+	// order, so this costs the same no matter how full the table is.
+	const _RXQueueSource *const src = _rxQueueSources.get(rq->source);
+	RXQueueEntry *const victim = ((src)&&(src->count >= ZT_RX_QUEUE_MAX_PER_SOURCE)) ? src->oldest : ((_rxQueue.size() >= ZT_RX_QUEUE_SIZE) ? _rxQueueOldest : (RXQueueEntry *)0);
+	if (victim) {
+		if ((now - victim->timestamp) > ZT_RECEIVE_QUEUE_TIMEOUT)
+			++_rxQueueExpired;
+		else ++_rxQueueEvicted;
+		_rxQueueRemove(victim);
+		_rxQueueRecycle(victim);
+	}
+
+	_rxQueue.set(rq->packetId,rq);
+
+	rq->prev = _rxQueueNewest;
+	rq->next = (RXQueueEntry *)0;
+	if (_rxQueueNewest)
+		_rxQueueNewest->next = rq;
+	else _rxQueueOldest = rq;
+	_rxQueueNewest = rq;
+
+	_RXQueueSource &s = _rxQueueSources[rq->source];
+	rq->sourcePrev = s.newest;
+	rq->sourceNext = (RXQueueEntry *)0;
+	if (s.newest)
+		s.newest->sourceNext = rq;
+	else s.oldest = rq;
+	s.newest = rq;
+	++s.count;
+}
+
+void Switch::_rxQueueRemove(RXQueueEntry *rq)
+{
+	_rxQueue.erase(rq->packetId);
+
+	if (rq->prev)
+		rq->prev->next = rq->next;
+	else _rxQueueOldest = rq->next;
+	if (rq->next)
+		rq->next->prev = rq->prev;
+	else _rxQueueNewest = rq->prev;
+
+	_RXQueueSource *const s = _rxQueueSources.get(rq->source);
+	if (s) {
+		if (--s->count == 0) {
+			_rxQueueSources.erase(rq->source);
+		} else {
+			if (rq->sourcePrev)
+				rq->sourcePrev->sourceNext = rq->sourceNext;
+			else s->oldest = rq->sourceNext;
+			if (rq->sourceNext)
+				rq->sourceNext->sourcePrev = rq->sourcePrev;
+			else s->newest = rq->sourcePrev;
+		}
+	}
+
+	rq->prev = rq->next = rq->sourcePrev = rq->sourceNext = (RXQueueEntry *)0;
+}
+
+void Switch::_rxQueueRecycle(RXQueueEntry *rq)
+{
+	if (_rxQueueFree.size() < ZT_RX_QUEUE_FREE_LIST_SIZE)
+		_rxQueueFree.push_back(rq);
+	else delete rq;
+}
+
+bool Switch::_rxQueueDecode(void *tPtr,const int64_t now,RXQueueEntry *rq,const bool assemble)
+{
+	bool decoded = true; // drop the entry if it is malformed
+	try {
+		if (assemble) {
+			for(unsigned int f=1;f<rq->totalFragments;++f)
+				rq->frag0.append(rq->fragData + rq->fragStart[f - 1],rq->fragLen[f - 1]);
+			rq->complete = true;
+		}
+		decoded = rq->frag0.tryDecode(RR,tPtr);
+	} catch ( ... ) {}
+
+	Mutex::Lock _l(_rxQueue_m);
+	if ((decoded)||(_rxQueue.contains(rq->packetId))) {
+		_rxQueueRecycle(rq);
+	} else {
+		_rxQueueInsert(now,rq); // leave complete entry since it probably needs WHOIS or something
+	}
+	return decoded;
+}
+
+void Switch::_aqmDrop(NetworkQoSControlBlock *nqcb,ManagedQueue *q)
+{
+	TXQueueEntry *const e = q->q.front();
+	q->byteLength -= e->packet->payloadLength();
+	q->q.pop_front();
+	nqcb->_currEnqueuedPackets--;
+	delete e;
+}
+
+Switch::TXQueueEntry *Switch::_aqmNext(NetworkQoSControlBlock *nqcb,uint64_t now)
+{
+	// Buckets are scheduled by DRR with new ones ahead of old ones. Flows within
+	// the chosen bucket are scheduled the same way, and CoDel picks the packet
+	// from the chosen flow. A new queue that comes up empty goes to the back of
+	// the old list before going idle, so bursty flows can't stay "new" forever.
+	while ((!nqcb->newQueues.empty())||(!nqcb->oldQueues.empty())) {
+		const bool newBucket = !nqcb->newQueues.empty();
+		std::list< QoSBucket * > &buckets = (newBucket) ? nqcb->newQueues : nqcb->oldQueues;
+		QoSBucket *const bucket = buckets.front();
+		if (bucket->byteCredit < 0) {
+			bucket->byteCredit += ZT_QOS_QUANTUM;
+			nqcb->oldQueues.push_back(bucket);
+			buckets.pop_front();
+			continue;
+		}
+
+		TXQueueEntry *entryToEmit = (TXQueueEntry *)0;
+		while ((!bucket->newFlows.empty())||(!bucket->oldFlows.empty())) {
+			const bool newFlow = !bucket->newFlows.empty();
+			std::list< ManagedQueue * > &flows = (newFlow) ? bucket->newFlows : bucket->oldFlows;
+			ManagedQueue *const flow = flows.front();
+			if (flow->byteCredit < 0) {
+				flow->byteCredit += ZT_QOS_QUANTUM;
+				bucket->oldFlows.push_back(flow);
+				flows.pop_front();
+				continue;
+			}
+			entryToEmit = CoDelDequeue(nqcb,flow,now);
+			if (entryToEmit) {
+				const int len = entryToEmit->packet->payloadLength();
+				flow->byteLength -= len;
+				flow->byteCredit -= len;
+				bucket->byteCredit -= len;
+				flow->q.pop_front();
+				nqcb->_currEnqueuedPackets--;
+				break;
+			}
+			flows.pop_front();
+			if ((newFlow)&&(!bucket->oldFlows.empty())) {
+				bucket->oldFlows.push_back(flow);
+			} else {
+				flow->scheduled = false;
+				nqcb->activeFlows--;
+			}
+		}
+		if (entryToEmit)
+			return entryToEmit;
+
+		buckets.pop_front();
+		if ((newBucket)&&(!nqcb->oldQueues.empty())) {
+			nqcb->oldQueues.push_back(bucket);
+		} else {
+			bucket->scheduled = false;
+		}
+	}
+	return (TXQueueEntry *)0;
+}
+
+void Switch::_aqmDequeue(void *tPtr,const SharedPtr<NetworkQoSControlBlock> &nqcb)
+{
+	TXQueueEntry *entryToEmit;
+	{
+		Mutex::Lock _l(nqcb->lock);
+		entryToEmit = _aqmNext(&(*nqcb),(uint64_t)RR->node->now());
+	}
+	if (entryToEmit) {
+		send(tPtr,*(entryToEmit->packet),entryToEmit->encrypt);
+		delete entryToEmit;
+	}
+}
+
+void Switch::_txQueueExpire(const int64_t now)
+{
+	while ((!_txQueueExpiry.empty())&&((now - _txQueueExpiry.front().first) > ZT_TRANSMIT_QUEUE_TIMEOUT)) {
+		const Address &dest = _txQueueExpiry.front().second;
+		std::list< TXQueueEntry > *const q = _txQueue.get(dest);
+		if (q) {
+			while ((!q->empty())&&((now - (int64_t)q->front().creationTime) > ZT_TRANSMIT_QUEUE_TIMEOUT)) {
+				q->pop_front();
+				--_txQueueSize;
+			}
+			if (q->empty())
+				_txQueue.erase(dest);
+		}
+		_txQueueExpiry.pop_front();
+	}
+}
+
 bool Switch::_shouldUnite(const int64_t now,const Address &source,const Address &destination)
 {
 	Mutex::Lock _l(_lastUniteAttempt_m);
@@ -907,13 +1107,9 @@ bool Switch::_shouldUnite(const int64_t now,const Address &source,const Address
 	return false;
 }
 
-bool Switch::_trySend(void *tPtr,Packet &packet,bool encrypt)
+bool Switch::_sendPath(void *tPtr,const int64_t now,const Address &destination,const Epoch::Guard &g,BorrowedPtr<Peer> &peer,SharedPtr<Path> &viaPath)
 {
-	SharedPtr<Path> viaPath;
-	const int64_t now = RR->node->now();
-	const Address destination(packet.destination());
-
-	const SharedPtr<Peer> peer(RR->topology->getPeer(tPtr,destination));
+	peer = RR->topology->getPeer(tPtr,destination,g);
 	if (peer) {
 		viaPath = peer->getAppropriatePath(now,false);
 		if (!viaPath) {
@@ -924,25 +1120,14 @@ bool Switch::_trySend(void *tPtr,Packet &packet,bool encrypt)
 					return false;
 			}
 		}
-	} else {
-		return false;
+		return true;
 	}
+	return false;
+}
 
-	unsigned int mtu = ZT_DEFAULT_PHYSMTU;
-	uint64_t trustedPathId = 0;
-	RR->topology->getOutboundPathInfo(viaPath->address(),mtu,trustedPathId);
-
+void Switch::_sendArmored(void *tPtr,const int64_t now,const SharedPtr<Path> &viaPath,Packet &packet,const unsigned int mtu)
+{
 	unsigned int chunkSize = std::min(packet.size(),mtu);
-	packet.setFragmented(chunkSize < packet.size());
-
-	peer->recordOutgoingPacket(viaPath, packet.packetId(), packet.payloadLength(), packet.verb(), now);
-
-	if (trustedPathId) {
-		packet.setTrusted(trustedPathId);
-	} else {
-		packet.armor(peer->key(),encrypt);
-	}
-
 	if (viaPath->send(RR,tPtr,packet.data(),chunkSize,now)) {
 		if (chunkSize < packet.size()) {
 			// Too big for one packet, fragment the rest
@@ -953,15 +1138,91 @@ bool Switch::_trySend(void *tPtr,Packet &packet,bool encrypt)
 				++fragsRemaining;
 			const unsigned int totalFragments = fragsRemaining + 1;
 
+			// Each fragment's header overwrites the tail of the previous chunk,
+			// which has already been sent, so nothing is copied here.
 			for(unsigned int fno=1;fno<totalFragments;++fno) {
 				chunkSize = std::min(remaining,(unsigned int)(mtu - ZT_PROTO_MIN_FRAGMENT_LENGTH));
-				Packet::Fragment frag(packet,fragStart,chunkSize,fno,totalFragments);
-				viaPath->send(RR,tPtr,frag.data(),frag.size(),now);
+				viaPath->send(RR,tPtr,packet.fragmentInPlace(fragStart,chunkSize,fno,totalFragments),chunkSize + ZT_PROTO_MIN_FRAGMENT_LENGTH,now);
 				fragStart += chunkSize;
 				remaining -= chunkSize;
 			}
 		}
 	}
+}
+
+void Switch::_txQueueFlush(void *tPtr,const Address &destination,std::list< TXQueueEntry > &q)
+{
+	const int64_t now = RR->node->now();
+	const Epoch::Guard _g(RR->topology->epoch());
+	BorrowedPtr<Peer> peer;
+	SharedPtr<Path> viaPath;
+	if ((q.empty())||(!_sendPath(tPtr,now,destination,_g,peer,viaPath)))
+		return;
+
+	unsigned int mtu = ZT_DEFAULT_PHYSMTU;
+	uint64_t trustedPathId = 0;
+	RR->topology->getOutboundPathInfo(viaPath->address(),mtu,trustedPathId);
+
+	// Everything queued for this destination goes out the same way, so
+	// packets are armored in batches with one key. AES-GCM-SIV packets
+	// don't benefit from Salsa20 batching and are armored one at a time.
+	const AES *const aes = (peer->cipherSuite() == ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV) ? peer->aesKey() : (const AES *)0;
+	Packet *toArmor[ZT_PACKET_ARMOR_BATCH_MAX];
+	const void *keys[ZT_PACKET_ARMOR_BATCH_MAX];
+	bool encrypt[ZT_PACKET_ARMOR_BATCH_MAX];
+	for(unsigned int k=0;k<ZT_PACKET_ARMOR_BATCH_MAX;++k)
+		keys[k] = peer->key();
+
+	while (!q.empty()) {
+		unsigned int n = 0,armored = 0;
+		for(std::list< TXQueueEntry >::iterator txi(q.begin());((txi!=q.end())&&(n < ZT_PACKET_ARMOR_BATCH_MAX));++txi,++n) {
+			Packet &packet = *(txi->packet);
+			packet.setFragmented(((trustedPathId) ? packet.size() : packet.armoredSize(txi->encrypt,aes)) > mtu);
+			peer->recordOutgoingPacket(viaPath,packet.packetId(),packet.payloadLength(),packet.verb(),now);
+			if (trustedPathId) {
+				packet.setTrusted(trustedPathId);
+			} else if ((aes)&&(txi->encrypt)) {
+				packet.armor(peer->key(),true,aes);
+			} else {
+				toArmor[armored] = &packet;
+				encrypt[armored++] = txi->encrypt;
+			}
+		}
+		Packet::armorBatch(toArmor,keys,encrypt,armored);
+
+		while (n--) {
+			_sendArmored(tPtr,now,viaPath,*(q.front().packet),mtu);
+			q.pop_front();
+			--_txQueueSize;
+		}
+	}
+}
+
+bool Switch::_trySend(void *tPtr,Packet &packet,bool encrypt)
+{
+	const int64_t now = RR->node->now();
+	const Epoch::Guard _g(RR->topology->epoch());
+	BorrowedPtr<Peer> peer;
+	SharedPtr<Path> viaPath;
+	if (!_sendPath(tPtr,now,packet.destination(),_g,peer,viaPath))
+		return false;
+
+	unsigned int mtu = ZT_DEFAULT_PHYSMTU;
+	uint64_t trustedPathId = 0;
+	RR->topology->getOutboundPathInfo(viaPath->address(),mtu,trustedPathId);
+
+	const AES *const aes = (peer->cipherSuite() == ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV) ? peer->aesKey() : (const AES *)0;
+	packet.setFragmented(((trustedPathId) ? packet.size() : packet.armoredSize(encrypt,aes)) > mtu);
+
+	peer->recordOutgoingPacket(viaPath, packet.packetId(), packet.payloadLength(), packet.verb(), now);
+
+	if (trustedPathId) {
+		packet.setTrusted(trustedPathId);
+	} else {
+		packet.armor(peer->key(),encrypt,aes);
+	}
+
+	_sendArmored(tPtr,now,viaPath,packet,mtu);
 
 	return true;
 }
@@ -31,6 +31,7 @@
 #include <set>
 #include <vector>
 #include <list>
+#include <deque>
 
 #include "Constants.hpp"
 #include "Mutex.hpp"
@@ -42,6 +43,7 @@
 #include "Network.hpp"
 #include "SharedPtr.hpp"
 #include "IncomingPacket.hpp"
+#include "PacketPool.hpp"
 #include "Hashtable.hpp"
 
 /* Ethernet frame types that might be relevant to us */
@@ -71,6 +73,7 @@ class Switch
 {
 	struct ManagedQueue;
 	struct TXQueueEntry;
+	struct NetworkQoSControlBlock;
 
 	typedef struct {
 		TXQueueEntry *p;
@@ -79,6 +82,7 @@ class Switch
 
 public:
 	Switch(const RuntimeEnvironment *renv);
+	~Switch();
 
 	/**
 	 * Called when a packet is received from the real network
@@ -130,8 +134,9 @@ public:
 	 * @param packet Packet to be sent
 	 * @param encrypt Encrypt packet payload? (always true except for HELLO)
 	 * @param qosBucket Which bucket the rule-system determined this packet should fall into
+	 * @param flowId Hash of the frame's flow (see qosFlowId()), selects the flow queue within the bucket
 	 */
-	void aqm_enqueue(void *tPtr, const SharedPtr<Network> &network, Packet &packet,bool encrypt,int qosBucket);
+	void aqm_enqueue(void *tPtr, const SharedPtr<Network> &network, Packet &packet,bool encrypt,int qosBucket,unsigned long flowId);
 
 	/**
 	 * Performs a single AQM cycle and dequeues and transmits all eligible packets on all networks
@@ -143,11 +148,42 @@ public:
 	/**
 	 * Calls the dequeue mechanism and adjust queue state variables
 	 *
-	 * @param q The TX queue that is being dequeued from
-	 * @param isNew Whether or not this queue is in the NEW list
+	 * Packets dropped by CoDel are freed here and counted in the control block.
+	 * Control block must be locked.
+	 *
+	 * @param nqcb Network QoS control block that owns the queue
+	 * @param q The flow queue that is being dequeued from
 	 * @param now Current time
 	 */
-	Switch::TXQueueEntry * CoDelDequeue(ManagedQueue *q, bool isNew, uint64_t now);
+	Switch::TXQueueEntry * CoDelDequeue(NetworkQoSControlBlock *nqcb, ManagedQueue *q, uint64_t now);
+
+	/**
+	 * Compute a flow ID for fair queueing from an Ethernet frame
+	 *
+	 * IPv4 and IPv6 frames are hashed by protocol, addresses, and (for TCP,
+	 * UDP, and SCTP) ports. Other frames are hashed by MAC addresses and
+	 * ethernet type. The hash is keyed with a random per-node secret so remote
+	 * hosts can't deliberately collide flows.
+	 *
+	 * @param from Source MAC
+	 * @param to Destination MAC
+	 * @param etherType Ethernet type
+	 * @param data Ethernet payload
+	 * @param len Payload length
+	 * @return Flow ID
+	 */
+	unsigned long qosFlowId(const MAC &from,const MAC &to,unsigned int etherType,const void *data,unsigned int len) const;
+
+	/**
+	 * Get AQM statistics for a network
+	 *
+	 * @param nwid Network ID
+	 * @param queuedPackets Set to number of packets currently held by the scheduler
+	 * @param activeFlows Set to number of flow queues currently scheduled
+	 * @param overflowDrops Set to number of packets dropped because the scheduler was full
+	 * @param codelDrops Set to number of packets dropped by CoDel due to excess queueing delay
+	 */
+	void aqmStatistics(uint64_t nwid,unsigned int &queuedPackets,unsigned int &activeFlows,uint64_t &overflowDrops,uint64_t &codelDrops);
 
 	/**
 	 * Removes QoS Queues and flow state variables for a specific network. These queues are created
@@ -210,8 +246,113 @@ public:
 	 */
 	unsigned long doTimerTasks(void *tPtr,int64_t now);
 
+	/**
+	 * Get counters for packets dropped from the receive reassembly queue
+	 *
+	 * @param evicted Set to number of pending packets dropped to make room for new ones
+	 * @param expired Set to number of pending packets dropped after ZT_RECEIVE_QUEUE_TIMEOUT
+	 */
+	inline void rxQueueStatistics(uint64_t &evicted,uint64_t &expired)
+	{
+		Mutex::Lock _l(_rxQueue_m);
+		evicted = _rxQueueEvicted;
+		expired = _rxQueueExpired;
+	}
+
+	/**
+	 * A packet waiting for WHOIS replies or other decode info or missing fragments
+	 *
+	 * This is public so selftest can exercise the fragment bookkeeping.
+	 */
+	struct RXQueueEntry
+	{
+		RXQueueEntry() : prev((RXQueueEntry *)0),next((RXQueueEntry *)0),sourcePrev((RXQueueEntry *)0),sourceNext((RXQueueEntry *)0),timestamp(0),packetId(0),source(0),totalFragments(0),haveFragments(0),fragDataSize(0),complete(false)
+		{
+			memset(fragStart,0,sizeof(fragStart));
+			memset(fragLen,0,sizeof(fragLen));
+		}
+
+		/**
+		 * Clear fragment state for reuse with a new packet
+		 */
+		inline void reset(const int64_t now,const uint64_t pid,const unsigned long src)
+		{
+			timestamp = now;
+			packetId = pid;
+			source = src;
+			totalFragments = 0;
+			haveFragments = 0;
+			fragDataSize = 0;
+			memset(fragStart,0,sizeof(fragStart));
+			memset(fragLen,0,sizeof(fragLen));
+			complete = false;
+		}
+
+		/**
+		 * Note that the head (fragment 0) has been stored in frag0
+		 *
+		 * @return True if all fragments are now present
+		 */
+		inline bool addHead()
+		{
+			haveFragments |= 1;
+			return haveAllFragments();
+		}
+
+		/**
+		 * Add a fragment other than the head
+		 *
+		 * Fragments numbered outside their own total, fragments whose total
+		 * disagrees with the one already recorded for this packet, duplicates,
+		 * and fragments that would overflow fragData are ignored.
+		 *
+		 * @param fragmentNumber Fragment number (1 or more)
+		 * @param total Total fragments including the head, as given by this fragment
+		 * @param payload Fragment payload
+		 * @param len Length of payload
+		 * @return True if all fragments are now present
+		 */
+		inline bool addFragment(const unsigned int fragmentNumber,const unsigned int total,const void *payload,const unsigned int len)
+		{
+			if ((total < 2)||(total > ZT_MAX_PACKET_FRAGMENTS)||(fragmentNumber == 0)||(fragmentNumber >= total))
+				return false;
+			if ((totalFragments != 0)&&(totalFragments != total))
+				return false;
+			if (((haveFragments & (1U << fragmentNumber)) != 0)||((fragDataSize + len) > sizeof(fragData)))
+				return false;
+			memcpy(fragData + fragDataSize,payload,len);
+			fragStart[fragmentNumber - 1] = (uint16_t)fragDataSize;
+			fragLen[fragmentNumber - 1] = (uint16_t)len;
+			fragDataSize += len;
+			totalFragments = total;
+			haveFragments |= (1U << fragmentNumber);
+			return haveAllFragments();
+		}
+
+		/**
+		 * @return True if the head and every fragment up to totalFragments have been received
+		 */
+		inline bool haveAllFragments() const { return ((totalFragments > 1)&&(haveFragments == ((1U << totalFragments) - 1))); }
+
+		RXQueueEntry *prev,*next; // neighbors in the queue's oldest to newest list while queued
+		RXQueueEntry *sourcePrev,*sourceNext; // neighbors in the same list for this source only
+		int64_t timestamp; // time first piece of this packet was received
+		uint64_t packetId;
+		unsigned long source; // hash of physical source address for per-source limits
+		IncomingPacket frag0; // head of packet
+		unsigned int totalFragments; // 0 if only frag0 received, waiting for frags
+		uint32_t haveFragments; // bit mask, LSB to MSB
+		unsigned int fragDataSize; // bytes used in fragData
+		uint16_t fragStart[ZT_MAX_PACKET_FRAGMENTS - 1];
+		uint16_t fragLen[ZT_MAX_PACKET_FRAGMENTS - 1];
+		uint8_t fragData[ZT_PROTO_MAX_PACKET_LENGTH]; // payloads of later fragments (if any) packed in arrival order
+		bool complete; // if true, packet is complete
+	};
+
 private:
 	bool _shouldUnite(const int64_t now,const Address &source,const Address &destination);
+	bool _sendPath(void *tPtr,const int64_t now,const Address &destination,const Epoch::Guard &g,BorrowedPtr<Peer> &peer,SharedPtr<Path> &viaPath);
+	void _sendArmored(void *tPtr,const int64_t now,const SharedPtr<Path> &viaPath,Packet &packet,const unsigned int mtu);
 	bool _trySend(void *tPtr,Packet &packet,bool encrypt); // packet is modified if return is true
 
 	const RuntimeEnvironment *const RR;
@@ -222,40 +363,30 @@ private:
 	Hashtable< Address,int64_t > _lastSentWhoisRequest;
 	Mutex _lastSentWhoisRequest_m;
 
-	// Packets waiting for WHOIS replies or other decode info or missing fragments
-	struct RXQueueEntry
+	// Entries queued by one physical source, oldest first
+	struct _RXQueueSource
 	{
-		RXQueueEntry() : timestamp(0) {}
-		volatile int64_t timestamp; // 0 if entry is not in use
-		volatile uint64_t packetId;
-		IncomingPacket frag0; // head of packet
-		Packet::Fragment frags[ZT_MAX_PACKET_FRAGMENTS - 1]; // later fragments (if any)
-		unsigned int totalFragments; // 0 if only frag0 received, waiting for frags
-		uint32_t haveFragments; // bit mask, LSB to MSB
-		volatile bool complete; // if true, packet is complete
-		Mutex lock;
+		_RXQueueSource() : oldest((RXQueueEntry *)0),newest((RXQueueEntry *)0),count(0) {}
+		RXQueueEntry *oldest,*newest;
+		unsigned int count;
 	};
-	RXQueueEntry _rxQueue[ZT_RX_QUEUE_SIZE];
-	AtomicCounter _rxQueuePtr;
 
-	// Returns matching or next available RX queue entry
-	inline RXQueueEntry *_findRXQueueEntry(uint64_t packetId)
-	{
-		const unsigned int current = static_cast<unsigned int>(_rxQueuePtr.load());
-		for(unsigned int k=1;k<=ZT_RX_QUEUE_SIZE;++k) {
-			RXQueueEntry *rq = &(_rxQueue[(current - k) % ZT_RX_QUEUE_SIZE]);
-			if ((rq->packetId == packetId)&&(rq->timestamp))
-				return rq;
-		}
-		++_rxQueuePtr;
-		return &(_rxQueue[static_cast<unsigned int>(current) % ZT_RX_QUEUE_SIZE]);
-	}
+	Hashtable< uint64_t,RXQueueEntry * > _rxQueue; // packet ID -> entry, entries are owned by the table while in it
+	Hashtable< unsigned long,_RXQueueSource > _rxQueueSources; // source -> its entries in _rxQueue
+	RXQueueEntry *_rxQueueOldest,*_rxQueueNewest; // all entries in _rxQueue in the order they were queued, for O(1) eviction
+	std::vector< RXQueueEntry * > _rxQueueFree;
+	uint64_t _rxQueueEvicted;
+	uint64_t _rxQueueExpired;
+	Mutex _rxQueue_m;
 
-	// Returns current entry in rx queue ring buffer and increments ring pointer
-	inline RXQueueEntry *_nextRXQueueEntry()
-	{
-		return &(_rxQueue[static_cast<unsigned int>((++_rxQueuePtr) - 1) % ZT_RX_QUEUE_SIZE]);
-	}
+	// These must be called with _rxQueue_m locked
+	RXQueueEntry *_rxQueueNew(const int64_t now,const uint64_t packetId,const unsigned long source);
+	void _rxQueueInsert(const int64_t now,RXQueueEntry *rq);
+	void _rxQueueRemove(RXQueueEntry *rq);
+	void _rxQueueRecycle(RXQueueEntry *rq);
+
+	// Assembles (if fragmented) and decodes an entry already removed from _rxQueue, re-queueing it if it must wait
+	bool _rxQueueDecode(void *tPtr,const int64_t now,RXQueueEntry *rq,const bool assemble);
 
 	// ZeroTier-layer TX queue entry
 	struct TXQueueEntry
@@ -264,16 +395,24 @@ private:
 		TXQueueEntry(Address d,uint64_t ct,const Packet &p,bool enc) :
 			dest(d),
 			creationTime(ct),
-			packet(p),
+			packet(PacketPool::get(p)),
 			encrypt(enc) {}
 
 		Address dest;
 		uint64_t creationTime;
-		Packet packet; // unencrypted/unMAC'd packet -- this is done at send time
+		PacketPool::Ptr packet; // unencrypted/unMAC'd packet -- this is done at send time
 		bool encrypt;
 	};
-	std::list< TXQueueEntry > _txQueue;
+	Hashtable< Address,std::list< TXQueueEntry > > _txQueue; // per-destination FIFO queues
+	std::deque< std::pair< int64_t,Address > > _txQueueExpiry; // (creation time, destination) for each queued packet in order of creation
+	unsigned long _txQueueSize; // total packets in all _txQueue queues
 	Mutex _txQueue_m;
+
+	// Drops expired packets using _txQueueExpiry, must be called with _txQueue_m locked
+	void _txQueueExpire(const int64_t now);
+
+	// Armors (in batches) and sends everything queued for a destination if it's reachable, must be called with _txQueue_m locked
+	void _txQueueFlush(void *tPtr,const Address &destination,std::list< TXQueueEntry > &q);
 	Mutex _aqm_m;
 
 	// Tracks sending of VERB_RENDEZVOUS to relaying peers
@@ -300,31 +439,77 @@ private:
 	// Queue with additional flow state variables
 	struct ManagedQueue
 	{
-		ManagedQueue(int id) :
-			id(id),
+		ManagedQueue() :
 			byteCredit(ZT_QOS_QUANTUM),
 			byteLength(0),
-			dropping(false)
+			first_above_time(0),
+			count(0),
+			drop_next(0),
+			dropping(false),
+			scheduled(false)
 		{}
-		int id;
 		int byteCredit;
 		int byteLength;
 		uint64_t first_above_time;
 		uint32_t count;
 		uint64_t drop_next;
 		bool dropping;
-		uint64_t drop_next_time;
+		bool scheduled; // true if in its bucket's new or old flow list
 		std::list< TXQueueEntry *> q;
 	};
+	// A QoS bucket (priority class) containing hashed flow queues, each bucket is scheduled by DRR
+	// between buckets and its flows are scheduled by DRR within it
+	struct QoSBucket
+	{
+		QoSBucket() :
+			byteCredit(ZT_QOS_QUANTUM),
+			scheduled(false)
+		{}
+		int byteCredit;
+		bool scheduled; // true if in the control block's new or old bucket list
+		ManagedQueue flows[ZT_QOS_FLOWS_PER_BUCKET];
+		std::list< ManagedQueue * > newFlows;
+		std::list< ManagedQueue * > oldFlows;
+	};
 	// To implement fq_codel we need to maintain a queue of queues
 	struct NetworkQoSControlBlock
 	{
+		NetworkQoSControlBlock() :
+			_currEnqueuedPackets(0),
+			activeFlows(0),
+			overflowDrops(0),
+			codelDrops(0)
+		{}
+		~NetworkQoSControlBlock()
+		{
+			for(unsigned int b=0;b<ZT_QOS_NUM_BUCKETS;++b) {
+				for(unsigned int f=0;f<ZT_QOS_FLOWS_PER_BUCKET;++f) {
+					for(std::list< TXQueueEntry * >::iterator e(buckets[b].flows[f].q.begin());e!=buckets[b].flows[f].q.end();++e)
+						delete *e;
+				}
+			}
+		}
 		int _currEnqueuedPackets;
-		std::vector<ManagedQueue *> newQueues;
-		std::vector<ManagedQueue *> oldQueues;
-		std::vector<ManagedQueue *> inactiveQueues;
+		unsigned int activeFlows;
+		uint64_t overflowDrops;
+		uint64_t codelDrops;
+		QoSBucket buckets[ZT_QOS_NUM_BUCKETS];
+		std::list< QoSBucket * > newQueues;
+		std::list< QoSBucket * > oldQueues;
+		Mutex lock;
+		AtomicCounter __refCount;
 	};
-	std::map<uint64_t,NetworkQoSControlBlock*> _netQueueControlBlock;
+	std::map< uint64_t,SharedPtr<NetworkQoSControlBlock> > _netQueueControlBlock;
+	uint64_t _qosFlowKey[2]; // secret key for qosFlowId()
+
+	// Removes and frees the packet at the head of a flow queue, control block must be locked
+	void _aqmDrop(NetworkQoSControlBlock *nqcb,ManagedQueue *q);
+
+	// Selects the next packet to send from a network's buckets and flows, control block must be locked
+	TXQueueEntry *_aqmNext(NetworkQoSControlBlock *nqcb,uint64_t now);
+
+	// Sends the next scheduled packet for a network, if any
+	void _aqmDequeue(void *tPtr,const SharedPtr<NetworkQoSControlBlock> &nqcb);
 };
 
 } // namespace ZeroTier
@@ -66,8 +66,12 @@ static const unsigned char ZT_DEFAULT_WORLD[ZT_DEFAULT_WORLD_LENGTH] = {0x01,0x0
 Topology::Topology(const RuntimeEnvironment *renv,void *tPtr) :
 	RR(renv),
 	_numConfiguredPhysicalPaths(0),
+	_peers(_epoch),
 	_amUpstream(false)
 {
+	for(unsigned int i=0;i<ZT_TOPOLOGY_PATH_SHARDS;++i)
+		_paths[i] = new ConcurrentHashtable< Path::HashKey,SharedPtr<Path> >(_epoch);
+
 	uint8_t tmp[ZT_WORLD_MAX_SERIALIZED_LENGTH];
 	uint64_t idtmp[2];
 	idtmp[0] = 0; idtmp[1] = 0;
@@ -90,24 +94,16 @@ Topology::Topology(const RuntimeEnvironment *renv,void *tPtr) :
 
 Topology::~Topology()
 {
-	Hashtable< Address,SharedPtr<Peer> >::Iterator i(_peers);
-	Address *a = (Address *)0;
-	SharedPtr<Peer> *p = (SharedPtr<Peer> *)0;
-	while (i.next(a,p))
-		_savePeer((void *)0,*p);
+	const std::vector< std::pair< Address,SharedPtr<Peer> > > peers(_peers.entries());
+	for(std::vector< std::pair< Address,SharedPtr<Peer> > >::const_iterator p(peers.begin());p!=peers.end();++p)
+		_savePeer((void *)0,p->second);
+	for(unsigned int i=0;i<ZT_TOPOLOGY_PATH_SHARDS;++i)
+		delete _paths[i];
 }
 
 SharedPtr<Peer> Topology::addPeer(void *tPtr,const SharedPtr<Peer> &peer)
 {
-	SharedPtr<Peer> np;
-	{
-		Mutex::Lock _l(_peers_m);
-		SharedPtr<Peer> &hp = _peers[peer->address()];
-		if (!hp)
-			hp = peer;
-		np = hp;
-	}
-	return np;
+	return _peers.setIfAbsent(peer->address(),peer);
 }
 
 SharedPtr<Peer> Topology::getPeer(void *tPtr,const Address &zta)
@@ -116,7 +112,7 @@ SharedPtr<Peer> Topology::getPeer(void *tPtr,const Address &zta)
 		return SharedPtr<Peer>();
 
 	{
-		Mutex::Lock _l(_peers_m);
+		Epoch::Guard _g(_epoch);
 		const SharedPtr<Peer> *const ap = _peers.get(zta);
 		if (ap)
 			return *ap;
@@ -128,13 +124,11 @@ SharedPtr<Peer> Topology::getPeer(void *tPtr,const Address &zta)
 		int len = RR->node->stateObjectGet(tPtr,ZT_STATE_OBJECT_PEER,idbuf,buf.unsafeData(),ZT_PEER_MAX_SERIALIZED_STATE_SIZE);
 		if (len > 0) {
 			buf.setSize(len);
-			Mutex::Lock _l(_peers_m);
-			SharedPtr<Peer> &ap = _peers[zta];
-			if (ap)
-				return ap;
-			ap = Peer::deserializeFromCache(RR->node->now(),tPtr,buf,RR);
-			if (!ap) {
-				_peers.erase(zta);
+			const SharedPtr<Peer> np(Peer::deserializeFromCache(RR->node->now(),tPtr,buf,RR));
+			if (np) {
+				const SharedPtr<Peer> ap(_peers.setIfAbsent(zta,np));
+				if (ap != np)
+					return ap;
 			}
 			return SharedPtr<Peer>();
 		}
@@ -148,7 +142,7 @@ Identity Topology::getIdentity(void *tPtr,const Address &zta)
 	if (zta == RR->identity.address()) {
 		return RR->identity;
 	} else {
-		Mutex::Lock _l(_peers_m);
+		Epoch::Guard _g(_epoch);
 		const SharedPtr<Peer> *const ap = _peers.get(zta);
 		if (ap)
 			return (*ap)->identity();
@@ -162,8 +156,8 @@ SharedPtr<Peer> Topology::getUpstreamPeer()
 	unsigned int bestq = ~((unsigned int)0);
 	const SharedPtr<Peer> *best = (const SharedPtr<Peer> *)0;
 
-	Mutex::Lock _l2(_peers_m);
-	Mutex::Lock _l1(_upstreams_m);
+	Mutex::Lock _l(_upstreams_m);
+	Epoch::Guard _g(_epoch);
 
 	for(std::vector<Address>::const_iterator a(_upstreamAddresses.begin());a!=_upstreamAddresses.end();++a) {
 		const SharedPtr<Peer> *p = _peers.get(*a);
@@ -252,8 +246,7 @@ bool Topology::addWorld(void *tPtr,const World &newWorld,bool alwaysAcceptNew)
 	if ((newWorld.type() != World::TYPE_PLANET)&&(newWorld.type() != World::TYPE_MOON))
 		return false;
 
-	Mutex::Lock _l2(_peers_m);
-	Mutex::Lock _l1(_upstreams_m);
+	Mutex::Lock _l(_upstreams_m);
 
 	World *existing = (World *)0;
 	switch(newWorld.type()) {
@@ -341,8 +334,7 @@ void Topology::addMoon(void *tPtr,const uint64_t id,const Address &seed)
 
 void Topology::removeMoon(void *tPtr,const uint64_t id)
 {
-	Mutex::Lock _l2(_peers_m);
-	Mutex::Lock _l1(_upstreams_m);
+	Mutex::Lock _l(_upstreams_m);
 
 	std::vector<World> nm;
 	for(std::vector<World>::const_iterator m(_moons.begin());m!=_moons.end();++m) {
@@ -369,34 +361,27 @@ void Topology::removeMoon(void *tPtr,const uint64_t id)
 void Topology::doPeriodicTasks(void *tPtr,int64_t now)
 {
 	{
-		Mutex::Lock _l1(_peers_m);
-		Mutex::Lock _l2(_upstreams_m);
-		Hashtable< Address,SharedPtr<Peer> >::Iterator i(_peers);
-		Address *a = (Address *)0;
-		SharedPtr<Peer> *p = (SharedPtr<Peer> *)0;
-		while (i.next(a,p)) {
-			if ( (!(*p)->isAlive(now)) && (std::find(_upstreamAddresses.begin(),_upstreamAddresses.end(),*a) == _upstreamAddresses.end()) ) {
-				_savePeer(tPtr,*p);
-				_peers.erase(*a);
+		const std::vector< std::pair< Address,SharedPtr<Peer> > > peers(_peers.entries());
+		Mutex::Lock _l(_upstreams_m);
+		for(std::vector< std::pair< Address,SharedPtr<Peer> > >::const_iterator p(peers.begin());p!=peers.end();++p) {
+			if ( (!p->second->isAlive(now)) && (std::find(_upstreamAddresses.begin(),_upstreamAddresses.end(),p->first) == _upstreamAddresses.end()) ) {
+				_savePeer(tPtr,p->second);
+				_peers.erase(p->first);
 			}
 		}
 	}
 
-	{
-		Mutex::Lock _l(_paths_m);
-		Hashtable< Path::HashKey,SharedPtr<Path> >::Iterator i(_paths);
-		Path::HashKey *k = (Path::HashKey *)0;
-		SharedPtr<Path> *p = (SharedPtr<Path> *)0;
-		while (i.next(k,p)) {
-			if (p->references() <= 1)
-				_paths.erase(*k);
-		}
-	}
+	// Each shard is swept on its own and erases only take that shard's lock, so
+	// lookups and path creation in every shard carry on during expiry.
+	for(unsigned int i=0;i<ZT_TOPOLOGY_PATH_SHARDS;++i)
+		_paths[i]->each(_ExpirePaths(*(_paths[i]),now));
+
+	_epoch.reclaim();
 }
 
 void Topology::_memoizeUpstreams(void *tPtr)
 {
-	// assumes _upstreams_m and _peers_m are locked
+	// assumes _upstreams_m is locked
 	_upstreamAddresses.clear();
 	_amUpstream = false;
 
@@ -405,9 +390,8 @@ void Topology::_memoizeUpstreams(void *tPtr)
 			_amUpstream = true;
 		} else if (std::find(_upstreamAddresses.begin(),_upstreamAddresses.end(),i->identity.address()) == _upstreamAddresses.end()) {
 			_upstreamAddresses.push_back(i->identity.address());
-			SharedPtr<Peer> &hp = _peers[i->identity.address()];
-			if (!hp)
-				hp = new Peer(RR,RR->identity,i->identity);
+			if (!_peers.contains(i->identity.address()))
+				_peers.setIfAbsent(i->identity.address(),SharedPtr<Peer>(new Peer(RR,RR->identity,i->identity)));
 		}
 	}
 
@@ -417,9 +401,8 @@ void Topology::_memoizeUpstreams(void *tPtr)
 				_amUpstream = true;
 			} else if (std::find(_upstreamAddresses.begin(),_upstreamAddresses.end(),i->identity.address()) == _upstreamAddresses.end()) {
 				_upstreamAddresses.push_back(i->identity.address());
-				SharedPtr<Peer> &hp = _peers[i->identity.address()];
-				if (!hp)
-					hp = new Peer(RR,RR->identity,i->identity);
+				if (!_peers.contains(i->identity.address()))
+					_peers.setIfAbsent(i->identity.address(),SharedPtr<Peer>(new Peer(RR,RR->identity,i->identity)));
 			}
 		}
 	}
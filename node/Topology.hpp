@@ -45,6 +45,9 @@
 #include "Mutex.hpp"
 #include "InetAddress.hpp"
 #include "Hashtable.hpp"
+#include "ConcurrentHashtable.hpp"
+#include "Epoch.hpp"
+#include "BorrowedPtr.hpp"
 #include "World.hpp"
 
 namespace ZeroTier {
@@ -81,6 +84,25 @@ public:
 	 */
 	SharedPtr<Peer> getPeer(void *tPtr,const Address &zta);
 
+	/**
+	 * Get a peer from its address without touching its reference count
+	 *
+	 * This behaves like getPeer() but returns a borrowed pointer that remains
+	 * valid as long as the supplied guard, which must be on epoch(), is held.
+	 *
+	 * @param tPtr Thread pointer to be handed through to any callbacks called as a result of this call
+	 * @param zta ZeroTier address of peer
+	 * @param g Guard on epoch()
+	 * @return Peer or NULL if not found
+	 */
+	inline BorrowedPtr<Peer> getPeer(void *tPtr,const Address &zta,const Epoch::Guard &g)
+	{
+		const SharedPtr<Peer> *ap = _peers.get(zta);
+		if ((!ap)&&(getPeer(tPtr,zta))) // slow path, may load from cache
+			ap = _peers.get(zta);
+		return (ap) ? BorrowedPtr<Peer>(*ap) : BorrowedPtr<Peer>();
+	}
+
 	/**
 	 * @param tPtr Thread pointer to be handed through to any callbacks called as a result of this call
 	 * @param zta ZeroTier address of peer
@@ -100,11 +122,9 @@ public:
 	 */
 	inline SharedPtr<Peer> getPeerNoCache(const Address &zta)
 	{
-		Mutex::Lock _l(_peers_m);
-		const SharedPtr<Peer> *const ap = _peers.get(zta);
-		if (ap)
-			return *ap;
-		return SharedPtr<Peer>();
+		SharedPtr<Peer> p;
+		_peers.get(zta,p);
+		return p;
 	}
 
 	/**
@@ -116,10 +136,11 @@ public:
 	 */
 	inline SharedPtr<Path> getPath(const int64_t l,const InetAddress &r)
 	{
-		Mutex::Lock _l(_paths_m);
-		SharedPtr<Path> &p = _paths[Path::HashKey(l,r)];
-		if (!p)
-			p.set(new Path(l,r));
+		const Path::HashKey k(l,r);
+		ConcurrentHashtable< Path::HashKey,SharedPtr<Path> > &shard = *(_paths[_pathShard(k)]);
+		SharedPtr<Path> p;
+		if (!shard.get(k,p))
+			p = shard.setIfAbsent(k,SharedPtr<Path>(new Path(l,r))); // only locks this shard
 		return p;
 	}
 
@@ -293,35 +314,24 @@ public:
 	 */
 	inline unsigned long countActive(int64_t now) const
 	{
-		unsigned long cnt = 0;
-		Mutex::Lock _l(_peers_m);
-		Hashtable< Address,SharedPtr<Peer> >::Iterator i(const_cast<Topology *>(this)->_peers);
-		Address *a = (Address *)0;
-		SharedPtr<Peer> *p = (SharedPtr<Peer> *)0;
-		while (i.next(a,p)) {
-			const SharedPtr<Path> pp((*p)->getAppropriatePath(now,false));
-			if (pp)
-				++cnt;
-		}
-		return cnt;
+		_CountActive ca(now);
+		_peers.each<_CountActive &>(ca);
+		return ca.cnt;
 	}
 
 	/**
 	 * Apply a function or function object to all peers
 	 *
+	 * This does not lock the peer table, so f may look up or add peers. Peers
+	 * added or removed while this runs may or may not be visited.
+	 *
 	 * @param f Function to apply
 	 * @tparam F Function or function object type
 	 */
 	template<typename F>
 	inline void eachPeer(F f)
 	{
-		Mutex::Lock _l(_peers_m);
-		Hashtable< Address,SharedPtr<Peer> >::Iterator i(_peers);
-		Address *a = (Address *)0;
-		SharedPtr<Peer> *p = (SharedPtr<Peer> *)0;
-		while (i.next(a,p)) {
-			f(*this,*((const SharedPtr<Peer> *)p));
-		}
+		_peers.each(_EachPeer<F>(*this,f));
 	}
 
 	/**
@@ -329,10 +339,14 @@ public:
 	 */
 	inline std::vector< std::pair< Address,SharedPtr<Peer> > > allPeers() const
 	{
-		Mutex::Lock _l(_peers_m);
 		return _peers.entries();
 	}
 
+	/**
+	 * @return Epoch domain that protects peers returned as borrowed pointers
+	 */
+	inline const Epoch &epoch() const { return _epoch; }
+
 	/**
 	 * @return True if I am a root server in a planet or moon
 	 */
@@ -441,6 +455,47 @@ public:
 	}
 
 private:
+	struct _CountActive
+	{
+		_CountActive(int64_t n) : now(n),cnt(0) {}
+		inline void operator()(const Address &a,const SharedPtr<Peer> &p)
+		{
+			if (p->getAppropriatePath(now,false))
+				++cnt;
+		}
+		const int64_t now;
+		unsigned long cnt;
+	};
+
+	template<typename F>
+	struct _EachPeer
+	{
+		_EachPeer(Topology &t,F &f) : t(t),f(f) {}
+		inline void operator()(const Address &a,const SharedPtr<Peer> &p) { f(t,p); }
+		Topology &t;
+		F &f;
+	};
+
+	// Erases paths nothing else references. A path that hasn't received anything
+	// recently is also required, since a receiver may have just looked it up and
+	// not taken its reference yet; if that still happens it just ends up holding
+	// a path that is no longer canonical, which peers replace like any other
+	// redundant path to the same address.
+	struct _ExpirePaths
+	{
+		_ExpirePaths(ConcurrentHashtable< Path::HashKey,SharedPtr<Path> > &s,int64_t n) : shard(s),now(n) {}
+		inline void operator()(const Path::HashKey &k,const SharedPtr<Path> &p)
+		{
+			if ((p.references() <= 1)&&((now - p->lastIn()) > ZT_PATH_HEARTBEAT_PERIOD))
+				shard.erase(k);
+		}
+		ConcurrentHashtable< Path::HashKey,SharedPtr<Path> > &shard;
+		const int64_t now;
+	};
+
+	// Uses different hash bits than ConcurrentHashtable's slot index, so each shard's keys still spread over its whole table
+	static inline unsigned int _pathShard(const Path::HashKey &k) { return (unsigned int)(((uint64_t)k.hashCode() * 0x9e3779b97f4a7c15ULL) >> 32) & (ZT_TOPOLOGY_PATH_SHARDS - 1); }
+
 	Identity _getIdentity(void *tPtr,const Address &zta);
 	void _memoizeUpstreams(void *tPtr);
 	void _savePeer(void *tPtr,const SharedPtr<Peer> &peer);
@@ -450,11 +505,10 @@ private:
 	std::pair<InetAddress,ZT_PhysicalPathConfiguration> _physicalPathConfig[ZT_MAX_CONFIGURABLE_PATHS];
 	volatile unsigned int _numConfiguredPhysicalPaths;
 
-	Hashtable< Address,SharedPtr<Peer> > _peers;
-	Mutex _peers_m;
+	Epoch _epoch; // must be declared before (and so outlive) the tables that use it
+	ConcurrentHashtable< Address,SharedPtr<Peer> > _peers;
 
-	Hashtable< Path::HashKey,SharedPtr<Path> > _paths;
-	Mutex _paths_m;
+	ConcurrentHashtable< Path::HashKey,SharedPtr<Path> > *_paths[ZT_TOPOLOGY_PATH_SHARDS];
 
 	World _planet;
 	std::vector<World> _moons;
@@ -98,7 +98,20 @@ private:
 	};
 
 public:
-	Binder() : _bindingCount(0) {}
+	/**
+	 * @param udpOnly If true, bind only UDP sockets and no TCP listen sockets (default: false)
+	 */
+	Binder(const bool udpOnly = false) : _bindingCount(0),_udpOnly(udpOnly),_udpReusePort(false) {}
+
+	/**
+	 * Set SO_REUSEPORT on UDP sockets created by future calls to refresh()
+	 *
+	 * This lets more than one Binder, each with its own Phy, bind the same
+	 * addresses so the kernel can spread incoming traffic across them.
+	 *
+	 * @param rp Enable or disable SO_REUSEPORT
+	 */
+	inline void setUdpReusePort(const bool rp) { _udpReusePort = rp; }
 
 	/**
 	 * Close all bound ports, should be called on shutdown
@@ -369,9 +382,9 @@ public:
 				++bi;
 			}
 			if (bi == _bindingCount) {
-				udps = phy.udpBind(reinterpret_cast<const struct sockaddr *>(&(ii->first)),(void *)0,ZT_UDP_DESIRED_BUF_SIZE);
-				tcps = phy.tcpListen(reinterpret_cast<const struct sockaddr *>(&(ii->first)),(void *)0);
-				if ((udps)&&(tcps)) {
+				udps = phy.udpBind(reinterpret_cast<const struct sockaddr *>(&(ii->first)),(void *)0,ZT_UDP_DESIRED_BUF_SIZE,_udpReusePort);
+				tcps = (_udpOnly) ? (PhySocket *)0 : phy.tcpListen(reinterpret_cast<const struct sockaddr *>(&(ii->first)),(void *)0);
+				if ((udps)&&((tcps)||(_udpOnly))) {
 #ifdef __LINUX__
 					// Bind Linux sockets to their device so routes that we manage do not override physical routes (wish all platforms had this!)
 					if (ii->second.length() > 0) {
@@ -380,9 +393,11 @@ public:
 						int fd = (int)Phy<PHY_HANDLER_TYPE>::getDescriptor(udps);
 						if (fd >= 0)
 							setsockopt(fd,SOL_SOCKET,SO_BINDTODEVICE,tmp,strlen(tmp));
-						fd = (int)Phy<PHY_HANDLER_TYPE>::getDescriptor(tcps);
-						if (fd >= 0)
-							setsockopt(fd,SOL_SOCKET,SO_BINDTODEVICE,tmp,strlen(tmp));
+						if (tcps) {
+							fd = (int)Phy<PHY_HANDLER_TYPE>::getDescriptor(tcps);
+							if (fd >= 0)
+								setsockopt(fd,SOL_SOCKET,SO_BINDTODEVICE,tmp,strlen(tmp));
+						}
 					}
 #endif // __LINUX__
 					if (_bindingCount < ZT_BINDER_MAX_BINDINGS) {
@@ -460,6 +475,8 @@ public:
 private:
 	_Binding _bindings[ZT_BINDER_MAX_BINDINGS];
 	std::atomic<unsigned int> _bindingCount;
+	const bool _udpOnly;
+	bool _udpReusePort;
 	Mutex _lock;
 };
 
@@ -0,0 +1,309 @@
+/*
+ * ZeroTier One - Network Virtualization Everywhere
+ * Copyright (C) 2011-2019  ZeroTier, Inc.  https://www.zerotier.com/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * --
+ *
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial closed-source software that incorporates or links
+ * directly against ZeroTier software without disclosing the source code
+ * of your own application.
+ */
+
+#ifndef ZT_IOURING_HPP
+#define ZT_IOURING_HPP
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+namespace ZeroTier {
+
+/**
+ * Minimal io_uring instance driven with raw system calls
+ *
+ * This covers just what Phy needs: one submission and completion queue and
+ * optionally one ring of provided buffers for multishot receives. It talks
+ * to the kernel directly so there is no dependency on liburing.
+ *
+ * This is Linux-only and not thread-safe.
+ */
+class IoUring
+{
+public:
+	IoUring() :
+		_fd(-1),
+		_ring((uint8_t *)0),
+		_ringSize(0),
+		_sqes((struct io_uring_sqe *)0),
+		_sqesSize(0),
+		_sqeTail(0),
+		_sqeSubmitted(0),
+		_bufRing((struct io_uring_buf *)0),
+		_bufRingSize(0),
+		_bufs((uint8_t *)0),
+		_bufCount(0),
+		_bufSize(0),
+		_bufTail(0) {}
+
+	~IoUring() { close(); }
+
+	/**
+	 * Create the ring
+	 *
+	 * @param entries Submission queue size (power of two)
+	 * @return True on success, false if io_uring is unavailable or disabled
+	 */
+	inline bool open(const unsigned int entries)
+	{
+		struct io_uring_params p;
+		memset(&p,0,sizeof(p));
+		p.flags = IORING_SETUP_CLAMP;
+		_fd = (int)::syscall(__NR_io_uring_setup,entries,&p);
+		if (_fd < 0)
+			return false;
+		if ((p.features & IORING_FEAT_SINGLE_MMAP) == 0) { // 5.4+, saves mapping the CQ separately
+			close();
+			return false;
+		}
+
+		_ringSize = p.sq_off.array + (p.sq_entries * sizeof(uint32_t));
+		if ((p.cq_off.cqes + (p.cq_entries * sizeof(struct io_uring_cqe))) > _ringSize)
+			_ringSize = p.cq_off.cqes + (p.cq_entries * sizeof(struct io_uring_cqe));
+		void *r = ::mmap((void *)0,_ringSize,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_POPULATE,_fd,IORING_OFF_SQ_RING);
+		if (r == MAP_FAILED) {
+			_ringSize = 0;
+			close();
+			return false;
+		}
+		_ring = reinterpret_cast<uint8_t *>(r);
+		_sqesSize = p.sq_entries * sizeof(struct io_uring_sqe);
+		r = ::mmap((void *)0,_sqesSize,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_POPULATE,_fd,IORING_OFF_SQES);
+		if (r == MAP_FAILED) {
+			_sqesSize = 0;
+			close();
+			return false;
+		}
+		_sqes = reinterpret_cast<struct io_uring_sqe *>(r);
+
+		_sqHead = reinterpret_cast<uint32_t *>(_ring + p.sq_off.head);
+		_sqTail = reinterpret_cast<uint32_t *>(_ring + p.sq_off.tail);
+		_sqFlags = reinterpret_cast<uint32_t *>(_ring + p.sq_off.flags);
+		_sqMask = *reinterpret_cast<uint32_t *>(_ring + p.sq_off.ring_mask);
+		_sqEntries = p.sq_entries;
+		_cqHead = reinterpret_cast<uint32_t *>(_ring + p.cq_off.head);
+		_cqTail = reinterpret_cast<uint32_t *>(_ring + p.cq_off.tail);
+		_cqMask = *reinterpret_cast<uint32_t *>(_ring + p.cq_off.ring_mask);
+		_cqes = reinterpret_cast<struct io_uring_cqe *>(_ring + p.cq_off.cqes);
+
+		// SQ array slots map one to one to SQEs, so it never has to be updated again
+		uint32_t *const sqArray = reinterpret_cast<uint32_t *>(_ring + p.sq_off.array);
+		for(uint32_t i=0;i<p.sq_entries;++i)
+			sqArray[i] = i;
+
+		return true;
+	}
+
+	/**
+	 * Destroy the ring, cancelling anything still in flight
+	 */
+	inline void close()
+	{
+		if (_fd >= 0) {
+			::close(_fd);
+			_fd = -1;
+		}
+		if (_sqes) {
+			::munmap(_sqes,_sqesSize);
+			_sqes = (struct io_uring_sqe *)0;
+		}
+		if (_ring) {
+			::munmap(_ring,_ringSize);
+			_ring = (uint8_t *)0;
+		}
+		if (_bufRing) {
+			::munmap(_bufRing,_bufRingSize);
+			_bufRing = (struct io_uring_buf *)0;
+		}
+		::free(_bufs);
+		_bufs = (uint8_t *)0;
+	}
+
+	/**
+	 * Register a ring of provided buffers for IOSQE_BUFFER_SELECT requests
+	 *
+	 * @param bgid Buffer group ID
+	 * @param count Number of buffers (power of two, at most 32768)
+	 * @param size Size of each buffer in bytes
+	 * @return True on success, false if the kernel lacks IORING_REGISTER_PBUF_RING (5.19+)
+	 */
+	inline bool setupBuffers(const uint16_t bgid,const unsigned int count,const unsigned int size)
+	{
+		_bufRingSize = count * sizeof(struct io_uring_buf);
+		void *r = ::mmap((void *)0,_bufRingSize,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+		if (r == MAP_FAILED)
+			return false;
+		_bufRing = reinterpret_cast<struct io_uring_buf *>(r);
+
+		struct io_uring_buf_reg reg;
+		memset(&reg,0,sizeof(reg));
+		reg.ring_addr = (uint64_t)(uintptr_t)_bufRing;
+		reg.ring_entries = count;
+		reg.bgid = bgid;
+		if (::syscall(__NR_io_uring_register,_fd,IORING_REGISTER_PBUF_RING,&reg,1) != 0) {
+			::munmap(_bufRing,_bufRingSize);
+			_bufRing = (struct io_uring_buf *)0;
+			return false;
+		}
+
+		_bufs = reinterpret_cast<uint8_t *>(::malloc((size_t)count * (size_t)size));
+		if (!_bufs)
+			return false; // ring stays registered but empty, receives fail with ENOBUFS
+		_bufCount = count;
+		_bufSize = size;
+		for(unsigned int i=0;i<count;++i)
+			recycleBuffer(i);
+		return true;
+	}
+
+	/**
+	 * @param bid Buffer ID from a completion's flags
+	 * @return Pointer to buffer
+	 */
+	inline uint8_t *buffer(const unsigned int bid) const { return _bufs + ((size_t)bid * (size_t)_bufSize); }
+
+	/**
+	 * Give a buffer back to the kernel once its contents have been consumed
+	 *
+	 * @param bid Buffer ID
+	 */
+	inline void recycleBuffer(const unsigned int bid)
+	{
+		struct io_uring_buf &b = _bufRing[_bufTail & (_bufCount - 1)];
+		b.addr = (uint64_t)(uintptr_t)buffer(bid);
+		b.len = _bufSize;
+		b.bid = (uint16_t)bid;
+		++_bufTail;
+		// The ring tail overlays the reserved field of the first entry
+		__atomic_store_n(reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(_bufRing) + 14),_bufTail,__ATOMIC_RELEASE);
+	}
+
+	/**
+	 * @return Next free zeroed submission queue entry or NULL if the queue is full
+	 */
+	inline struct io_uring_sqe *getSqe()
+	{
+		if ((_sqeTail - __atomic_load_n(_sqHead,__ATOMIC_ACQUIRE)) >= _sqEntries)
+			return (struct io_uring_sqe *)0;
+		struct io_uring_sqe *const sqe = &(_sqes[_sqeTail & _sqMask]);
+		++_sqeTail;
+		memset(sqe,0,sizeof(struct io_uring_sqe));
+		return sqe;
+	}
+
+	/**
+	 * Submit entries obtained with getSqe() and optionally wait for completions
+	 *
+	 * @param waitFor Number of completions to wait for (default: 0)
+	 * @return Number of entries submitted or negative errno
+	 */
+	inline int submit(const unsigned int waitFor = 0)
+	{
+		__atomic_store_n(_sqTail,_sqeTail,__ATOMIC_RELEASE);
+		const unsigned int n = _sqeTail - _sqeSubmitted;
+		for(;;) {
+			const int r = (int)::syscall(__NR_io_uring_enter,_fd,n,waitFor,(waitFor > 0) ? IORING_ENTER_GETEVENTS : 0,(void *)0,0);
+			if (r >= 0) {
+				_sqeSubmitted += (unsigned int)r;
+				return r;
+			}
+			if (errno != EINTR)
+				return -errno;
+		}
+	}
+
+	/**
+	 * @return True if completions were dropped into the kernel's overflow list because the CQ was full
+	 */
+	inline bool cqOverflowed() const { return ((__atomic_load_n(_sqFlags,__ATOMIC_ACQUIRE) & IORING_SQ_CQ_OVERFLOW) != 0); }
+
+	/**
+	 * Move overflowed completions back into the CQ without waiting
+	 */
+	inline void flushOverflow()
+	{
+		while (((int)::syscall(__NR_io_uring_enter,_fd,0,0,IORING_ENTER_GETEVENTS,(void *)0,0) < 0)&&(errno == EINTR)) {}
+	}
+
+	/**
+	 * @return Oldest unconsumed completion or NULL if there are none
+	 */
+	inline struct io_uring_cqe *peekCqe() const
+	{
+		const uint32_t head = *_cqHead;
+		if (head == __atomic_load_n(_cqTail,__ATOMIC_ACQUIRE))
+			return (struct io_uring_cqe *)0;
+		return &(_cqes[head & _cqMask]);
+	}
+
+	/**
+	 * Mark the completion returned by peekCqe() as consumed
+	 */
+	inline void cqeSeen() { __atomic_store_n(_cqHead,*_cqHead + 1,__ATOMIC_RELEASE); }
+
+	/**
+	 * @return Ring file descriptor, readable (e.g. via epoll) when completions are waiting
+	 */
+	inline int fd() const { return _fd; }
+
+private:
+	int _fd;
+
+	uint8_t *_ring;
+	size_t _ringSize;
+	struct io_uring_sqe *_sqes;
+	size_t _sqesSize;
+
+	uint32_t *_sqHead;
+	uint32_t *_sqTail;
+	uint32_t *_sqFlags;
+	uint32_t _sqMask;
+	uint32_t _sqEntries;
+	uint32_t _sqeTail;
+	uint32_t _sqeSubmitted;
+
+	uint32_t *_cqHead;
+	uint32_t *_cqTail;
+	uint32_t _cqMask;
+	struct io_uring_cqe *_cqes;
+
+	struct io_uring_buf *_bufRing;
+	size_t _bufRingSize;
+	uint8_t *_bufs;
+	unsigned int _bufCount;
+	unsigned int _bufSize;
+	uint16_t _bufTail;
+};
+
+} // namespace ZeroTier
+
+#endif
@@ -67,6 +67,48 @@ static const ZeroTier::MulticastGroup _blindWildcardMulticastGroup(ZeroTier::MAC
 namespace ZeroTier {
 
 static Mutex __tapCreateLock;
+static std::atomic<unsigned int> __tapQueueCount(1);
+static std::atomic<bool> __tapOffload(false);
+
+// Legacy virtio-net header as prepended by the kernel with IFF_VNET_HDR (from linux/virtio_net.h,
+// which can't be included from C++ since it uses 'class' as a field name)
+struct virtio_net_hdr
+{
+	uint8_t flags;
+	uint8_t gso_type;
+	uint16_t hdr_len;
+	uint16_t gso_size;
+	uint16_t csum_start;
+	uint16_t csum_offset;
+};
+#define VIRTIO_NET_HDR_F_NEEDS_CSUM 1
+#define VIRTIO_NET_HDR_GSO_NONE 0
+#define VIRTIO_NET_HDR_GSO_TCPV4 1
+#define VIRTIO_NET_HDR_GSO_TCPV6 4
+#define VIRTIO_NET_HDR_GSO_ECN 0x80
+
+// Largest frame the kernel will hand us with TSO enabled, plus virtio-net header
+#define ZT_LINUX_TAP_OFFLOAD_BUF_SIZE (65536 + 256)
+
+// Internet checksum helpers for completing offloaded checksums and segmenting super-frames
+static inline uint64_t _csumAdd(uint64_t sum,const uint8_t *p,unsigned int len)
+{
+	while (len > 1) {
+		sum += ((uint64_t)p[0] << 8) | (uint64_t)p[1];
+		p += 2;
+		len -= 2;
+	}
+	if (len)
+		sum += (uint64_t)p[0] << 8;
+	return sum;
+}
+static inline uint16_t _csumFold(uint64_t sum)
+{
+	while (sum >> 16)
+		sum = (sum & 0xffff) + (sum >> 16);
+	return (uint16_t)~sum;
+}
+static inline void _setU16(uint8_t *p,unsigned int v) { p[0] = (uint8_t)(v >> 8); p[1] = (uint8_t)v; }
 
 static const char _base32_chars[32] = { 'a','b','c','d','e','f','g','h','i','j','k','l','m','n','o','p','q','r','s','t','u','v','w','x','y','z','2','3','4','5','6','7' };
 static void _base32_5_to_8(const uint8_t *in,char *out)
@@ -93,9 +135,11 @@ LinuxEthernetTap::LinuxEthernetTap(
 	_handler(handler),
 	_arg(arg),
 	_nwid(nwid),
+	_queueCount(1),
 	_homePath(homePath),
 	_mtu(mtu),
 	_fd(0),
+	_vnetHdr(__tapOffload),
 	_enabled(true)
 {
 	char procpath[128],nwids[32];
@@ -173,10 +217,38 @@ LinuxEthernetTap::LinuxEthernetTap(
 #endif
 	}
 
-	ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
-	if (ioctl(_fd,TUNSETIFF,(void *)&ifr) < 0) {
-		::close(_fd);
-		throw std::runtime_error("unable to configure TUN/TAP device for TAP operation");
+	// Ask for multi-queue and offload if configured, dropping them in that order if the kernel refuses
+	unsigned int queueCount = __tapQueueCount;
+	short tapFlags;
+	for(;;) {
+		tapFlags = IFF_TAP | IFF_NO_PI;
+#ifdef IFF_MULTI_QUEUE
+		if (queueCount > 1)
+			tapFlags |= IFF_MULTI_QUEUE;
+#else
+		queueCount = 1;
+#endif
+		if (_vnetHdr)
+			tapFlags |= IFF_VNET_HDR;
+		ifr.ifr_flags = tapFlags;
+		if (ioctl(_fd,TUNSETIFF,(void *)&ifr) == 0)
+			break;
+		if (queueCount > 1) {
+			queueCount = 1;
+		} else if (_vnetHdr) {
+			_vnetHdr = false;
+		} else {
+			::close(_fd);
+			throw std::runtime_error("unable to configure TUN/TAP device for TAP operation");
+		}
+	}
+
+	if (_vnetHdr) {
+		int hdrSize = (int)sizeof(struct virtio_net_hdr);
+		(void)ioctl(_fd,TUNSETVNETHDRSZ,&hdrSize);
+		// Without TSO we still get checksum offload, and without that plain frames with a header
+		if (ioctl(_fd,TUNSETOFFLOAD,(unsigned long)(TUN_F_CSUM | TUN_F_TSO4 | TUN_F_TSO6)) < 0)
+			(void)ioctl(_fd,TUNSETOFFLOAD,(unsigned long)TUN_F_CSUM);
 	}
 
 	_dev = ifr.ifr_name;
@@ -231,6 +303,30 @@ LinuxEthernetTap::LinuxEthernetTap(
 	// Set close-on-exec so that devices cannot persist if we fork/exec for update
 	::fcntl(_fd,F_SETFD,fcntl(_fd,F_GETFD) | FD_CLOEXEC);
 
+	_queues[0].parent = this;
+	_queues[0].fd = _fd;
+#ifdef IFF_MULTI_QUEUE
+	// Attach additional queues to the same device, stopping at the first failure
+	while (_queueCount < queueCount) {
+		const int qfd = ::open("/dev/net/tun",O_RDWR);
+		if (qfd <= 0)
+			break;
+		struct ifreq qifr;
+		memset(&qifr,0,sizeof(qifr));
+		Utils::scopy(qifr.ifr_name,sizeof(qifr.ifr_name),_dev.c_str());
+		qifr.ifr_flags = tapFlags;
+		if (ioctl(qfd,TUNSETIFF,(void *)&qifr) < 0) {
+			::close(qfd);
+			break;
+		}
+		::fcntl(qfd,F_SETFL,fcntl(qfd,F_GETFL) & ~O_NONBLOCK);
+		::fcntl(qfd,F_SETFD,fcntl(qfd,F_GETFD) | FD_CLOEXEC);
+		_queues[_queueCount].parent = this;
+		_queues[_queueCount].fd = qfd;
+		++_queueCount;
+	}
+#endif
+
 	(void)::pipe(_shutdownSignalPipe);
 
 	/*
@@ -246,18 +342,31 @@ LinuxEthernetTap::LinuxEthernetTap(
 	}
 	*/
 
-	_thread = Thread::start(this);
+	for(unsigned int q=0;q<_queueCount;++q)
+		_queues[q].thread = Thread::start(&(_queues[q]));
 }
 
 LinuxEthernetTap::~LinuxEthernetTap()
 {
-	(void)::write(_shutdownSignalPipe[1],"\0",1); // causes thread to exit
-	Thread::join(_thread);
-	::close(_fd);
+	(void)::write(_shutdownSignalPipe[1],"\0",1); // causes threads to exit
+	for(unsigned int q=0;q<_queueCount;++q) {
+		Thread::join(_queues[q].thread);
+		::close(_queues[q].fd);
+	}
 	::close(_shutdownSignalPipe[0]);
 	::close(_shutdownSignalPipe[1]);
 }
 
+void LinuxEthernetTap::setQueueCount(unsigned int n)
+{
+	__tapQueueCount = (n < 1) ? 1 : ((n > ZT_LINUX_TAP_MAX_QUEUES) ? ZT_LINUX_TAP_MAX_QUEUES : n);
+}
+
+void LinuxEthernetTap::setOffload(bool en)
+{
+	__tapOffload = en;
+}
+
 void LinuxEthernetTap::setEnabled(bool en)
 {
 	_enabled = en;
@@ -383,16 +492,56 @@ std::vector<InetAddress> LinuxEthernetTap::ips() const
 	return r;
 }
 
+// Hash of the IP 5-tuple (or MACs for non-IP frames) used to pick a queue per flow
+static inline unsigned int _flowHash(const MAC &from,const MAC &to,unsigned int etherType,const uint8_t *data,unsigned int len)
+{
+	uint64_t h = from.toInt() ^ (to.toInt() << 16) ^ (uint64_t)etherType;
+	if ((etherType == 0x0800)&&(len >= 20)) { // IPv4
+		uint32_t a[2];
+		memcpy(a,data + 12,8);
+		h ^= ((uint64_t)a[0] << 32) ^ (uint64_t)a[1] ^ ((uint64_t)data[9] << 40);
+		const unsigned int ihl = (unsigned int)(data[0] & 0x0f) * 4;
+		if (((data[9] == 6)||(data[9] == 17))&&(len >= (ihl + 4))&&((data[6] & 0x3f) == 0)&&(data[7] == 0)) { // unfragmented TCP/UDP only
+			uint32_t ports;
+			memcpy(&ports,data + ihl,4);
+			h ^= (uint64_t)ports << 8;
+		}
+	} else if ((etherType == 0x86dd)&&(len >= 40)) { // IPv6
+		uint64_t a[4];
+		memcpy(a,data + 8,32);
+		h ^= a[0] ^ a[1] ^ a[2] ^ a[3] ^ ((uint64_t)data[6] << 40);
+		if (((data[6] == 6)||(data[6] == 17))&&(len >= 44)) {
+			uint32_t ports;
+			memcpy(&ports,data + 40,4);
+			h ^= (uint64_t)ports << 8;
+		}
+	}
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	return (unsigned int)h;
+}
+
 void LinuxEthernetTap::put(const MAC &from,const MAC &to,unsigned int etherType,const void *data,unsigned int len)
 {
-	char putBuf[ZT_MAX_MTU + 64];
+	char putBuf[ZT_MAX_MTU + 64 + sizeof(struct virtio_net_hdr)];
 	if ((_fd > 0)&&(len <= _mtu)&&(_enabled)) {
-		to.copyTo(putBuf,6);
-		from.copyTo(putBuf + 6,6);
-		*((uint16_t *)(putBuf + 12)) = htons((uint16_t)etherType);
-		memcpy(putBuf + 14,data,len);
-		len += 14;
-		(void)::write(_fd,putBuf,len);
+		const int fd = (_queueCount > 1) ? _queues[_flowHash(from,to,etherType,reinterpret_cast<const uint8_t *>(data),len) % _queueCount].fd : _fd;
+		unsigned int hdrLen = 0;
+		if (_vnetHdr) {
+			// No flags: ZeroTier's MAC covers only the ZeroTier packet, not the
+			// inner frame's TCP/UDP checksum, so the kernel must still verify it.
+			struct virtio_net_hdr vh;
+			memset(&vh,0,sizeof(vh));
+			memcpy(putBuf,&vh,sizeof(vh));
+			hdrLen = sizeof(vh);
+		}
+		to.copyTo(putBuf + hdrLen,6);
+		from.copyTo(putBuf + hdrLen + 6,6);
+		*((uint16_t *)(putBuf + hdrLen + 12)) = htons((uint16_t)etherType);
+		memcpy(putBuf + hdrLen + 14,data,len);
+		len += 14 + hdrLen;
+		(void)::write(fd,putBuf,len);
 	}
 }
 
@@ -469,31 +618,41 @@ void LinuxEthernetTap::setMtu(unsigned int mtu)
 	}
 }
 
-void LinuxEthernetTap::threadMain()
+void LinuxEthernetTap::_readerMain(const int fd)
 	throw()
 {
 	fd_set readfds,nullfds;
 	MAC to,from;
 	int n,nfds,r;
 	char getBuf[ZT_MAX_MTU + 64];
+	uint8_t *offloadBuf = (_vnetHdr) ? new uint8_t[ZT_LINUX_TAP_OFFLOAD_BUF_SIZE] : (uint8_t *)0;
 
 	Thread::sleep(500);
 
 	FD_ZERO(&readfds);
 	FD_ZERO(&nullfds);
-	nfds = (int)std::max(_shutdownSignalPipe[0],_fd) + 1;
+	nfds = (int)std::max(_shutdownSignalPipe[0],fd) + 1;
 
 	r = 0;
 	for(;;) {
 		FD_SET(_shutdownSignalPipe[0],&readfds);
-		FD_SET(_fd,&readfds);
+		FD_SET(fd,&readfds);
 		select(nfds,&readfds,&nullfds,&nullfds,(struct timeval *)0);
 
 		if (FD_ISSET(_shutdownSignalPipe[0],&readfds)) // writes to shutdown pipe terminate thread
 			break;
 
-		if (FD_ISSET(_fd,&readfds)) {
-			n = (int)::read(_fd,getBuf + r,sizeof(getBuf) - r);
+		if ((offloadBuf)&&(FD_ISSET(fd,&readfds))) {
+			// With a virtio-net header every read returns exactly one (possibly GSO) frame
+			n = (int)::read(fd,offloadBuf,ZT_LINUX_TAP_OFFLOAD_BUF_SIZE);
+			if (n < 0) {
+				if ((errno != EINTR)&&(errno != ETIMEDOUT))
+					break;
+			} else if ((n > (int)(sizeof(struct virtio_net_hdr) + 14))&&(_enabled)) {
+				_offloadFrame(offloadBuf,(unsigned int)n);
+			}
+		} else if (FD_ISSET(fd,&readfds)) {
+			n = (int)::read(fd,getBuf + r,sizeof(getBuf) - r);
 			if (n < 0) {
 				if ((errno != EINTR)&&(errno != ETIMEDOUT))
 					break;
@@ -519,6 +678,95 @@ void LinuxEthernetTap::threadMain()
 			}
 		}
 	}
+
+	delete [] offloadBuf;
+}
+
+void LinuxEthernetTap::_offloadFrame(uint8_t *buf,unsigned int len)
+{
+	struct virtio_net_hdr vh;
+	memcpy(&vh,buf,sizeof(vh));
+	uint8_t *const frame = buf + sizeof(vh);
+	len -= sizeof(vh);
+
+	const MAC to(frame,6);
+	const MAC from(frame + 6,6);
+	const unsigned int etherType = ((unsigned int)frame[12] << 8) | (unsigned int)frame[13];
+
+	if ((vh.gso_type & ~VIRTIO_NET_HDR_GSO_ECN) == VIRTIO_NET_HDR_GSO_NONE) {
+		if ((vh.flags & VIRTIO_NET_HDR_F_NEEDS_CSUM) != 0) {
+			// Kernel left the pseudo-header sum in the checksum field for us to finish
+			const unsigned int start = vh.csum_start,offset = vh.csum_offset;
+			if ((start + offset + 2) > len)
+				return;
+			_setU16(frame + start + offset,_csumFold(_csumAdd(0,frame + start,len - start)));
+		}
+		if (len <= (_mtu + 14))
+			_handler(_arg,(void *)0,_nwid,from,to,etherType,0,(const void *)(frame + 14),len - 14);
+		return;
+	}
+
+	// TCP super-frame (TSO): cut into MTU-sized segments with fixed up IP and TCP headers
+	unsigned int ipLen;
+	const bool v4 = (etherType == 0x0800);
+	if ((v4)&&((vh.gso_type & ~VIRTIO_NET_HDR_GSO_ECN) == VIRTIO_NET_HDR_GSO_TCPV4)&&(len >= 34)&&(frame[23] == 6)) {
+		ipLen = (unsigned int)(frame[14] & 0x0f) * 4;
+	} else if ((etherType == 0x86dd)&&((vh.gso_type & ~VIRTIO_NET_HDR_GSO_ECN) == VIRTIO_NET_HDR_GSO_TCPV6)&&(len >= 54)&&(frame[20] == 6)) {
+		ipLen = 40;
+	} else {
+		return; // UFO and IPv6 extension headers are not offloaded to us
+	}
+	const unsigned int l4Off = 14 + ipLen;
+	if (len < (l4Off + 20))
+		return;
+	const unsigned int tcpLen = (unsigned int)(frame[l4Off + 12] >> 4) * 4;
+	const unsigned int hdrLen = l4Off + tcpLen;
+	if ((tcpLen < 20)||(len <= hdrLen)||((hdrLen + 1) > (_mtu + 14)))
+		return;
+	unsigned int mss = vh.gso_size;
+	if ((mss == 0)||((hdrLen + mss) > (_mtu + 14)))
+		mss = (_mtu + 14) - hdrLen;
+
+	const uint32_t seq0 = ((uint32_t)frame[l4Off + 4] << 24) | ((uint32_t)frame[l4Off + 5] << 16) | ((uint32_t)frame[l4Off + 6] << 8) | (uint32_t)frame[l4Off + 7];
+	const unsigned int id0 = ((unsigned int)frame[18] << 8) | (unsigned int)frame[19];
+	const uint8_t tcpFlags = frame[l4Off + 13];
+
+	uint8_t seg[ZT_MAX_MTU + 64];
+	unsigned int i = 0;
+	for(unsigned int off=hdrLen;off<len;off+=mss,++i) {
+		const unsigned int plen = ((len - off) < mss) ? (len - off) : mss;
+		const bool last = ((off + plen) >= len);
+		memcpy(seg,frame,hdrLen);
+		memcpy(seg + hdrLen,frame + off,plen);
+		uint8_t *const ip = seg + 14;
+		uint8_t *const tcp = seg + l4Off;
+
+		uint64_t sum;
+		if (v4) {
+			_setU16(ip + 2,ipLen + tcpLen + plen);
+			_setU16(ip + 4,(id0 + i) & 0xffff);
+			ip[10] = 0; ip[11] = 0;
+			_setU16(ip + 10,_csumFold(_csumAdd(0,ip,ipLen)));
+			sum = _csumAdd(0,ip + 12,8);
+		} else {
+			_setU16(ip + 4,tcpLen + plen);
+			sum = _csumAdd(0,ip + 8,32);
+		}
+		sum += 6 + tcpLen + plen; // pseudo-header protocol and TCP length
+
+		const uint32_t seq = seq0 + (off - hdrLen);
+		tcp[4] = (uint8_t)(seq >> 24); tcp[5] = (uint8_t)(seq >> 16); tcp[6] = (uint8_t)(seq >> 8); tcp[7] = (uint8_t)seq;
+		uint8_t f = tcpFlags;
+		if (!last)
+			f &= ~(0x01 | 0x08); // FIN and PSH only on the last segment
+		if (i > 0)
+			f &= ~0x80; // CWR only on the first
+		tcp[13] = f;
+		tcp[16] = 0; tcp[17] = 0;
+		_setU16(tcp + 16,_csumFold(_csumAdd(sum,tcp,tcpLen + plen)));
+
+		_handler(_arg,(void *)0,_nwid,from,to,etherType,0,(const void *)(seg + 14),hdrLen + plen - 14);
+	}
 }
 
 } // namespace ZeroTier
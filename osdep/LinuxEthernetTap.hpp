@@ -39,6 +39,11 @@
 #include "Thread.hpp"
 #include "EthernetTap.hpp"
 
+/**
+ * Maximum number of TUN queues opened for one tap device
+ */
+#define ZT_LINUX_TAP_MAX_QUEUES 16
+
 namespace ZeroTier {
 
 class LinuxEthernetTap : public EthernetTap
@@ -70,19 +75,55 @@ public:
 	virtual void scanMulticastGroups(std::vector<MulticastGroup> &added,std::vector<MulticastGroup> &removed);
 	virtual void setMtu(unsigned int mtu);
 
-	void threadMain()
-		throw();
+	/**
+	 * Set the number of TUN queues to open for taps created after this call
+	 *
+	 * With more than one queue the device is opened with IFF_MULTI_QUEUE and
+	 * each queue gets its own reader thread. Frames written to the device are
+	 * spread across queues by flow hash so ordering within a flow is kept. If
+	 * the kernel does not support multi-queue taps a single queue is used.
+	 *
+	 * @param n Number of queues (clamped to 1..ZT_LINUX_TAP_MAX_QUEUES, default 1)
+	 */
+	static void setQueueCount(unsigned int n);
+
+	/**
+	 * Set whether taps created after this call use virtio-net header offload
+	 *
+	 * With offload the device is opened with IFF_VNET_HDR and TSO/checksum
+	 * offload is enabled, so the kernel hands us whole TCP super-frames that
+	 * are read with one system call and segmented to the network MTU here
+	 * right before they enter the core. Frames written to the kernel are
+	 * marked as having valid checksums, since they have already been
+	 * authenticated end to end.
+	 *
+	 * @param en True to enable offload (default false)
+	 */
+	static void setOffload(bool en);
 
 private:
+	struct _Queue
+	{
+		LinuxEthernetTap *parent;
+		int fd;
+		Thread thread;
+		void threadMain() throw() { parent->_readerMain(fd); }
+	};
+
+	void _readerMain(const int fd) throw();
+	void _offloadFrame(uint8_t *buf,unsigned int len);
+
 	void (*_handler)(void *,void *,uint64_t,const MAC &,const MAC &,unsigned int,unsigned int,const void *,unsigned int);
 	void *_arg;
 	uint64_t _nwid;
-	Thread _thread;
+	_Queue _queues[ZT_LINUX_TAP_MAX_QUEUES];
+	unsigned int _queueCount;
 	std::string _homePath;
 	std::string _dev;
 	std::vector<MulticastGroup> _multicastGroups;
 	unsigned int _mtu;
 	int _fd;
+	bool _vnetHdr;
 	int _shutdownSignalPipe[2];
 	std::atomic_bool _enabled;
 };
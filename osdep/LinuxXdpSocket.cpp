@@ -0,0 +1,617 @@
+/*
+ * ZeroTier One - Network Virtualization Everywhere
+ * Copyright (C) 2011-2019  ZeroTier, Inc.  https://www.zerotier.com/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * --
+ *
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial closed-source software that incorporates or links
+ * directly against ZeroTier software without disclosing the source code
+ * of your own application.
+ */
+
+#include "../node/Constants.hpp"
+
+#ifdef __LINUX__
+
+#include "../node/Utils.hpp"
+#include "LinuxXdpSocket.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <linux/if_xdp.h>
+#include <linux/if_link.h>
+#include <linux/bpf.h>
+
+#include <vector>
+
+#define ZT_LINUX_XDP_RX_BATCH 64
+
+namespace ZeroTier {
+
+namespace {
+
+static inline int _bpf(int cmd,union bpf_attr *attr)
+{
+	return (int)syscall(__NR_bpf,cmd,attr,sizeof(union bpf_attr));
+}
+
+static inline struct bpf_insn _insn(uint8_t code,uint8_t dst,uint8_t src,int16_t off,int32_t imm)
+{
+	struct bpf_insn i;
+	i.code = code;
+	i.dst_reg = dst;
+	i.src_reg = src;
+	i.off = off;
+	i.imm = imm;
+	return i;
+}
+
+// Assembles the XDP program that redirects ZeroTier UDP to AF_XDP sockets:
+//
+//   r6 = ctx; r2 = ctx->data; r3 = ctx->data_end
+//   if (r2 + 42 > r3) pass
+//   if (eth.type == IPv4) {
+//     if ((ip.vhl != 0x45)||(ip.proto != UDP)||(ip.frag & 0x3fff)||(udp.dport != port)) pass
+//   } else if (eth.type == IPv6) {
+//     if ((r2 + 62 > r3)||(ip6.nexthdr != UDP)||(udp.dport != port)) pass
+//   } else pass
+//   return bpf_redirect_map(map,ctx->rx_queue_index,XDP_PASS)
+static std::vector<struct bpf_insn> _xdpProgram(const int mapFd,const unsigned int port)
+{
+	enum { L_PASS,L_IPV4,L_REDIRECT,L_COUNT };
+	std::vector<struct bpf_insn> p;
+	std::vector< std::pair<unsigned int,int> > fixups;
+	unsigned int labels[L_COUNT];
+
+#define ZT_XDP_I(c,d,s,o,i) p.push_back(_insn((c),(d),(s),(o),(i)))
+#define ZT_XDP_J(c,d,s,i,l) { fixups.push_back(std::pair<unsigned int,int>((unsigned int)p.size(),(l))); ZT_XDP_I((c),(d),(s),0,(i)); }
+#define ZT_XDP_L(l) labels[(l)] = (unsigned int)p.size()
+
+	ZT_XDP_I(BPF_ALU64|BPF_MOV|BPF_X,6,1,0,0);
+	ZT_XDP_I(BPF_LDX|BPF_MEM|BPF_W,2,1,(int16_t)offsetof(struct xdp_md,data),0);
+	ZT_XDP_I(BPF_LDX|BPF_MEM|BPF_W,3,1,(int16_t)offsetof(struct xdp_md,data_end),0);
+	ZT_XDP_I(BPF_ALU64|BPF_MOV|BPF_X,4,2,0,0);
+	ZT_XDP_I(BPF_ALU64|BPF_ADD|BPF_K,4,0,0,42);
+	ZT_XDP_J(BPF_JMP|BPF_JGT|BPF_X,4,3,0,L_PASS);
+	ZT_XDP_I(BPF_LDX|BPF_MEM|BPF_H,5,2,12,0);
+	ZT_XDP_J(BPF_JMP|BPF_JEQ|BPF_K,5,0,(int32_t)htons(0x0800),L_IPV4);
+	ZT_XDP_J(BPF_JMP|BPF_JNE|BPF_K,5,0,(int32_t)htons(0x86dd),L_PASS);
+
+	ZT_XDP_I(BPF_ALU64|BPF_MOV|BPF_X,4,2,0,0);
+	ZT_XDP_I(BPF_ALU64|BPF_ADD|BPF_K,4,0,0,62);
+	ZT_XDP_J(BPF_JMP|BPF_JGT|BPF_X,4,3,0,L_PASS);
+	ZT_XDP_I(BPF_LDX|BPF_MEM|BPF_B,5,2,20,0);
+	ZT_XDP_J(BPF_JMP|BPF_JNE|BPF_K,5,0,IPPROTO_UDP,L_PASS);
+	ZT_XDP_I(BPF_LDX|BPF_MEM|BPF_H,5,2,56,0);
+	ZT_XDP_J(BPF_JMP|BPF_JNE|BPF_K,5,0,(int32_t)htons((uint16_t)port),L_PASS);
+	ZT_XDP_J(BPF_JMP|BPF_JA,0,0,0,L_REDIRECT);
+
+	ZT_XDP_L(L_IPV4);
+	ZT_XDP_I(BPF_LDX|BPF_MEM|BPF_B,5,2,14,0);
+	ZT_XDP_J(BPF_JMP|BPF_JNE|BPF_K,5,0,0x45,L_PASS);
+	ZT_XDP_I(BPF_LDX|BPF_MEM|BPF_B,5,2,23,0);
+	ZT_XDP_J(BPF_JMP|BPF_JNE|BPF_K,5,0,IPPROTO_UDP,L_PASS);
+	ZT_XDP_I(BPF_LDX|BPF_MEM|BPF_H,5,2,20,0);
+	ZT_XDP_I(BPF_ALU64|BPF_AND|BPF_K,5,0,0,(int32_t)htons(0x3fff));
+	ZT_XDP_J(BPF_JMP|BPF_JNE|BPF_K,5,0,0,L_PASS);
+	ZT_XDP_I(BPF_LDX|BPF_MEM|BPF_H,5,2,36,0);
+	ZT_XDP_J(BPF_JMP|BPF_JNE|BPF_K,5,0,(int32_t)htons((uint16_t)port),L_PASS);
+
+	ZT_XDP_L(L_REDIRECT);
+	ZT_XDP_I(BPF_LDX|BPF_MEM|BPF_W,2,6,(int16_t)offsetof(struct xdp_md,rx_queue_index),0);
+	ZT_XDP_I(BPF_LD|BPF_DW|BPF_IMM,1,BPF_PSEUDO_MAP_FD,0,mapFd);
+	ZT_XDP_I(0,0,0,0,0);
+	ZT_XDP_I(BPF_ALU64|BPF_MOV|BPF_K,3,0,0,XDP_PASS);
+	ZT_XDP_I(BPF_JMP|BPF_CALL,0,0,0,BPF_FUNC_redirect_map);
+	ZT_XDP_I(BPF_JMP|BPF_EXIT,0,0,0,0);
+
+	ZT_XDP_L(L_PASS);
+	ZT_XDP_I(BPF_ALU64|BPF_MOV|BPF_K,0,0,0,XDP_PASS);
+	ZT_XDP_I(BPF_JMP|BPF_EXIT,0,0,0,0);
+
+#undef ZT_XDP_I
+#undef ZT_XDP_J
+#undef ZT_XDP_L
+
+	for(std::vector< std::pair<unsigned int,int> >::const_iterator f(fixups.begin());f!=fixups.end();++f)
+		p[f->first].off = (int16_t)((int)labels[f->second] - (int)(f->first + 1));
+	return p;
+}
+
+static inline uint32_t _csumAdd(uint32_t sum,const uint8_t *p,unsigned int len)
+{
+	while (len > 1) {
+		sum += ((uint32_t)p[0] << 8) | (uint32_t)p[1];
+		p += 2;
+		len -= 2;
+	}
+	if (len)
+		sum += (uint32_t)p[0] << 8;
+	return sum;
+}
+
+static inline uint16_t _csumFinish(uint32_t sum)
+{
+	while (sum >> 16)
+		sum = (sum & 0xffff) + (sum >> 16);
+	return (uint16_t)~sum;
+}
+
+static inline uint64_t _mix(uint64_t x)
+{
+	x ^= x >> 31;
+	x *= 0x7fb5d329728ea185ULL;
+	x ^= x >> 27;
+	x *= 0x81dadef4bc2dd44dULL;
+	return x ^ (x >> 33);
+}
+
+} // anonymous namespace
+
+LinuxXdpSocket::LinuxXdpSocket(
+	const char *ifname,
+	unsigned int port,
+	unsigned int queueCount,
+	void (*handler)(void *,LinuxXdpSocket *,const struct sockaddr_storage *,void *,unsigned int),
+	void *arg) :
+	_handler(handler),
+	_arg(arg),
+	_ifname(ifname),
+	_ifindex(0),
+	_port(port),
+	_mtu(1500),
+	_queueCount(0),
+	_candidates(256),
+	_neighbors(256),
+	_candidatesGeneration(0),
+	_mapFd(-1),
+	_progFd(-1),
+	_linkFd(-1),
+	_run(true)
+{
+	union bpf_attr attr;
+
+	_shutdownSignalPipe[0] = -1;
+	_shutdownSignalPipe[1] = -1;
+	for(unsigned int i=0;i<ZT_LINUX_XDP_MAX_QUEUES;++i) {
+		_Queue &q = _queues[i];
+		q.parent = this;
+		q.id = i;
+		q.fd = -1;
+		q.umem = (uint8_t *)0;
+		memset(&q.fill,0,sizeof(_Ring));
+		memset(&q.comp,0,sizeof(_Ring));
+		memset(&q.rx,0,sizeof(_Ring));
+		memset(&q.tx,0,sizeof(_Ring));
+		q.txFreeCount = 0;
+		memset(q.learned,0,sizeof(q.learned));
+	}
+
+	if ((port == 0)||(port > 0xffff))
+		throw std::runtime_error("invalid UDP port");
+	_ifindex = if_nametoindex(ifname);
+	if (!_ifindex)
+		throw std::runtime_error("interface not found");
+
+	{
+		const int sfd = ::socket(AF_INET,SOCK_DGRAM,0);
+		if (sfd < 0)
+			throw std::runtime_error("unable to open control socket");
+		struct ifreq ifr;
+		memset(&ifr,0,sizeof(ifr));
+		Utils::scopy(ifr.ifr_name,IFNAMSIZ,ifname);
+		if (::ioctl(sfd,SIOCGIFHWADDR,&ifr) < 0) {
+			::close(sfd);
+			throw std::runtime_error("unable to get interface MAC address");
+		}
+		_mac.setTo(ifr.ifr_hwaddr.sa_data,6);
+		if (::ioctl(sfd,SIOCGIFMTU,&ifr) == 0)
+			_mtu = (unsigned int)ifr.ifr_mtu;
+		::close(sfd);
+	}
+
+	if (queueCount < 1)
+		queueCount = 1;
+	else if (queueCount > ZT_LINUX_XDP_MAX_QUEUES)
+		queueCount = ZT_LINUX_XDP_MAX_QUEUES;
+
+	try {
+		memset(&attr,0,sizeof(attr));
+		attr.map_type = BPF_MAP_TYPE_XSKMAP;
+		attr.key_size = 4;
+		attr.value_size = 4;
+		attr.max_entries = ZT_LINUX_XDP_MAX_QUEUES;
+		_mapFd = _bpf(BPF_MAP_CREATE,&attr);
+		if (_mapFd < 0)
+			throw std::runtime_error(std::string("unable to create XSKMAP: ") + strerror(errno));
+
+		// Open as many of the requested queues as the NIC actually has
+		for(unsigned int i=0;i<queueCount;++i) {
+			try {
+				_openQueue(_queues[i]);
+			} catch ( ... ) {
+				_closeQueue(_queues[i]);
+				if (i == 0)
+					throw;
+				break;
+			}
+			++_queueCount;
+
+			uint32_t k = i;
+			uint32_t v = (uint32_t)_queues[i].fd;
+			memset(&attr,0,sizeof(attr));
+			attr.map_fd = (uint32_t)_mapFd;
+			attr.key = (uint64_t)(uintptr_t)&k;
+			attr.value = (uint64_t)(uintptr_t)&v;
+			if (_bpf(BPF_MAP_UPDATE_ELEM,&attr) < 0)
+				throw std::runtime_error(std::string("unable to add AF_XDP socket to XSKMAP: ") + strerror(errno));
+		}
+
+		const std::vector<struct bpf_insn> prog(_xdpProgram(_mapFd,port));
+		memset(&attr,0,sizeof(attr));
+		attr.prog_type = BPF_PROG_TYPE_XDP;
+		attr.insn_cnt = (uint32_t)prog.size();
+		attr.insns = (uint64_t)(uintptr_t)prog.data();
+		attr.license = (uint64_t)(uintptr_t)"GPL";
+		_progFd = _bpf(BPF_PROG_LOAD,&attr);
+		if (_progFd < 0)
+			throw std::runtime_error(std::string("unable to load XDP program: ") + strerror(errno));
+
+		// Native mode if the driver supports it, otherwise generic (SKB) mode
+		const uint32_t modes[2] = { XDP_FLAGS_DRV_MODE,XDP_FLAGS_SKB_MODE };
+		for(unsigned int m=0;m<2;++m) {
+			memset(&attr,0,sizeof(attr));
+			attr.link_create.prog_fd = (uint32_t)_progFd;
+			attr.link_create.target_ifindex = _ifindex;
+			attr.link_create.attach_type = BPF_XDP;
+			attr.link_create.flags = modes[m];
+			_linkFd = _bpf(BPF_LINK_CREATE,&attr);
+			if (_linkFd >= 0)
+				break;
+		}
+		if (_linkFd < 0)
+			throw std::runtime_error(std::string("unable to attach XDP program: ") + strerror(errno));
+
+		if (::pipe(_shutdownSignalPipe))
+			throw std::runtime_error("unable to create pipe");
+	} catch ( ... ) {
+		if (_linkFd >= 0)
+			::close(_linkFd);
+		if (_progFd >= 0)
+			::close(_progFd);
+		for(unsigned int i=0;i<ZT_LINUX_XDP_MAX_QUEUES;++i)
+			_closeQueue(_queues[i]);
+		if (_mapFd >= 0)
+			::close(_mapFd);
+		throw;
+	}
+
+	for(unsigned int i=0;i<_queueCount;++i)
+		_queues[i].thread = Thread::start(&(_queues[i]));
+}
+
+LinuxXdpSocket::~LinuxXdpSocket()
+{
+	// Detach first so the kernel stops redirecting to sockets we are about to close
+	::close(_linkFd);
+
+	_run = false;
+	(void)::write(_shutdownSignalPipe[1],"\0",1); // causes threads to exit
+	for(unsigned int i=0;i<_queueCount;++i)
+		Thread::join(_queues[i].thread);
+
+	for(unsigned int i=0;i<ZT_LINUX_XDP_MAX_QUEUES;++i)
+		_closeQueue(_queues[i]);
+	::close(_progFd);
+	::close(_mapFd);
+	::close(_shutdownSignalPipe[0]);
+	::close(_shutdownSignalPipe[1]);
+}
+
+bool LinuxXdpSocket::send(const struct sockaddr_storage *to,const void *data,unsigned int len)
+{
+	const InetAddress &dest = *reinterpret_cast<const InetAddress *>(to);
+	unsigned int hlen;
+	if (dest.ss_family == AF_INET)
+		hlen = 14 + 20 + 8;
+	else if (dest.ss_family == AF_INET6)
+		hlen = 14 + 40 + 8;
+	else return false;
+	if (((hlen + len) > (ZT_LINUX_XDP_FRAME_SIZE - XDP_PACKET_HEADROOM))||((hlen + len - 14) > _mtu))
+		return false;
+
+	_Neighbor nb;
+	{
+		Mutex::Lock _l(_neighbors_l);
+		const _Neighbor *const n = _neighbors.get(dest.ipOnly());
+		if (!n)
+			return false;
+		nb = *n;
+	}
+	if (nb.local.ss_family != dest.ss_family)
+		return false;
+
+	_Queue &q = _queues[(unsigned long)dest.hashCode() % _queueCount];
+	const uint32_t mask = (ZT_LINUX_XDP_FRAMES / 2) - 1;
+
+	Mutex::Lock _l(q.txLock);
+
+	// Reclaim frames the kernel has finished sending
+	uint32_t ccons = *q.comp.consumer;
+	const uint32_t cprod = __atomic_load_n(q.comp.producer,__ATOMIC_ACQUIRE);
+	if (ccons != cprod) {
+		while (ccons != cprod)
+			q.txFree[q.txFreeCount++] = reinterpret_cast<const uint64_t *>(q.comp.descs)[ccons++ & mask];
+		__atomic_store_n(q.comp.consumer,ccons,__ATOMIC_RELEASE);
+	}
+	if (!q.txFreeCount) {
+		::sendto(q.fd,(const void *)0,0,MSG_DONTWAIT,(const struct sockaddr *)0,0);
+		return false;
+	}
+
+	const uint64_t addr = q.txFree[--q.txFreeCount];
+	uint8_t *const f = q.umem + addr;
+	nb.mac.copyTo(f,6);
+	_mac.copyTo(f + 6,6);
+	uint8_t *udp;
+	const unsigned int udpLen = 8 + len;
+	if (dest.ss_family == AF_INET) {
+		f[12] = 0x08; f[13] = 0x00;
+		uint8_t *const ip = f + 14;
+		const unsigned int ipLen = 20 + udpLen;
+		ip[0] = 0x45; ip[1] = 0;
+		ip[2] = (uint8_t)(ipLen >> 8); ip[3] = (uint8_t)ipLen;
+		ip[4] = 0; ip[5] = 0; ip[6] = 0; ip[7] = 0; // no ID, DF not set (same as our UDP sockets)
+		ip[8] = 64; ip[9] = IPPROTO_UDP;
+		ip[10] = 0; ip[11] = 0;
+		memcpy(ip + 12,&(reinterpret_cast<const struct sockaddr_in *>(&nb.local)->sin_addr.s_addr),4);
+		memcpy(ip + 16,&(reinterpret_cast<const struct sockaddr_in *>(to)->sin_addr.s_addr),4);
+		const uint16_t ipsum = _csumFinish(_csumAdd(0,ip,20));
+		ip[10] = (uint8_t)(ipsum >> 8); ip[11] = (uint8_t)ipsum;
+		udp = ip + 20;
+		memcpy(udp + 2,&(reinterpret_cast<const struct sockaddr_in *>(to)->sin_port),2);
+	} else {
+		f[12] = 0x86; f[13] = 0xdd;
+		uint8_t *const ip = f + 14;
+		ip[0] = 0x60; ip[1] = 0; ip[2] = 0; ip[3] = 0;
+		ip[4] = (uint8_t)(udpLen >> 8); ip[5] = (uint8_t)udpLen;
+		ip[6] = IPPROTO_UDP; ip[7] = 64;
+		memcpy(ip + 8,reinterpret_cast<const struct sockaddr_in6 *>(&nb.local)->sin6_addr.s6_addr,16);
+		memcpy(ip + 24,reinterpret_cast<const struct sockaddr_in6 *>(to)->sin6_addr.s6_addr,16);
+		udp = ip + 40;
+		memcpy(udp + 2,&(reinterpret_cast<const struct sockaddr_in6 *>(to)->sin6_port),2);
+	}
+	udp[0] = (uint8_t)(_port >> 8); udp[1] = (uint8_t)_port;
+	udp[4] = (uint8_t)(udpLen >> 8); udp[5] = (uint8_t)udpLen;
+	udp[6] = 0; udp[7] = 0;
+	memcpy(udp + 8,data,len);
+	if (dest.ss_family == AF_INET6) {
+		// UDP checksum is mandatory over IPv6 (IPv4 sends none, like SO_NO_CHECK on our sockets)
+		uint32_t sum = _csumAdd(0,f + 14 + 8,32);
+		sum += udpLen + IPPROTO_UDP;
+		const uint16_t udpsum = _csumFinish(_csumAdd(sum,udp,udpLen));
+		udp[6] = (udpsum) ? (uint8_t)(udpsum >> 8) : 0xff;
+		udp[7] = (udpsum) ? (uint8_t)udpsum : 0xff;
+	}
+
+	const uint32_t tprod = *q.tx.producer;
+	struct xdp_desc &d = reinterpret_cast<struct xdp_desc *>(q.tx.descs)[tprod & mask];
+	d.addr = addr;
+	d.len = hlen + len;
+	d.options = 0;
+	__atomic_store_n(q.tx.producer,tprod + 1,__ATOMIC_RELEASE);
+	if ((*q.tx.flags & XDP_RING_NEED_WAKEUP) != 0)
+		::sendto(q.fd,(const void *)0,0,MSG_DONTWAIT,(const struct sockaddr *)0,0);
+
+	return true;
+}
+
+void LinuxXdpSocket::_mapRing(_Ring &r,int fd,const struct xdp_ring_offset &off,unsigned int entries,unsigned long descSize,long pgoff)
+{
+	r.mapSize = (unsigned long)off.desc + ((unsigned long)entries * descSize);
+	r.map = mmap((void *)0,r.mapSize,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_POPULATE,fd,(off_t)pgoff);
+	if (r.map == MAP_FAILED) {
+		r.map = (void *)0;
+		throw std::runtime_error("unable to mmap AF_XDP ring");
+	}
+	r.producer = reinterpret_cast<volatile uint32_t *>(reinterpret_cast<uint8_t *>(r.map) + off.producer);
+	r.consumer = reinterpret_cast<volatile uint32_t *>(reinterpret_cast<uint8_t *>(r.map) + off.consumer);
+	r.flags = reinterpret_cast<volatile uint32_t *>(reinterpret_cast<uint8_t *>(r.map) + off.flags);
+	r.descs = reinterpret_cast<uint8_t *>(r.map) + off.desc;
+}
+
+void LinuxXdpSocket::_openQueue(_Queue &q)
+{
+	const unsigned int half = ZT_LINUX_XDP_FRAMES / 2;
+
+	q.fd = ::socket(AF_XDP,SOCK_RAW|SOCK_CLOEXEC,0);
+	if (q.fd < 0)
+		throw std::runtime_error(std::string("unable to open AF_XDP socket: ") + strerror(errno));
+
+	void *const umem = mmap((void *)0,(size_t)ZT_LINUX_XDP_FRAMES * ZT_LINUX_XDP_FRAME_SIZE,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS|MAP_POPULATE,-1,0);
+	if (umem == MAP_FAILED)
+		throw std::runtime_error("unable to allocate UMEM");
+	q.umem = reinterpret_cast<uint8_t *>(umem);
+
+	struct xdp_umem_reg mr;
+	memset(&mr,0,sizeof(mr));
+	mr.addr = (uint64_t)(uintptr_t)umem;
+	mr.len = (uint64_t)ZT_LINUX_XDP_FRAMES * ZT_LINUX_XDP_FRAME_SIZE;
+	mr.chunk_size = ZT_LINUX_XDP_FRAME_SIZE;
+	mr.headroom = 0;
+	if (::setsockopt(q.fd,SOL_XDP,XDP_UMEM_REG,&mr,sizeof(mr)) < 0)
+		throw std::runtime_error(std::string("unable to register UMEM: ") + strerror(errno));
+	if ((::setsockopt(q.fd,SOL_XDP,XDP_UMEM_FILL_RING,&half,sizeof(half)) < 0)||
+	    (::setsockopt(q.fd,SOL_XDP,XDP_UMEM_COMPLETION_RING,&half,sizeof(half)) < 0)||
+	    (::setsockopt(q.fd,SOL_XDP,XDP_RX_RING,&half,sizeof(half)) < 0)||
+	    (::setsockopt(q.fd,SOL_XDP,XDP_TX_RING,&half,sizeof(half)) < 0))
+		throw std::runtime_error(std::string("unable to size AF_XDP rings: ") + strerror(errno));
+
+	struct xdp_mmap_offsets off;
+	socklen_t offLen = sizeof(off);
+	if (::getsockopt(q.fd,SOL_XDP,XDP_MMAP_OFFSETS,&off,&offLen) < 0)
+		throw std::runtime_error("unable to get AF_XDP ring offsets");
+	_mapRing(q.fill,q.fd,off.fr,half,sizeof(uint64_t),(long)XDP_UMEM_PGOFF_FILL_RING);
+	_mapRing(q.comp,q.fd,off.cr,half,sizeof(uint64_t),(long)XDP_UMEM_PGOFF_COMPLETION_RING);
+	_mapRing(q.rx,q.fd,off.rx,half,sizeof(struct xdp_desc),(long)XDP_PGOFF_RX_RING);
+	_mapRing(q.tx,q.fd,off.tx,half,sizeof(struct xdp_desc),(long)XDP_PGOFF_TX_RING);
+
+	// First half of UMEM is for receive and starts out on the fill ring, second half is for transmit
+	for(unsigned int i=0;i<half;++i)
+		reinterpret_cast<uint64_t *>(q.fill.descs)[i] = (uint64_t)i * ZT_LINUX_XDP_FRAME_SIZE;
+	__atomic_store_n(q.fill.producer,half,__ATOMIC_RELEASE);
+	for(unsigned int i=0;i<half;++i)
+		q.txFree[i] = (uint64_t)(half + i) * ZT_LINUX_XDP_FRAME_SIZE;
+	q.txFreeCount = half;
+
+	struct sockaddr_xdp sa;
+	memset(&sa,0,sizeof(sa));
+	sa.sxdp_family = AF_XDP;
+	sa.sxdp_flags = XDP_USE_NEED_WAKEUP;
+	sa.sxdp_ifindex = _ifindex;
+	sa.sxdp_queue_id = q.id;
+	if (::bind(q.fd,(const struct sockaddr *)&sa,sizeof(sa)) < 0)
+		throw std::runtime_error(std::string("unable to bind AF_XDP socket: ") + strerror(errno));
+}
+
+void LinuxXdpSocket::_closeQueue(_Queue &q)
+{
+	_Ring *const rings[4] = { &q.fill,&q.comp,&q.rx,&q.tx };
+	for(unsigned int i=0;i<4;++i) {
+		if (rings[i]->map)
+			munmap(rings[i]->map,rings[i]->mapSize);
+		memset(rings[i],0,sizeof(_Ring));
+	}
+	if (q.fd >= 0) {
+		::close(q.fd);
+		q.fd = -1;
+	}
+	if (q.umem) {
+		munmap(q.umem,(size_t)ZT_LINUX_XDP_FRAMES * ZT_LINUX_XDP_FRAME_SIZE);
+		q.umem = (uint8_t *)0;
+	}
+	q.txFreeCount = 0;
+}
+
+void LinuxXdpSocket::_readerMain(_Queue &q)
+	throw()
+{
+	const uint32_t mask = (ZT_LINUX_XDP_FRAMES / 2) - 1;
+	struct pollfd fds[2];
+	fds[0].fd = q.fd;
+	fds[0].events = POLLIN;
+	fds[1].fd = _shutdownSignalPipe[0];
+	fds[1].events = POLLIN;
+
+	while (_run) {
+		uint32_t cons = *q.rx.consumer;
+		const uint32_t prod = __atomic_load_n(q.rx.producer,__ATOMIC_ACQUIRE);
+		if (cons == prod) {
+			fds[0].revents = 0;
+			fds[1].revents = 0;
+			if ((::poll(fds,2,-1) < 0)&&(errno != EINTR))
+				break;
+			if (fds[1].revents)
+				break;
+			continue;
+		}
+
+		uint32_t fillProd = *q.fill.producer;
+		for(unsigned int n=0;((cons != prod)&&(n < ZT_LINUX_XDP_RX_BATCH));++n) {
+			const struct xdp_desc &d = reinterpret_cast<const struct xdp_desc *>(q.rx.descs)[cons++ & mask];
+			uint8_t *const f = q.umem + d.addr;
+			const unsigned int len = d.len;
+
+			if (len >= 42) {
+				if ((f[12] == 0x08)&&(f[13] == 0x00)&&(f[14] == 0x45)) {
+					const unsigned int udpLen = ((unsigned int)f[38] << 8) | (unsigned int)f[39];
+					if ((udpLen >= 8)&&((34 + udpLen) <= len)) {
+						InetAddress from(f + 26,4,0);
+						_learn(q,from,f + 6,InetAddress(f + 30,4,_port));
+						from.setPort(((unsigned int)f[34] << 8) | (unsigned int)f[35]);
+						_handler(_arg,this,reinterpret_cast<const struct sockaddr_storage *>(&from),f + 42,udpLen - 8);
+					}
+				} else if ((f[12] == 0x86)&&(f[13] == 0xdd)&&(len >= 62)) {
+					const unsigned int udpLen = ((unsigned int)f[58] << 8) | (unsigned int)f[59];
+					if ((udpLen >= 8)&&((54 + udpLen) <= len)) {
+						InetAddress from(f + 22,16,0);
+						_learn(q,from,f + 6,InetAddress(f + 38,16,_port));
+						from.setPort(((unsigned int)f[54] << 8) | (unsigned int)f[55]);
+						_handler(_arg,this,reinterpret_cast<const struct sockaddr_storage *>(&from),f + 62,udpLen - 8);
+					}
+				}
+			}
+
+			// Fill ring is as big as the receive half of UMEM, so there is always room
+			reinterpret_cast<uint64_t *>(q.fill.descs)[fillProd++ & mask] = d.addr & ~((uint64_t)ZT_LINUX_XDP_FRAME_SIZE - 1);
+		}
+		__atomic_store_n(q.fill.producer,fillProd,__ATOMIC_RELEASE);
+		__atomic_store_n(q.rx.consumer,cons,__ATOMIC_RELEASE);
+		if ((*q.fill.flags & XDP_RING_NEED_WAKEUP) != 0)
+			::recvfrom(q.fd,(void *)0,0,MSG_DONTWAIT,(struct sockaddr *)0,(socklen_t *)0);
+	}
+}
+
+void LinuxXdpSocket::trust(const struct sockaddr_storage *from)
+{
+	const InetAddress ip(reinterpret_cast<const InetAddress *>(from)->ipOnly());
+	Mutex::Lock _l(_neighbors_l);
+	const _Neighbor *const c = _candidates.get(ip);
+	if (!c)
+		return;
+	if ((_neighbors.size() >= ZT_LINUX_XDP_MAX_NEIGHBORS)&&(!_neighbors.contains(ip)))
+		_neighbors.clear();
+	_neighbors[ip] = *c;
+}
+
+void LinuxXdpSocket::_learn(_Queue &q,const InetAddress &from,const uint8_t *mac,const InetAddress &local)
+{
+	// Each queue remembers what it last told the shared table, so the lock is only taken on change
+	const uint64_t h = _mix(_mix((uint64_t)from.hashCode() + (MAC(mac,6).toInt() << 16)) ^ (uint64_t)local.hashCode() ^ ((uint64_t)_candidatesGeneration.load() << 32)) | 1ULL;
+	uint64_t &seen = q.learned[h & 0xff];
+	if (seen == h)
+		return;
+	seen = h;
+
+	// Nothing here is authenticated yet, so this only records a candidate for trust()
+	Mutex::Lock _l(_neighbors_l);
+	if ((_candidates.size() >= ZT_LINUX_XDP_MAX_NEIGHBORS)&&(!_candidates.contains(from))) {
+		_candidates.clear();
+		++_candidatesGeneration;
+	}
+	_Neighbor &n = _candidates[from];
+	n.mac.setTo(mac,6);
+	n.local = local;
+}
+
+} // namespace ZeroTier
+
+#endif // __LINUX__
@@ -0,0 +1,188 @@
+/*
+ * ZeroTier One - Network Virtualization Everywhere
+ * Copyright (C) 2011-2019  ZeroTier, Inc.  https://www.zerotier.com/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * --
+ *
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial closed-source software that incorporates or links
+ * directly against ZeroTier software without disclosing the source code
+ * of your own application.
+ */
+
+#ifndef ZT_LINUXXDPSOCKET_HPP
+#define ZT_LINUXXDPSOCKET_HPP
+
+#include <stdint.h>
+#include <sys/socket.h>
+
+#include <string>
+#include <stdexcept>
+#include <atomic>
+
+#include "../node/Constants.hpp"
+#include "../node/InetAddress.hpp"
+#include "../node/MAC.hpp"
+#include "../node/Mutex.hpp"
+#include "../node/Hashtable.hpp"
+#include "Thread.hpp"
+
+/**
+ * Maximum number of NIC receive queues bound to AF_XDP sockets
+ */
+#define ZT_LINUX_XDP_MAX_QUEUES 16
+
+/**
+ * UMEM frame size and number of frames per queue (half RX, half TX)
+ */
+#define ZT_LINUX_XDP_FRAME_SIZE 2048
+#define ZT_LINUX_XDP_FRAMES 4096
+
+/**
+ * Maximum number of remote IPs whose next hop MAC is remembered
+ */
+#define ZT_LINUX_XDP_MAX_NEIGHBORS 65536
+
+struct xdp_ring_offset;
+
+namespace ZeroTier {
+
+/**
+ * AF_XDP receive and transmit path for ZeroTier UDP traffic on Linux
+ *
+ * An XDP program attached to the interface redirects UDP packets for one
+ * port into AF_XDP sockets, one per receive queue, so they skip the kernel
+ * network stack entirely. Only unfragmented IPv4 without options and IPv6
+ * without extension headers are redirected; everything else, including
+ * ZeroTier traffic arriving on queues beyond the configured count, passes
+ * through to the normal UDP sockets.
+ *
+ * Received payloads are handed to the handler straight out of UMEM. Replies
+ * are framed here using the source MAC and local IP last seen in a packet
+ * from the destination. Those are only recorded as candidates on receive
+ * since anyone can send a datagram; the caller promotes one with trust()
+ * once the remote IP has sent traffic the core authenticated. Until then
+ * send() returns false and the caller should use a normal socket.
+ *
+ * The program is attached in native driver mode if the NIC supports it and
+ * in generic mode otherwise. This needs CAP_NET_ADMIN and CAP_BPF (or root)
+ * and Linux 5.9 or newer.
+ */
+class LinuxXdpSocket
+{
+public:
+	/**
+	 * @param ifname Interface name
+	 * @param port UDP port to capture
+	 * @param queueCount Number of receive queues starting at zero to capture (clamped to 1..ZT_LINUX_XDP_MAX_QUEUES)
+	 * @param handler Called from queue threads with (arg,this,from,data,len) for each datagram
+	 * @param arg First argument to handler
+	 * @throws std::runtime_error Unable to set up AF_XDP on this interface
+	 */
+	LinuxXdpSocket(
+		const char *ifname,
+		unsigned int port,
+		unsigned int queueCount,
+		void (*handler)(void *,LinuxXdpSocket *,const struct sockaddr_storage *,void *,unsigned int),
+		void *arg);
+
+	~LinuxXdpSocket();
+
+	/**
+	 * Send a UDP datagram from the captured port
+	 *
+	 * @param to Destination address
+	 * @param data Payload
+	 * @param len Length of payload
+	 * @return True if queued, false if the next hop is unknown or there is no room (use a normal socket)
+	 */
+	bool send(const struct sockaddr_storage *to,const void *data,unsigned int len);
+
+	/**
+	 * Allow send() to use the next hop last seen from an address
+	 *
+	 * This does nothing if nothing has been received from this IP here.
+	 *
+	 * @param from Remote address (port is ignored) that has sent authenticated traffic
+	 */
+	void trust(const struct sockaddr_storage *from);
+
+	inline const std::string &ifname() const { return _ifname; }
+	inline unsigned int port() const { return _port; }
+	inline unsigned int queueCount() const { return _queueCount; }
+
+private:
+	struct _Ring
+	{
+		volatile uint32_t *producer;
+		volatile uint32_t *consumer;
+		volatile uint32_t *flags;
+		void *descs;
+		void *map;
+		unsigned long mapSize;
+	};
+
+	struct _Queue
+	{
+		LinuxXdpSocket *parent;
+		unsigned int id;
+		int fd;
+		uint8_t *umem;
+		_Ring fill,comp,rx,tx;
+		uint64_t txFree[ZT_LINUX_XDP_FRAMES / 2];
+		unsigned int txFreeCount;
+		Mutex txLock;
+		uint64_t learned[256]; // cache of recently learned (remote IP,MAC,local IP) hashes to skip _candidates updates
+		Thread thread;
+		void threadMain() throw() { parent->_readerMain(*this); }
+	};
+
+	struct _Neighbor
+	{
+		MAC mac;
+		InetAddress local;
+	};
+
+	static void _mapRing(_Ring &r,int fd,const struct xdp_ring_offset &off,unsigned int entries,unsigned long descSize,long pgoff);
+	void _openQueue(_Queue &q);
+	void _closeQueue(_Queue &q);
+	void _readerMain(_Queue &q) throw();
+	void _learn(_Queue &q,const InetAddress &from,const uint8_t *mac,const InetAddress &local);
+
+	void (*_handler)(void *,LinuxXdpSocket *,const struct sockaddr_storage *,void *,unsigned int);
+	void *_arg;
+	std::string _ifname;
+	unsigned int _ifindex;
+	unsigned int _port;
+	unsigned int _mtu;
+	MAC _mac;
+	_Queue _queues[ZT_LINUX_XDP_MAX_QUEUES];
+	unsigned int _queueCount;
+	Hashtable< InetAddress,_Neighbor > _candidates; // last seen from each IP, not yet trusted
+	Hashtable< InetAddress,_Neighbor > _neighbors; // used by send()
+	Mutex _neighbors_l; // guards both of the above
+	std::atomic<unsigned int> _candidatesGeneration;
+	int _mapFd;
+	int _progFd;
+	int _linkFd;
+	int _shutdownSignalPipe[2];
+	std::atomic<bool> _run;
+};
+
+} // namespace ZeroTier
+
+#endif
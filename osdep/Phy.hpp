@@ -32,6 +32,8 @@
 #include <string.h>
 
 #include <list>
+#include <vector>
+#include <algorithm>
 #include <stdexcept>
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -67,13 +69,62 @@
 #ifndef IPV6_DONTFRAG
 #define IPV6_DONTFRAG 62
 #endif
+#ifndef ZT_PHY_USE_SELECT
+#define ZT_PHY_USE_EPOLL 1
+#endif
+#ifndef ZT_PHY_NO_MMSG
+#define ZT_PHY_USE_MMSG 1
+#endif
+#endif
+
+#ifdef ZT_PHY_USE_EPOLL
+#include <sys/epoll.h>
+#endif
+#ifdef ZT_PHY_USE_MMSG
+#include <atomic>
+#include <thread>
+#include <sys/uio.h>
+#include <netinet/udp.h>
+#if defined(UDP_SEGMENT) && !defined(ZT_PHY_NO_UDP_GSO)
+#define ZT_PHY_USE_UDP_GSO 1
+#endif
+#if defined(ZT_PHY_USE_EPOLL) && !defined(ZT_PHY_NO_IO_URING)
+#include <linux/io_uring.h>
+#if defined(IORING_RECV_MULTISHOT) && defined(IORING_CQE_F_MORE)
+#define ZT_PHY_USE_IO_URING 1
+#include "IoUring.hpp"
+#endif
+#endif
 #endif
 
 #define ZT_PHY_SOCKFD_TYPE int
 #define ZT_PHY_SOCKFD_NULL (-1)
 #define ZT_PHY_SOCKFD_VALID(s) ((s) > -1)
 #define ZT_PHY_CLOSE_SOCKET(s) ::close(s)
+#ifdef ZT_PHY_USE_EPOLL
+#define ZT_PHY_MAX_SOCKETS 65536
+#define ZT_PHY_EPOLL_MAX_EVENTS 256
+#else
 #define ZT_PHY_MAX_SOCKETS (FD_SETSIZE)
+#endif
+#ifdef ZT_PHY_USE_MMSG
+#define ZT_PHY_UDP_BATCH_SIZE 32
+#define ZT_PHY_UDP_BATCH_BUF_SIZE 16384
+// Largest datagram received (bigger ones are dropped). UDP's 16-bit length field
+// means only IPv6 jumbograms can exceed this, and it also holds a whole
+// GRO-coalesced datagram.
+#define ZT_PHY_UDP_RX_BUF_SIZE 65536
+#ifdef ZT_PHY_USE_UDP_GSO
+#define ZT_PHY_UDP_GSO_MAX_BYTES 65000
+#endif
+#endif
+#ifdef ZT_PHY_USE_IO_URING
+#define ZT_PHY_IO_URING_RX_ENTRIES 256
+#define ZT_PHY_IO_URING_RX_BUFFERS 64
+// recvmsg multishot buffers hold an io_uring_recvmsg_out header and the source address ahead of the payload
+#define ZT_PHY_IO_URING_RX_BUF_SIZE (sizeof(struct io_uring_recvmsg_out) + sizeof(struct sockaddr_storage) + ZT_PHY_UDP_RX_BUF_SIZE)
+#define ZT_PHY_IO_URING_BUFFER_GROUP 0
+#endif
 #define ZT_PHY_MAX_INTERCEPTS ZT_PHY_MAX_SOCKETS
 #define ZT_PHY_SOCKADDR_STORAGE_TYPE struct sockaddr_storage
 
@@ -130,6 +181,29 @@ typedef void PhySocket;
  * handler, and in that case close() can be told not to call handlers to
  * prevent recursion.
  *
+ * On Linux the readiness loop uses edge-triggered epoll instead of select(),
+ * so poll() cost scales with the number of active sockets rather than the
+ * total number of sockets and the FD_SETSIZE limit does not apply. Define
+ * ZT_PHY_USE_SELECT to build the portable select() loop instead.
+ *
+ * Also on Linux UDP sockets are drained with recvmmsg() into a reusable
+ * batch of buffers, and udpSendBatched() queues datagrams that are sent
+ * with sendmmsg() by udpFlush() or at the start and end of every poll().
+ * Define ZT_PHY_NO_MMSG to use one recvfrom()/sendto() per datagram.
+ *
+ * Where the kernel supports it UDP sockets also use segmentation offload:
+ * runs of queued datagrams of equal size to the same destination are sent
+ * as one UDP_SEGMENT (GSO) message, and UDP_GRO coalesced receives are split
+ * back into datagrams before phyOnDatagram() sees them. Define
+ * ZT_PHY_NO_UDP_GSO to disable this.
+ *
+ * If setUseIoUring() is called and the kernel supports it (6.0+), UDP
+ * sockets bound afterwards receive through multishot io_uring recvmsg
+ * requests into a ring of provided buffers instead of recvmmsg(), and
+ * batched sends are submitted as linked io_uring sendmsg requests. The
+ * ring's completion queue is watched by the same epoll loop as everything
+ * else. Define ZT_PHY_NO_IO_URING to leave this out.
+ *
  * This isn't thread-safe with the exception of whack(), which is safe to
  * call from another thread to abort poll().
  */
@@ -153,28 +227,170 @@ private:
 	};
 
 	struct PhySocketImpl {
-		PhySocketImpl() { memset(ifname, 0, sizeof(ifname)); }
+		PhySocketImpl()
+		{
+			memset(ifname, 0, sizeof(ifname));
+#ifdef ZT_PHY_USE_UDP_GSO
+			udpGso = false;
+#endif
+#ifdef ZT_PHY_USE_IO_URING
+			uringRecv = false;
+			uringArmed = false;
+#endif
+		}
 		PhySocketType type;
 		ZT_PHY_SOCKFD_TYPE sock;
 		void *uptr; // user-settable pointer
 		ZT_PHY_SOCKADDR_STORAGE_TYPE saddr; // remote for TCP_OUT and TCP_IN, local for TCP_LISTEN, RAW, and UDP
 		char ifname[16];
+#ifdef ZT_PHY_USE_EPOLL
+		uint32_t events; // currently registered EPOLLIN/EPOLLOUT interest
+#endif
+#ifdef ZT_PHY_USE_UDP_GSO
+		bool udpGso; // UDP socket accepts UDP_SEGMENT sends
+#endif
+#ifdef ZT_PHY_USE_IO_URING
+		bool uringRecv; // UDP socket receives through _rxRing instead of epoll
+		bool uringArmed; // a multishot receive is outstanding, entry must not be freed yet
+#endif
 	};
 
 	std::list<PhySocketImpl> _socks;
+#ifdef ZT_PHY_USE_EPOLL
+	int _epfd;
+	bool _closedPending; // sockets were closed and are awaiting removal from _socks
+#else
 	fd_set _readfds;
 	fd_set _writefds;
 #if defined(_WIN32) || defined(_WIN64)
 	fd_set _exceptfds;
+#endif
 #endif
 	long _nfds;
 
+#ifdef ZT_PHY_USE_MMSG
+	// Datagram batch for recvmmsg()/sendmmsg(), buffers wired up once on construction
+	template<unsigned int BS>
+	struct _UdpBatch
+	{
+		struct mmsghdr msgs[ZT_PHY_UDP_BATCH_SIZE];
+		struct iovec iov[ZT_PHY_UDP_BATCH_SIZE];
+		struct sockaddr_storage addrs[ZT_PHY_UDP_BATCH_SIZE];
+		PhySocketImpl *socks[ZT_PHY_UDP_BATCH_SIZE];
+#ifdef ZT_PHY_USE_UDP_GSO
+		struct mmsghdr gso[ZT_PHY_UDP_BATCH_SIZE]; // coalesced messages assembled by udpFlush()
+		uint64_t ctrl[ZT_PHY_UDP_BATCH_SIZE][(CMSG_SPACE(sizeof(int)) + 7) / 8]; // UDP_SEGMENT / UDP_GRO control messages
+#endif
+		char bufs[ZT_PHY_UDP_BATCH_SIZE][BS];
+
+		_UdpBatch()
+		{
+			memset(msgs,0,sizeof(msgs));
+#ifdef ZT_PHY_USE_UDP_GSO
+			memset(gso,0,sizeof(gso));
+#endif
+			for(unsigned int i=0;i<ZT_PHY_UDP_BATCH_SIZE;++i) {
+				iov[i].iov_base = bufs[i];
+				iov[i].iov_len = BS;
+				msgs[i].msg_hdr.msg_name = &(addrs[i]);
+				msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+				msgs[i].msg_hdr.msg_iov = &(iov[i]);
+				msgs[i].msg_hdr.msg_iovlen = 1;
+				socks[i] = (PhySocketImpl *)0;
+			}
+		}
+	};
+
+	_UdpBatch<ZT_PHY_UDP_RX_BUF_SIZE> *_rxBatch; // allocated on first udpBind()
+	_UdpBatch<ZT_PHY_UDP_BATCH_BUF_SIZE> *_txBatch;
+	unsigned int _txCount;
+	std::atomic<std::thread::id> _pollThread; // only this thread queues in _txBatch, set once
+#endif
+
+#ifdef ZT_PHY_USE_IO_URING
+	bool _ioUringWanted;
+	IoUring *_rxRing; // multishot receives, its fd is watched by epoll
+	IoUring *_txRing; // batched sends, each batch is submitted and reaped in udpFlush()
+	struct msghdr _rxMsg; // template for multishot recvmsg, only sizes are used
+	std::vector<PhySocketImpl *> _uringCancels; // closed sockets whose receive cancel didn't fit in _rxRing yet
+#endif
+
 	ZT_PHY_SOCKFD_TYPE _whackReceiveSocket;
 	ZT_PHY_SOCKFD_TYPE _whackSendSocket;
 
 	bool _noDelay;
 	bool _noCheck;
 
+	// Add a socket to the readiness set with initial read/write interest
+	inline bool _watch(PhySocketImpl &sws,bool readable,bool writable)
+	{
+#ifdef ZT_PHY_USE_EPOLL
+		struct epoll_event ev;
+		memset(&ev,0,sizeof(ev));
+		sws.events = (readable ? (uint32_t)EPOLLIN : 0) | (writable ? (uint32_t)EPOLLOUT : 0);
+		ev.events = sws.events | EPOLLET;
+		ev.data.ptr = (void *)&sws;
+		return (::epoll_ctl(_epfd,EPOLL_CTL_ADD,sws.sock,&ev) == 0);
+#else
+		if ((long)sws.sock > _nfds)
+			_nfds = (long)sws.sock;
+		if (readable)
+			FD_SET(sws.sock,&_readfds);
+		if (writable) {
+			FD_SET(sws.sock,&_writefds);
+#if defined(_WIN32) || defined(_WIN64)
+			FD_SET(sws.sock,&_exceptfds);
+#endif
+		}
+		return true;
+#endif
+	}
+
+	// Change read/write interest for a socket already being watched
+	inline void _setInterest(PhySocketImpl &sws,bool readable,bool writable)
+	{
+#ifdef ZT_PHY_USE_EPOLL
+		const uint32_t events = (readable ? (uint32_t)EPOLLIN : 0) | (writable ? (uint32_t)EPOLLOUT : 0);
+		if (events != sws.events) {
+			struct epoll_event ev;
+			memset(&ev,0,sizeof(ev));
+			sws.events = events;
+			ev.events = events | EPOLLET;
+			ev.data.ptr = (void *)&sws;
+			::epoll_ctl(_epfd,EPOLL_CTL_MOD,sws.sock,&ev);
+		}
+#else
+		if (readable) {
+			FD_SET(sws.sock,&_readfds);
+		} else {
+			FD_CLR(sws.sock,&_readfds);
+		}
+		if (writable) {
+			FD_SET(sws.sock,&_writefds);
+		} else {
+			FD_CLR(sws.sock,&_writefds);
+		}
+#endif
+	}
+
+	inline bool _wantsReadable(const PhySocketImpl &sws) const
+	{
+#ifdef ZT_PHY_USE_EPOLL
+		return ((sws.events & EPOLLIN) != 0);
+#else
+		return (FD_ISSET(sws.sock,&_readfds) != 0);
+#endif
+	}
+
+	inline bool _wantsWritable(const PhySocketImpl &sws) const
+	{
+#ifdef ZT_PHY_USE_EPOLL
+		return ((sws.events & EPOLLOUT) != 0);
+#else
+		return (FD_ISSET(sws.sock,&_writefds) != 0);
+#endif
+	}
+
 public:
 	/**
 	 * @param handler Pointer of type HANDLER_PTR_TYPE to handler
@@ -184,8 +400,10 @@ public:
 	Phy(HANDLER_PTR_TYPE handler,bool noDelay,bool noCheck) :
 		_handler(handler)
 	{
+#ifndef ZT_PHY_USE_EPOLL
 		FD_ZERO(&_readfds);
 		FD_ZERO(&_writefds);
+#endif
 
 #if defined(_WIN32) || defined(_WIN64)
 		FD_ZERO(&_exceptfds);
@@ -226,6 +444,42 @@ public:
 		_whackSendSocket = pipes[1];
 		_noDelay = noDelay;
 		_noCheck = noCheck;
+
+#ifdef ZT_PHY_USE_EPOLL
+		_closedPending = false;
+		_epfd = ::epoll_create1(EPOLL_CLOEXEC);
+		if (_epfd < 0) {
+			::close(pipes[0]);
+			::close(pipes[1]);
+			throw std::runtime_error("unable to create epoll instance");
+		}
+		fcntl(_whackReceiveSocket,F_SETFL,O_NONBLOCK);
+		struct epoll_event ev;
+		memset(&ev,0,sizeof(ev));
+		ev.events = EPOLLIN | EPOLLET;
+		ev.data.ptr = (void *)0; // NULL marks the whack pipe
+		if (::epoll_ctl(_epfd,EPOLL_CTL_ADD,_whackReceiveSocket,&ev) != 0) {
+			::close(_epfd);
+			::close(pipes[0]);
+			::close(pipes[1]);
+			throw std::runtime_error("unable to add whack pipe to epoll instance");
+		}
+#endif
+
+#ifdef ZT_PHY_USE_MMSG
+		_rxBatch = (_UdpBatch<ZT_PHY_UDP_RX_BUF_SIZE> *)0;
+		_txBatch = (_UdpBatch<ZT_PHY_UDP_BATCH_BUF_SIZE> *)0;
+		_txCount = 0;
+		_pollThread.store(std::thread::id());
+#endif
+
+#ifdef ZT_PHY_USE_IO_URING
+		_ioUringWanted = false;
+		_rxRing = (IoUring *)0;
+		_txRing = (IoUring *)0;
+		memset(&_rxMsg,0,sizeof(_rxMsg));
+		_rxMsg.msg_namelen = sizeof(struct sockaddr_storage);
+#endif
 	}
 
 	~Phy()
@@ -236,6 +490,36 @@ public:
 		}
 		ZT_PHY_CLOSE_SOCKET(_whackReceiveSocket);
 		ZT_PHY_CLOSE_SOCKET(_whackSendSocket);
+#ifdef ZT_PHY_USE_EPOLL
+		::close(_epfd);
+#endif
+#ifdef ZT_PHY_USE_MMSG
+		delete _rxBatch;
+		delete _txBatch;
+#endif
+#ifdef ZT_PHY_USE_IO_URING
+		delete _rxRing;
+		delete _txRing;
+#endif
+	}
+
+	/**
+	 * Use io_uring for UDP sockets bound after this call, if available
+	 *
+	 * If io_uring can't be set up (old kernel, disabled by sysctl or seccomp)
+	 * UDP sockets silently keep using the normal readiness loop.
+	 *
+	 * @param en Enable or disable for future udpBind() calls
+	 * @return True if io_uring support is compiled in
+	 */
+	inline bool setUseIoUring(bool en)
+	{
+#ifdef ZT_PHY_USE_IO_URING
+		_ioUringWanted = en;
+		return true;
+#else
+		return false;
+#endif
 	}
 
 	/**
@@ -370,14 +654,15 @@ public:
 			return (PhySocket *)0;
 		}
 		PhySocketImpl &sws = _socks.back();
-		if ((long)fd > _nfds)
-			_nfds = (long)fd;
-		FD_SET(fd,&_readfds);
 		sws.type = ZT_PHY_SOCKET_UNIX_IN; /* TODO: Type was changed to allow for CBs with new RPC model */
 		sws.sock = fd;
 		sws.uptr = uptr;
 		memset(&(sws.saddr),0,sizeof(struct sockaddr_storage));
 		// no sockaddr for this socket type, leave saddr null
+		if (!_watch(sws,true,false)) {
+			_socks.pop_back();
+			return (PhySocket *)0;
+		}
 		return (PhySocket *)&sws;
 	}
 
@@ -387,16 +672,37 @@ public:
 	 * @param localAddress Local endpoint address and port
 	 * @param uptr Initial value of user pointer associated with this socket (default: NULL)
 	 * @param bufferSize Desired socket receive/send buffer size -- will set as close to this as possible (default: 0, leave alone)
+	 * @param reusePort If true, set SO_REUSEPORT so several sockets (e.g. in other Phy instances) can share the port (default: false)
 	 * @return Socket or NULL on failure to bind
 	 */
-	inline PhySocket *udpBind(const struct sockaddr *localAddress,void *uptr = (void *)0,int bufferSize = 0)
+	inline PhySocket *udpBind(const struct sockaddr *localAddress,void *uptr = (void *)0,int bufferSize = 0,bool reusePort = false)
 	{
 		if (_socks.size() >= ZT_PHY_MAX_SOCKETS)
 			return (PhySocket *)0;
 
+#ifdef ZT_PHY_USE_MMSG
+		if (!_rxBatch) {
+			try {
+				_rxBatch = new _UdpBatch<ZT_PHY_UDP_RX_BUF_SIZE>();
+				_txBatch = new _UdpBatch<ZT_PHY_UDP_BATCH_BUF_SIZE>();
+			} catch ( ... ) {
+				delete _rxBatch;
+				_rxBatch = (_UdpBatch<ZT_PHY_UDP_RX_BUF_SIZE> *)0;
+				return (PhySocket *)0;
+			}
+		}
+#endif
+#ifdef ZT_PHY_USE_IO_URING
+		if ((_ioUringWanted)&&(!_rxRing))
+			_ioUringWanted = _uringOpen();
+#endif
+
 		ZT_PHY_SOCKFD_TYPE s = ::socket(localAddress->sa_family,SOCK_DGRAM,0);
 		if (!ZT_PHY_SOCKFD_VALID(s))
 			return (PhySocket *)0;
+#ifdef ZT_PHY_USE_UDP_GSO
+		bool gso = false;
+#endif
 
 		if (bufferSize > 0) {
 			int bs = bufferSize;
@@ -439,17 +745,38 @@ public:
 			}
 			f = 0; setsockopt(s,SOL_SOCKET,SO_REUSEADDR,(void *)&f,sizeof(f));
 			f = 1; setsockopt(s,SOL_SOCKET,SO_BROADCAST,(void *)&f,sizeof(f));
+#ifdef SO_REUSEPORT
+			if (reusePort) {
+				f = 1; setsockopt(s,SOL_SOCKET,SO_REUSEPORT,(void *)&f,sizeof(f));
+			}
+#endif
 #ifdef IP_DONTFRAG
 			f = 0; setsockopt(s,IPPROTO_IP,IP_DONTFRAG,&f,sizeof(f));
 #endif
 #ifdef IP_MTU_DISCOVER
 			f = 0; setsockopt(s,IPPROTO_IP,IP_MTU_DISCOVER,&f,sizeof(f));
 #endif
+#ifdef ZT_PHY_USE_UDP_GSO
+			// Setting a zero segment size is a no-op that tells us if the kernel
+			// knows UDP_SEGMENT. UDP_GRO is harmless to request either way.
+			f = 0; gso = (setsockopt(s,SOL_UDP,UDP_SEGMENT,(void *)&f,sizeof(f)) == 0);
+#ifdef UDP_GRO
+#ifdef ZT_PHY_USE_IO_URING
+			if ((!_rxRing)||(!_ioUringWanted)) // io_uring receives don't carry the GRO segment size
+#endif
+			{ f = 1; setsockopt(s,SOL_UDP,UDP_GRO,(void *)&f,sizeof(f)); }
+#endif
+#endif
 #ifdef SO_NO_CHECK
 			// For now at least we only set SO_NO_CHECK on IPv4 sockets since some
 			// IPv6 stacks incorrectly discard zero checksum packets. May remove
-			// this restriction later once broken stuff dies more.
+			// this restriction later once broken stuff dies more. The kernel will
+			// not segment without checksums, so GSO capable sockets skip it.
+#ifdef ZT_PHY_USE_UDP_GSO
+			if ((localAddress->sa_family == AF_INET)&&(_noCheck)&&(!gso)) {
+#else
 			if ((localAddress->sa_family == AF_INET)&&(_noCheck)) {
+#endif
 				f = 1; setsockopt(s,SOL_SOCKET,SO_NO_CHECK,(void *)&f,sizeof(f));
 			}
 #endif
@@ -475,14 +802,23 @@ public:
 		}
 		PhySocketImpl &sws = _socks.back();
 
-		if ((long)s > _nfds)
-			_nfds = (long)s;
-		FD_SET(s,&_readfds);
 		sws.type = ZT_PHY_SOCKET_UDP;
 		sws.sock = s;
 		sws.uptr = uptr;
+#ifdef ZT_PHY_USE_UDP_GSO
+		sws.udpGso = gso;
+#endif
 		memset(&(sws.saddr),0,sizeof(struct sockaddr_storage));
 		memcpy(&(sws.saddr),localAddress,(localAddress->sa_family == AF_INET6) ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+#ifdef ZT_PHY_USE_IO_URING
+		if ((_rxRing)&&(_ioUringWanted)&&(_uringArm(sws)))
+			return (PhySocket *)&sws;
+#endif
+		if (!_watch(sws,true,false)) {
+			_socks.pop_back();
+			ZT_PHY_CLOSE_SOCKET(s);
+			return (PhySocket *)0;
+		}
 
 		return (PhySocket *)&sws;
 	}
@@ -490,12 +826,19 @@ public:
 	/**
 	 * Set the IP TTL for the next outgoing packet (for IPv4 UDP sockets only)
 	 *
+	 * Packets already queued by udpSendBatched() are sent first so they
+	 * keep the TTL they were queued with.
+	 *
 	 * @param ttl New TTL (0 or >255 will set it to 255)
 	 * @return True on success
 	 */
 	inline bool setIp4UdpTtl(PhySocket *sock,unsigned int ttl)
 	{
 		PhySocketImpl &sws = *(reinterpret_cast<PhySocketImpl *>(sock));
+#ifdef ZT_PHY_USE_MMSG
+		if ((_txCount > 0)&&(_pollThread.load() == std::this_thread::get_id()))
+			udpFlush();
+#endif
 #if defined(_WIN32) || defined(_WIN64)
 		DWORD tmp = ((ttl == 0)||(ttl > 255)) ? 255 : (DWORD)ttl;
 		return (::setsockopt(sws.sock,IPPROTO_IP,IP_TTL,(const char *)&tmp,sizeof(tmp)) == 0);
@@ -508,6 +851,9 @@ public:
 	/**
 	 * Send a UDP packet
 	 *
+	 * On the thread that runs poll(), packets queued by udpSendBatched() are
+	 * sent first so this one can't overtake them.
+	 *
 	 * @param sock UDP socket
 	 * @param remoteAddress Destination address (must be correct type for socket)
 	 * @param data Data to send
@@ -517,6 +863,10 @@ public:
 	inline bool udpSend(PhySocket *sock,const struct sockaddr *remoteAddress,const void *data,unsigned long len)
 	{
 		PhySocketImpl &sws = *(reinterpret_cast<PhySocketImpl *>(sock));
+#ifdef ZT_PHY_USE_MMSG
+		if ((_txCount > 0)&&(_pollThread.load() == std::this_thread::get_id()))
+			udpFlush();
+#endif
 #if defined(_WIN32) || defined(_WIN64)
 		return ((long)::sendto(sws.sock,reinterpret_cast<const char *>(data),len,0,remoteAddress,(remoteAddress->sa_family == AF_INET6) ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in)) == (long)len);
 #else
@@ -524,6 +874,94 @@ public:
 #endif
 	}
 
+	/**
+	 * Queue a UDP packet to be sent with others in one system call
+	 *
+	 * Queued packets are sent by udpFlush(), which poll() calls before it
+	 * waits and after it has handled events, so packets queued from within
+	 * Phy handlers or the thread running poll() leave once per loop. If called
+	 * from any other thread, or if batching is not available, this sends the
+	 * packet immediately exactly like udpSend().
+	 *
+	 * @param sock UDP socket
+	 * @param remoteAddress Destination address (must be correct type for socket)
+	 * @param data Data to send
+	 * @param len Length of packet
+	 * @return True if packet was queued or appears to have been sent successfully
+	 */
+	inline bool udpSendBatched(PhySocket *sock,const struct sockaddr *remoteAddress,const void *data,unsigned long len)
+	{
+#ifdef ZT_PHY_USE_MMSG
+		if ((len <= ZT_PHY_UDP_BATCH_BUF_SIZE)&&(_txBatch)&&(_pollThread.load() == std::this_thread::get_id())) {
+			if (_txCount >= ZT_PHY_UDP_BATCH_SIZE)
+				udpFlush();
+			const unsigned int i = _txCount++;
+			const socklen_t alen = (remoteAddress->sa_family == AF_INET6) ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+			memcpy(&(_txBatch->addrs[i]),remoteAddress,alen);
+			memcpy(_txBatch->bufs[i],data,len);
+			_txBatch->iov[i].iov_len = len;
+			_txBatch->msgs[i].msg_hdr.msg_namelen = alen;
+			_txBatch->socks[i] = reinterpret_cast<PhySocketImpl *>(sock);
+			return true;
+		}
+#endif
+		return udpSend(sock,remoteAddress,data,len);
+	}
+
+	/**
+	 * Make the calling thread the only one whose udpSendBatched() calls are queued
+	 *
+	 * Call this from the thread that will run poll() before other threads can
+	 * send on this Phy. Otherwise the first thread to call poll() is used.
+	 * Batched sends from any other thread go out immediately.
+	 */
+	inline void setPollThread()
+	{
+#ifdef ZT_PHY_USE_MMSG
+		_pollThread.store(std::this_thread::get_id());
+#endif
+	}
+
+	/**
+	 * Send any packets queued by udpSendBatched()
+	 *
+	 * Consecutive packets on the same socket go out in one sendmmsg() call.
+	 * With UDP GSO, runs of equal sized packets to the same destination within
+	 * that are further merged into a single UDP_SEGMENT message. This must only
+	 * be called from the thread that runs poll().
+	 */
+	inline void udpFlush()
+	{
+#ifdef ZT_PHY_USE_MMSG
+		unsigned int i = 0;
+		while (i < _txCount) {
+			PhySocketImpl *const sws = _txBatch->socks[i];
+			unsigned int j = i + 1;
+			while ((j < _txCount)&&(_txBatch->socks[j] == sws))
+				++j;
+#ifdef ZT_PHY_USE_UDP_GSO
+			if ((sws->udpGso)&&(j - i > 1)) {
+				if (_udpFlushGso(sws,i,j)) {
+					i = j;
+					continue;
+				}
+			}
+#endif
+			while (i < j) {
+				const int n = _sendmmsg(sws->sock,&(_txBatch->msgs[i]),j - i);
+				if (n > 0) {
+					i += (unsigned int)n;
+				} else if ((n < 0)&&(errno == EINTR)) {
+					continue;
+				} else {
+					++i; // drop the packet that failed, as a failed sendto() would
+				}
+			}
+		}
+		_txCount = 0;
+#endif
+	}
+
 #ifdef __UNIX_LIKE__
 	/**
 	 * Listen for connections on a Unix domain socket
@@ -569,14 +1007,16 @@ public:
 		}
 		PhySocketImpl &sws = _socks.back();
 
-		if ((long)s > _nfds)
-			_nfds = (long)s;
-		FD_SET(s,&_readfds);
 		sws.type = ZT_PHY_SOCKET_UNIX_LISTEN;
 		sws.sock = s;
 		sws.uptr = uptr;
 		memset(&(sws.saddr),0,sizeof(struct sockaddr_storage));
 		memcpy(&(sws.saddr),&sun,sizeof(struct sockaddr_un));
+		if (!_watch(sws,true,false)) {
+			_socks.pop_back();
+			ZT_PHY_CLOSE_SOCKET(s);
+			return (PhySocket *)0;
+		}
 
 		return (PhySocket *)&sws;
 	}
@@ -635,14 +1075,16 @@ public:
 		}
 		PhySocketImpl &sws = _socks.back();
 
-		if ((long)s > _nfds)
-			_nfds = (long)s;
-		FD_SET(s,&_readfds);
 		sws.type = ZT_PHY_SOCKET_TCP_LISTEN;
 		sws.sock = s;
 		sws.uptr = uptr;
 		memset(&(sws.saddr),0,sizeof(struct sockaddr_storage));
 		memcpy(&(sws.saddr),localAddress,(localAddress->sa_family == AF_INET6) ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+		if (!_watch(sws,true,false)) {
+			_socks.pop_back();
+			ZT_PHY_CLOSE_SOCKET(s);
+			return (PhySocket *)0;
+		}
 
 		return (PhySocket *)&sws;
 	}
@@ -720,22 +1162,17 @@ public:
 		}
 		PhySocketImpl &sws = _socks.back();
 
-		if ((long)s > _nfds)
-			_nfds = (long)s;
-		if (connected) {
-			FD_SET(s,&_readfds);
-			sws.type = ZT_PHY_SOCKET_TCP_OUT_CONNECTED;
-		} else {
-			FD_SET(s,&_writefds);
-#if defined(_WIN32) || defined(_WIN64)
-			FD_SET(s,&_exceptfds);
-#endif
-			sws.type = ZT_PHY_SOCKET_TCP_OUT_PENDING;
-		}
+		sws.type = (connected) ? ZT_PHY_SOCKET_TCP_OUT_CONNECTED : ZT_PHY_SOCKET_TCP_OUT_PENDING;
 		sws.sock = s;
 		sws.uptr = uptr;
 		memset(&(sws.saddr),0,sizeof(struct sockaddr_storage));
 		memcpy(&(sws.saddr),remoteAddress,(remoteAddress->sa_family == AF_INET6) ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+		if (!_watch(sws,connected,!connected)) {
+			_socks.pop_back();
+			ZT_PHY_CLOSE_SOCKET(s);
+			connected = false;
+			return (PhySocket *)0;
+		}
 
 		if ((callConnectHandler)&&(connected)) {
 			try {
@@ -884,11 +1321,7 @@ public:
 	inline void setNotifyWritable(PhySocket *sock,bool notifyWritable)
 	{
 		PhySocketImpl &sws = *(reinterpret_cast<PhySocketImpl *>(sock));
-		if (notifyWritable) {
-			FD_SET(sws.sock,&_writefds);
-		} else {
-			FD_CLR(sws.sock,&_writefds);
-		}
+		_setInterest(sws,_wantsReadable(sws),notifyWritable);
 	}
 
 	/**
@@ -904,11 +1337,7 @@ public:
 	inline void setNotifyReadable(PhySocket *sock,bool notifyReadable)
 	{
 		PhySocketImpl &sws = *(reinterpret_cast<PhySocketImpl *>(sock));
-		if (notifyReadable) {
-			FD_SET(sws.sock,&_readfds);
-		} else {
-			FD_CLR(sws.sock,&_readfds);
-		}
+		_setInterest(sws,notifyReadable,_wantsWritable(sws));
 	}
 
 	/**
@@ -923,7 +1352,66 @@ public:
 	inline void poll(unsigned long timeout)
 	{
 		char buf[131072];
-		struct sockaddr_storage ss;
+
+#ifdef ZT_PHY_USE_MMSG
+		if (_pollThread.load() == std::thread::id()) {
+			std::thread::id none;
+			_pollThread.compare_exchange_strong(none,std::this_thread::get_id());
+		}
+		udpFlush();
+#endif
+
+#ifdef ZT_PHY_USE_IO_URING
+		if (!_uringCancels.empty()) {
+			typename std::vector<PhySocketImpl *>::iterator w(_uringCancels.begin());
+			for(typename std::vector<PhySocketImpl *>::iterator c(_uringCancels.begin());c!=_uringCancels.end();++c) {
+				if (((*c)->uringArmed)&&(!_uringCancel(**c)))
+					*(w++) = *c;
+			}
+			_uringCancels.erase(w,_uringCancels.end());
+		}
+		if ((_rxRing)&&(_rxRing->cqOverflowed()))
+			_uringReap(); // the ring fd won't signal again for completions stuck in the overflow list
+#endif
+
+#ifdef ZT_PHY_USE_EPOLL
+		struct epoll_event events[ZT_PHY_EPOLL_MAX_EVENTS];
+		const int n = ::epoll_wait(_epfd,events,ZT_PHY_EPOLL_MAX_EVENTS,(timeout > 0) ? ((timeout > 0x7fffffffUL) ? 0x7fffffff : (int)timeout) : -1);
+
+		for(int i=0;i<n;++i) {
+			PhySocketImpl *const s = reinterpret_cast<PhySocketImpl *>(events[i].data.ptr);
+			if (!s) {
+				char tmp[16];
+				while (::read(_whackReceiveSocket,tmp,sizeof(tmp)) > 0) {}
+				continue;
+			}
+#ifdef ZT_PHY_USE_IO_URING
+			if (events[i].data.ptr == (void *)_rxRing) {
+				_uringReap();
+				continue;
+			}
+#endif
+			if (s->type == ZT_PHY_SOCKET_CLOSED)
+				continue; // closed by a handler earlier in this batch
+			const uint32_t ev = events[i].events;
+			_doActivity(*s,buf,sizeof(buf),((ev & (EPOLLIN | EPOLLERR | EPOLLHUP)) != 0),((ev & (EPOLLOUT | EPOLLERR | EPOLLHUP)) != 0),false);
+		}
+
+		// Closed sockets are removed from epoll in close(), but their list entries
+		// are kept until here since events above may still point to them.
+		if (_closedPending) {
+			_closedPending = false;
+			for(typename std::list<PhySocketImpl>::iterator s(_socks.begin());s!=_socks.end();) {
+#ifdef ZT_PHY_USE_IO_URING
+				if ((s->type == ZT_PHY_SOCKET_CLOSED)&&(!s->uringArmed))
+#else
+				if (s->type == ZT_PHY_SOCKET_CLOSED)
+#endif
+					_socks.erase(s++);
+				else ++s;
+			}
+		}
+#else // select()
 		struct timeval tv;
 		fd_set rfds,wfds,efds;
 
@@ -950,171 +1438,24 @@ public:
 		}
 
 		for(typename std::list<PhySocketImpl>::iterator s(_socks.begin());s!=_socks.end();) {
-			switch (s->type) {
-
-				case ZT_PHY_SOCKET_TCP_OUT_PENDING:
-#if defined(_WIN32) || defined(_WIN64)
-					if (FD_ISSET(s->sock,&efds)) {
-						this->close((PhySocket *)&(*s),true);
-					} else // ... if
-#endif
-					if (FD_ISSET(s->sock,&wfds)) {
-						socklen_t slen = sizeof(ss);
-						if (::getpeername(s->sock,(struct sockaddr *)&ss,&slen) != 0) {
-							this->close((PhySocket *)&(*s),true);
-						} else {
-							s->type = ZT_PHY_SOCKET_TCP_OUT_CONNECTED;
-							FD_SET(s->sock,&_readfds);
-							FD_CLR(s->sock,&_writefds);
-#if defined(_WIN32) || defined(_WIN64)
-							FD_CLR(s->sock,&_exceptfds);
-#endif
-							try {
-								_handler->phyOnTcpConnect((PhySocket *)&(*s),&(s->uptr),true);
-							} catch ( ... ) {}
-						}
-					}
-					break;
-
-				case ZT_PHY_SOCKET_TCP_OUT_CONNECTED:
-				case ZT_PHY_SOCKET_TCP_IN: {
-					ZT_PHY_SOCKFD_TYPE sock = s->sock; // if closed, s->sock becomes invalid as s is no longer dereferencable
-					if (FD_ISSET(sock,&rfds)) {
-						long n = (long)::recv(sock,buf,sizeof(buf),0);
-						if (n <= 0) {
-							this->close((PhySocket *)&(*s),true);
-						} else {
-							try {
-								_handler->phyOnTcpData((PhySocket *)&(*s),&(s->uptr),(void *)buf,(unsigned long)n);
-							} catch ( ... ) {}
-						}
-					}
-					if ((FD_ISSET(sock,&wfds))&&(FD_ISSET(sock,&_writefds))) {
-						try {
-							_handler->phyOnTcpWritable((PhySocket *)&(*s),&(s->uptr));
-						} catch ( ... ) {}
-					}
-				}	break;
-
-				case ZT_PHY_SOCKET_TCP_LISTEN:
-					if (FD_ISSET(s->sock,&rfds)) {
-						memset(&ss,0,sizeof(ss));
-						socklen_t slen = sizeof(ss);
-						ZT_PHY_SOCKFD_TYPE newSock = ::accept(s->sock,(struct sockaddr *)&ss,&slen);
-						if (ZT_PHY_SOCKFD_VALID(newSock)) {
-							if (_socks.size() >= ZT_PHY_MAX_SOCKETS) {
-								ZT_PHY_CLOSE_SOCKET(newSock);
-							} else {
-#if defined(_WIN32) || defined(_WIN64)
-								{ BOOL f = (_noDelay ? TRUE : FALSE); setsockopt(newSock,IPPROTO_TCP,TCP_NODELAY,(char *)&f,sizeof(f)); }
-								{ u_long iMode=1; ioctlsocket(newSock,FIONBIO,&iMode); }
-#else
-								{ int f = (_noDelay ? 1 : 0); setsockopt(newSock,IPPROTO_TCP,TCP_NODELAY,(char *)&f,sizeof(f)); }
-								fcntl(newSock,F_SETFL,O_NONBLOCK);
-#endif
-								_socks.push_back(PhySocketImpl());
-								PhySocketImpl &sws = _socks.back();
-								FD_SET(newSock,&_readfds);
-								if ((long)newSock > _nfds)
-									_nfds = (long)newSock;
-								sws.type = ZT_PHY_SOCKET_TCP_IN;
-								sws.sock = newSock;
-								sws.uptr = (void *)0;
-								memcpy(&(sws.saddr),&ss,sizeof(struct sockaddr_storage));
-								try {
-									_handler->phyOnTcpAccept((PhySocket *)&(*s),(PhySocket *)&(_socks.back()),&(s->uptr),&(sws.uptr),(const struct sockaddr *)&(sws.saddr));
-								} catch ( ... ) {}
-							}
-						}
-					}
-					break;
-
-				case ZT_PHY_SOCKET_UDP:
-					if (FD_ISSET(s->sock,&rfds)) {
-						for(int k=0;k<1024;++k) {
-							memset(&ss,0,sizeof(ss));
-							socklen_t slen = sizeof(ss);
-							long n = (long)::recvfrom(s->sock,buf,sizeof(buf),0,(struct sockaddr *)&ss,&slen);
-							if (n > 0) {
-								try {
-									_handler->phyOnDatagram((PhySocket *)&(*s),&(s->uptr),(const struct sockaddr *)&(s->saddr),(const struct sockaddr *)&ss,(void *)buf,(unsigned long)n);
-								} catch ( ... ) {}
-							} else if (n < 0)
-								break;
-						}
-					}
-					break;
-
-				case ZT_PHY_SOCKET_UNIX_IN: {
-#ifdef __UNIX_LIKE__
-					ZT_PHY_SOCKFD_TYPE sock = s->sock; // if closed, s->sock becomes invalid as s is no longer dereferencable
-					if ((FD_ISSET(sock,&wfds))&&(FD_ISSET(sock,&_writefds))) {
-						try {
-							_handler->phyOnUnixWritable((PhySocket *)&(*s),&(s->uptr));
-						} catch ( ... ) {}
-					}
-					if (FD_ISSET(sock,&rfds)) {
-						long n = (long)::read(sock,buf,sizeof(buf));
-						if (n <= 0) {
-							this->close((PhySocket *)&(*s),true);
-						} else {
-							try {
-								_handler->phyOnUnixData((PhySocket *)&(*s),&(s->uptr),(void *)buf,(unsigned long)n);
-							} catch ( ... ) {}
-						}
-					}
-#endif // __UNIX_LIKE__
-				}	break;
-
-				case ZT_PHY_SOCKET_UNIX_LISTEN:
-#ifdef __UNIX_LIKE__
-					if (FD_ISSET(s->sock,&rfds)) {
-						memset(&ss,0,sizeof(ss));
-						socklen_t slen = sizeof(ss);
-						ZT_PHY_SOCKFD_TYPE newSock = ::accept(s->sock,(struct sockaddr *)&ss,&slen);
-						if (ZT_PHY_SOCKFD_VALID(newSock)) {
-							if (_socks.size() >= ZT_PHY_MAX_SOCKETS) {
-								ZT_PHY_CLOSE_SOCKET(newSock);
-							} else {
-								fcntl(newSock,F_SETFL,O_NONBLOCK);
-								_socks.push_back(PhySocketImpl());
-								PhySocketImpl &sws = _socks.back();
-								FD_SET(newSock,&_readfds);
-								if ((long)newSock > _nfds)
-									_nfds = (long)newSock;
-								sws.type = ZT_PHY_SOCKET_UNIX_IN;
-								sws.sock = newSock;
-								sws.uptr = (void *)0;
-								memcpy(&(sws.saddr),&ss,sizeof(struct sockaddr_storage));
-								try {
-									//_handler->phyOnUnixAccept((PhySocket *)&(*s),(PhySocket *)&(_socks.back()),&(s->uptr),&(sws.uptr));
-								} catch ( ... ) {}
-							}
-						}
-					}
-#endif // __UNIX_LIKE__
-					break;
-
-				case ZT_PHY_SOCKET_FD: {
-					ZT_PHY_SOCKFD_TYPE sock = s->sock;
-					const bool readable = ((FD_ISSET(sock,&rfds))&&(FD_ISSET(sock,&_readfds)));
-					const bool writable = ((FD_ISSET(sock,&wfds))&&(FD_ISSET(sock,&_writefds)));
-					if ((readable)||(writable)) {
-						try {
-							//_handler->phyOnFileDescriptorActivity((PhySocket *)&(*s),&(s->uptr),readable,writable);
-						} catch ( ... ) {}
-					}
-				}	break;
-
-				default:
-					break;
-
+			if (s->type != ZT_PHY_SOCKET_CLOSED) {
+				const ZT_PHY_SOCKFD_TYPE sock = s->sock;
+				const bool readable = (FD_ISSET(sock,&rfds) != 0);
+				const bool writable = (FD_ISSET(sock,&wfds) != 0);
+				const bool except = (FD_ISSET(sock,&efds) != 0);
+				if ((readable)||(writable)||(except))
+					_doActivity(*s,buf,sizeof(buf),readable,writable,except);
 			}
 
 			if (s->type == ZT_PHY_SOCKET_CLOSED)
 				_socks.erase(s++);
 			else ++s;
 		}
+#endif // epoll or select()
+
+#ifdef ZT_PHY_USE_MMSG
+		udpFlush();
+#endif
 	}
 
 	/**
@@ -1129,10 +1470,29 @@ public:
 		if (sws.type == ZT_PHY_SOCKET_CLOSED)
 			return;
 
+#ifdef ZT_PHY_USE_MMSG
+		if ((sws.type == ZT_PHY_SOCKET_UDP)&&(_txCount > 0))
+			udpFlush(); // queued packets may still reference this socket
+#endif
+
+#ifdef ZT_PHY_USE_EPOLL
+		{
+			struct epoll_event ev; // non-NULL for pre-2.6.9 kernels
+			::epoll_ctl(_epfd,EPOLL_CTL_DEL,sws.sock,&ev);
+			sws.events = 0;
+			_closedPending = true;
+		}
+#ifdef ZT_PHY_USE_IO_URING
+		// The entry is kept until the cancelled receive's final completion
+		if ((sws.uringArmed)&&(!_uringCancel(sws)))
+			_uringCancels.push_back(&sws); // retried by poll()
+#endif
+#else
 		FD_CLR(sws.sock,&_readfds);
 		FD_CLR(sws.sock,&_writefds);
 #if defined(_WIN32) || defined(_WIN64)
 		FD_CLR(sws.sock,&_exceptfds);
+#endif
 #endif
 
 		if (sws.type != ZT_PHY_SOCKET_FD)
@@ -1171,6 +1531,7 @@ public:
 		// Causes entry to be deleted from list in poll(), ignored elsewhere
 		sws.type = ZT_PHY_SOCKET_CLOSED;
 
+#ifndef ZT_PHY_USE_EPOLL
 		if ((long)sws.sock >= (long)_nfds) {
 			long nfds = (long)_whackSendSocket;
 			if ((long)_whackReceiveSocket > nfds)
@@ -1181,6 +1542,498 @@ public:
 			}
 			_nfds = nfds;
 		}
+#endif
+	}
+
+private:
+#ifdef ZT_PHY_USE_MMSG
+	// sendmmsg(), or the same thing as a chain of linked io_uring sendmsg requests
+	inline int _sendmmsg(const int fd,struct mmsghdr *const msgs,const unsigned int n)
+	{
+#ifdef ZT_PHY_USE_IO_URING
+		if ((_txRing)&&(n <= ZT_PHY_UDP_BATCH_SIZE)) {
+			for(unsigned int i=0;i<n;++i) {
+				struct io_uring_sqe *const sqe = _txRing->getSqe();
+				sqe->opcode = IORING_OP_SENDMSG;
+				sqe->fd = fd;
+				sqe->addr = (uint64_t)(uintptr_t)&(msgs[i].msg_hdr);
+				sqe->len = 1;
+				sqe->msg_flags = MSG_DONTWAIT; // never park a send in the kernel, fail it like sendmmsg() would
+				if ((i + 1) < n)
+					sqe->flags = IOSQE_IO_LINK; // a failure cancels the rest, so results are a prefix as with sendmmsg()
+				sqe->user_data = i;
+			}
+			if (_txRing->submit(n) == (int)n) {
+				unsigned int sent = 0;
+				int err = 0;
+				for(unsigned int k=0;k<n;++k) {
+					struct io_uring_cqe *cqe = _txRing->peekCqe();
+					if (!cqe) // can't happen, submit() waited for all n
+						break;
+					if (cqe->res >= 0)
+						++sent;
+					else if ((cqe->res != -ECANCELED)||(err == 0))
+						err = -cqe->res;
+					_txRing->cqeSeen();
+				}
+				if (sent > 0)
+					return (int)sent;
+				errno = err;
+				return -1;
+			}
+			// Fall back for good if the ring stops accepting work
+			delete _txRing;
+			_txRing = (IoUring *)0;
+		}
+#endif
+		return ::sendmmsg(fd,msgs,n,0);
+	}
+#endif
+
+#ifdef ZT_PHY_USE_IO_URING
+	// Set up both rings and add the receive ring to epoll, false if the kernel can't
+	inline bool _uringOpen()
+	{
+		_rxRing = new IoUring();
+		_txRing = new IoUring();
+		if ((_rxRing->open(ZT_PHY_IO_URING_RX_ENTRIES))&&(_rxRing->setupBuffers(ZT_PHY_IO_URING_BUFFER_GROUP,ZT_PHY_IO_URING_RX_BUFFERS,(unsigned int)ZT_PHY_IO_URING_RX_BUF_SIZE))&&(_txRing->open(ZT_PHY_UDP_BATCH_SIZE))) {
+			struct epoll_event ev;
+			memset(&ev,0,sizeof(ev));
+			ev.events = EPOLLIN | EPOLLET;
+			ev.data.ptr = (void *)_rxRing;
+			if (::epoll_ctl(_epfd,EPOLL_CTL_ADD,_rxRing->fd(),&ev) == 0)
+				return true;
+		}
+		delete _rxRing;
+		_rxRing = (IoUring *)0;
+		delete _txRing;
+		_txRing = (IoUring *)0;
+		return false;
+	}
+
+	// Post a multishot receive for a UDP socket
+	inline bool _uringArm(PhySocketImpl &sws)
+	{
+		struct io_uring_sqe *const sqe = _rxRing->getSqe();
+		if (!sqe)
+			return false;
+		sqe->opcode = IORING_OP_RECVMSG;
+		sqe->fd = sws.sock;
+		sqe->addr = (uint64_t)(uintptr_t)&_rxMsg;
+		sqe->len = 1;
+		sqe->ioprio = IORING_RECV_MULTISHOT;
+		sqe->flags = IOSQE_BUFFER_SELECT;
+		sqe->buf_group = ZT_PHY_IO_URING_BUFFER_GROUP;
+		sqe->user_data = (uint64_t)(uintptr_t)&sws;
+		if (_rxRing->submit() < 0)
+			return false;
+		sws.uringRecv = true;
+		sws.uringArmed = true;
+		return true;
+	}
+
+	// Cancel a socket's multishot receive, false if there is no room in the ring even after submitting
+	inline bool _uringCancel(PhySocketImpl &sws)
+	{
+		struct io_uring_sqe *sqe = _rxRing->getSqe();
+		if (!sqe) {
+			_rxRing->submit(); // the kernel consumes submitted entries, freeing their slots
+			sqe = _rxRing->getSqe();
+			if (!sqe)
+				return false;
+		}
+		sqe->opcode = IORING_OP_ASYNC_CANCEL;
+		sqe->fd = -1;
+		sqe->addr = (uint64_t)(uintptr_t)&sws;
+		sqe->user_data = 0;
+		_rxRing->submit();
+		return true;
+	}
+
+	// Dispatch receive completions, called when epoll reports the ring readable
+	inline void _uringReap()
+	{
+		int k = 0;
+		if (_rxRing->cqOverflowed())
+			_rxRing->flushOverflow(); // completions that didn't fit in the CQ, e.g. final ones after mass close()
+		for(struct io_uring_cqe *cqe=_rxRing->peekCqe();(cqe);cqe=_rxRing->peekCqe()) {
+			PhySocketImpl *const sws = reinterpret_cast<PhySocketImpl *>((uintptr_t)cqe->user_data);
+			const int res = cqe->res;
+			const uint32_t flags = cqe->flags;
+			_rxRing->cqeSeen();
+			if (!sws)
+				continue; // completion of a cancel request
+
+			if (flags & IORING_CQE_F_BUFFER) {
+				const unsigned int bid = flags >> IORING_CQE_BUFFER_SHIFT;
+				if ((res > 0)&&(sws->type == ZT_PHY_SOCKET_UDP)) {
+					uint8_t *const b = _rxRing->buffer(bid);
+					const struct io_uring_recvmsg_out *const out = reinterpret_cast<const struct io_uring_recvmsg_out *>(b);
+					if (((out->flags & MSG_TRUNC) == 0)&&(out->payloadlen > 0)) { // oversized datagrams are dropped
+						try {
+							_handler->phyOnDatagram((PhySocket *)sws,&(sws->uptr),(const struct sockaddr *)&(sws->saddr),(const struct sockaddr *)(b + sizeof(struct io_uring_recvmsg_out)),(void *)(b + sizeof(struct io_uring_recvmsg_out) + _rxMsg.msg_namelen + _rxMsg.msg_controllen),(unsigned long)out->payloadlen);
+						} catch ( ... ) {}
+					}
+				}
+				_rxRing->recycleBuffer(bid);
+			}
+
+			if ((flags & IORING_CQE_F_MORE) == 0) {
+				// Multishot ended: cancelled, out of buffers, or unsupported by this kernel
+				sws->uringArmed = false;
+				if (sws->type == ZT_PHY_SOCKET_CLOSED) {
+					_closedPending = true;
+					if (!_uringCancels.empty()) // entry may be freed by poll() now, so forget any cancel still waiting for room
+						_uringCancels.erase(std::remove(_uringCancels.begin(),_uringCancels.end(),sws),_uringCancels.end());
+				} else if ((res == -EINVAL)||(!_uringArm(*sws))) {
+					sws->uringRecv = false;
+					if (res == -EINVAL)
+						_ioUringWanted = false; // no multishot recvmsg (pre-6.0), don't try again
+					_watch(*sws,true,false);
+				}
+			}
+
+			if (++k >= 4096) {
+				// Re-arm the edge so the rest is picked up on the next poll()
+				struct epoll_event ev;
+				memset(&ev,0,sizeof(ev));
+				ev.events = EPOLLIN | EPOLLET;
+				ev.data.ptr = (void *)_rxRing;
+				::epoll_ctl(_epfd,EPOLL_CTL_MOD,_rxRing->fd(),&ev);
+				break;
+			}
+		}
+	}
+#endif
+
+#ifdef ZT_PHY_USE_UDP_GSO
+	// Send queued packets [i,j), all on sws, as UDP_SEGMENT messages. Returns
+	// false if GSO failed before anything was sent so the caller can fall back.
+	inline bool _udpFlushGso(PhySocketImpl *sws,const unsigned int i,const unsigned int j)
+	{
+		unsigned int m = 0;
+		unsigned int k = i;
+		while (k < j) {
+			const struct mmsghdr &first = _txBatch->msgs[k];
+			const size_t segSize = _txBatch->iov[k].iov_len;
+			size_t total = segSize;
+			unsigned int e = k + 1;
+			// Segments must be the same size except for a shorter last one
+			while ((e < j)&&(_txBatch->iov[e-1].iov_len == segSize)&&(_txBatch->iov[e].iov_len <= segSize)&&((total + _txBatch->iov[e].iov_len) <= ZT_PHY_UDP_GSO_MAX_BYTES)&&(_txBatch->msgs[e].msg_hdr.msg_namelen == first.msg_hdr.msg_namelen)&&(memcmp(&(_txBatch->addrs[e]),&(_txBatch->addrs[k]),first.msg_hdr.msg_namelen) == 0))
+				total += _txBatch->iov[e++].iov_len;
+
+			struct msghdr &h = _txBatch->gso[m].msg_hdr;
+			h.msg_name = &(_txBatch->addrs[k]);
+			h.msg_namelen = first.msg_hdr.msg_namelen;
+			h.msg_iov = &(_txBatch->iov[k]);
+			h.msg_iovlen = e - k;
+			if ((e - k) > 1) {
+				h.msg_control = _txBatch->ctrl[m];
+				h.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+				struct cmsghdr *const cm = CMSG_FIRSTHDR(&h);
+				cm->cmsg_level = SOL_UDP;
+				cm->cmsg_type = UDP_SEGMENT;
+				cm->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+				const uint16_t gs = (uint16_t)segSize;
+				memcpy(CMSG_DATA(cm),&gs,sizeof(gs));
+			} else {
+				h.msg_control = (void *)0;
+				h.msg_controllen = 0;
+			}
+			++m;
+			k = e;
+		}
+
+		unsigned int sent = 0;
+		while (sent < m) {
+			const int n = _sendmmsg(sws->sock,&(_txBatch->gso[sent]),m - sent);
+			if (n > 0) {
+				sent += (unsigned int)n;
+			} else if ((n < 0)&&(errno == EINTR)) {
+				continue;
+			} else if ((n < 0)&&((errno == EIO)||(errno == EINVAL))&&(_txBatch->gso[sent].msg_hdr.msg_controllen)) {
+				// EIO means the device path can't checksum segments, so stop trying
+				// on this socket. EINVAL is usually a segment larger than the path
+				// MTU. Either way this and later messages go out one packet each.
+				if (errno == EIO)
+					sws->udpGso = false;
+				if (sent == 0)
+					return false;
+				for(;sent<m;++sent) {
+					const struct msghdr &h = _txBatch->gso[sent].msg_hdr;
+					for(size_t q=0;q<h.msg_iovlen;++q)
+						::sendto(sws->sock,h.msg_iov[q].iov_base,h.msg_iov[q].iov_len,0,(const struct sockaddr *)h.msg_name,h.msg_namelen);
+				}
+			} else {
+				++sent; // drop the message that failed, as a failed sendto() would
+			}
+		}
+		return true;
+	}
+#endif
+
+	// Handle readiness on one socket. With edge-triggered epoll each readable
+	// socket must be drained until it would block, since no further event is
+	// delivered for data that is already queued.
+	inline void _doActivity(PhySocketImpl &s,char *buf,unsigned long bufSize,bool readable,bool writable,bool except)
+	{
+		struct sockaddr_storage ss;
+
+		switch (s.type) {
+
+			case ZT_PHY_SOCKET_TCP_OUT_PENDING:
+				if (except) {
+					this->close((PhySocket *)&s,true);
+				} else if (writable) {
+					socklen_t slen = sizeof(ss);
+					if (::getpeername(s.sock,(struct sockaddr *)&ss,&slen) != 0) {
+						this->close((PhySocket *)&s,true);
+					} else {
+						s.type = ZT_PHY_SOCKET_TCP_OUT_CONNECTED;
+						_setInterest(s,true,false);
+#if defined(_WIN32) || defined(_WIN64)
+						FD_CLR(s.sock,&_exceptfds);
+#endif
+						try {
+							_handler->phyOnTcpConnect((PhySocket *)&s,&(s.uptr),true);
+						} catch ( ... ) {}
+					}
+				}
+				break;
+
+			case ZT_PHY_SOCKET_TCP_OUT_CONNECTED:
+			case ZT_PHY_SOCKET_TCP_IN:
+				if (readable) {
+					for(;;) {
+						long n = (long)::recv(s.sock,buf,bufSize,0);
+						if (n <= 0) {
+#ifdef ZT_PHY_USE_EPOLL
+							if ((n < 0)&&(errno == EINTR))
+								continue;
+							if ((n < 0)&&((errno == EAGAIN)||(errno == EWOULDBLOCK)))
+								break;
+#endif
+							this->close((PhySocket *)&s,true);
+							break;
+						}
+						try {
+							_handler->phyOnTcpData((PhySocket *)&s,&(s.uptr),(void *)buf,(unsigned long)n);
+						} catch ( ... ) {}
+#ifdef ZT_PHY_USE_EPOLL
+						if ((s.type == ZT_PHY_SOCKET_CLOSED)||((unsigned long)n < bufSize))
+							break; // a short read means the socket buffer is empty
+#else
+						break;
+#endif
+					}
+				}
+				if ((writable)&&(s.type != ZT_PHY_SOCKET_CLOSED)&&(_wantsWritable(s))) {
+					try {
+						_handler->phyOnTcpWritable((PhySocket *)&s,&(s.uptr));
+					} catch ( ... ) {}
+				}
+				break;
+
+			case ZT_PHY_SOCKET_TCP_LISTEN:
+				while (readable) {
+					memset(&ss,0,sizeof(ss));
+					socklen_t slen = sizeof(ss);
+					ZT_PHY_SOCKFD_TYPE newSock = ::accept(s.sock,(struct sockaddr *)&ss,&slen);
+					if (!ZT_PHY_SOCKFD_VALID(newSock))
+						break;
+					if (_socks.size() >= ZT_PHY_MAX_SOCKETS) {
+						ZT_PHY_CLOSE_SOCKET(newSock);
+					} else {
+#if defined(_WIN32) || defined(_WIN64)
+						{ BOOL f = (_noDelay ? TRUE : FALSE); setsockopt(newSock,IPPROTO_TCP,TCP_NODELAY,(char *)&f,sizeof(f)); }
+						{ u_long iMode=1; ioctlsocket(newSock,FIONBIO,&iMode); }
+#else
+						{ int f = (_noDelay ? 1 : 0); setsockopt(newSock,IPPROTO_TCP,TCP_NODELAY,(char *)&f,sizeof(f)); }
+						fcntl(newSock,F_SETFL,O_NONBLOCK);
+#endif
+						_socks.push_back(PhySocketImpl());
+						PhySocketImpl &sws = _socks.back();
+						sws.type = ZT_PHY_SOCKET_TCP_IN;
+						sws.sock = newSock;
+						sws.uptr = (void *)0;
+						memcpy(&(sws.saddr),&ss,sizeof(struct sockaddr_storage));
+						if (!_watch(sws,true,false)) {
+							_socks.pop_back();
+							ZT_PHY_CLOSE_SOCKET(newSock);
+						} else {
+							try {
+								_handler->phyOnTcpAccept((PhySocket *)&s,(PhySocket *)&sws,&(s.uptr),&(sws.uptr),(const struct sockaddr *)&(sws.saddr));
+							} catch ( ... ) {}
+						}
+					}
+#ifndef ZT_PHY_USE_EPOLL
+					break;
+#endif
+				}
+				break;
+
+			case ZT_PHY_SOCKET_UDP:
+				if (readable) {
+					int k = 0;
+#ifdef ZT_PHY_USE_MMSG
+					while (k < 1024) {
+						for(unsigned int i=0;i<ZT_PHY_UDP_BATCH_SIZE;++i) {
+							_rxBatch->msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+#ifdef ZT_PHY_USE_UDP_GSO
+							_rxBatch->msgs[i].msg_hdr.msg_control = _rxBatch->ctrl[i];
+							_rxBatch->msgs[i].msg_hdr.msg_controllen = sizeof(_rxBatch->ctrl[i]);
+#endif
+						}
+						const int n = ::recvmmsg(s.sock,_rxBatch->msgs,ZT_PHY_UDP_BATCH_SIZE,MSG_DONTWAIT,(struct timespec *)0);
+						if (n <= 0)
+							break;
+						k += n;
+						for(int i=0;i<n;++i) {
+							const struct mmsghdr &m = _rxBatch->msgs[i];
+							if ((m.msg_len > 0)&&((m.msg_hdr.msg_flags & MSG_TRUNC) == 0)) { // oversized datagrams are dropped
+#ifdef ZT_PHY_USE_UDP_GSO
+								// A GRO receive holds several datagrams of segment size
+								// back to back, the last one possibly shorter.
+								unsigned long segSize = (unsigned long)m.msg_len;
+#ifdef UDP_GRO
+								for(struct cmsghdr *cm=CMSG_FIRSTHDR(&(m.msg_hdr));cm;cm=CMSG_NXTHDR(const_cast<struct msghdr *>(&(m.msg_hdr)),cm)) {
+									if ((cm->cmsg_level == SOL_UDP)&&(cm->cmsg_type == UDP_GRO)) {
+										int gs = 0;
+										memcpy(&gs,CMSG_DATA(cm),sizeof(gs));
+										if (gs > 0)
+											segSize = (unsigned long)gs;
+										break;
+									}
+								}
+#endif
+								for(unsigned long p=0;p<(unsigned long)m.msg_len;p+=segSize) {
+									try {
+										_handler->phyOnDatagram((PhySocket *)&s,&(s.uptr),(const struct sockaddr *)&(s.saddr),(const struct sockaddr *)&(_rxBatch->addrs[i]),(void *)(_rxBatch->bufs[i] + p),(((unsigned long)m.msg_len - p) < segSize) ? ((unsigned long)m.msg_len - p) : segSize);
+									} catch ( ... ) {}
+									if (s.type == ZT_PHY_SOCKET_CLOSED)
+										break;
+								}
+#else
+								try {
+									_handler->phyOnDatagram((PhySocket *)&s,&(s.uptr),(const struct sockaddr *)&(s.saddr),(const struct sockaddr *)&(_rxBatch->addrs[i]),(void *)_rxBatch->bufs[i],(unsigned long)m.msg_len);
+								} catch ( ... ) {}
+#endif
+								if (s.type == ZT_PHY_SOCKET_CLOSED)
+									break;
+							}
+						}
+						if ((s.type == ZT_PHY_SOCKET_CLOSED)||(n < ZT_PHY_UDP_BATCH_SIZE))
+							break; // a short batch means the socket is empty
+					}
+#else
+					for(;k<1024;++k) {
+						memset(&ss,0,sizeof(ss));
+						socklen_t slen = sizeof(ss);
+						long n = (long)::recvfrom(s.sock,buf,bufSize,0,(struct sockaddr *)&ss,&slen);
+						if (n > 0) {
+							try {
+								_handler->phyOnDatagram((PhySocket *)&s,&(s.uptr),(const struct sockaddr *)&(s.saddr),(const struct sockaddr *)&ss,(void *)buf,(unsigned long)n);
+							} catch ( ... ) {}
+							if (s.type == ZT_PHY_SOCKET_CLOSED)
+								break;
+						} else if (n < 0)
+							break;
+					}
+#endif
+#ifdef ZT_PHY_USE_EPOLL
+					// Budget exhausted with data possibly still queued: re-arm so epoll
+					// reports this socket again instead of waiting for a new edge.
+					if ((k >= 1024)&&(s.type != ZT_PHY_SOCKET_CLOSED)) {
+						struct epoll_event ev;
+						memset(&ev,0,sizeof(ev));
+						ev.events = s.events | EPOLLET;
+						ev.data.ptr = (void *)&s;
+						::epoll_ctl(_epfd,EPOLL_CTL_MOD,s.sock,&ev);
+					}
+#endif
+				}
+				break;
+
+			case ZT_PHY_SOCKET_UNIX_IN:
+#ifdef __UNIX_LIKE__
+				if ((writable)&&(_wantsWritable(s))) {
+					try {
+						_handler->phyOnUnixWritable((PhySocket *)&s,&(s.uptr));
+					} catch ( ... ) {}
+				}
+				if ((readable)&&(s.type != ZT_PHY_SOCKET_CLOSED)) {
+					for(;;) {
+						long n = (long)::read(s.sock,buf,bufSize);
+						if (n <= 0) {
+#ifdef ZT_PHY_USE_EPOLL
+							if ((n < 0)&&(errno == EINTR))
+								continue;
+							if ((n < 0)&&((errno == EAGAIN)||(errno == EWOULDBLOCK)))
+								break;
+#endif
+							this->close((PhySocket *)&s,true);
+							break;
+						}
+						try {
+							_handler->phyOnUnixData((PhySocket *)&s,&(s.uptr),(void *)buf,(unsigned long)n);
+						} catch ( ... ) {}
+#ifdef ZT_PHY_USE_EPOLL
+						if ((s.type == ZT_PHY_SOCKET_CLOSED)||((unsigned long)n < bufSize))
+							break;
+#else
+						break;
+#endif
+					}
+				}
+#endif // __UNIX_LIKE__
+				break;
+
+			case ZT_PHY_SOCKET_UNIX_LISTEN:
+#ifdef __UNIX_LIKE__
+				while (readable) {
+					memset(&ss,0,sizeof(ss));
+					socklen_t slen = sizeof(ss);
+					ZT_PHY_SOCKFD_TYPE newSock = ::accept(s.sock,(struct sockaddr *)&ss,&slen);
+					if (!ZT_PHY_SOCKFD_VALID(newSock))
+						break;
+					if (_socks.size() >= ZT_PHY_MAX_SOCKETS) {
+						ZT_PHY_CLOSE_SOCKET(newSock);
+					} else {
+						fcntl(newSock,F_SETFL,O_NONBLOCK);
+						_socks.push_back(PhySocketImpl());
+						PhySocketImpl &sws = _socks.back();
+						sws.type = ZT_PHY_SOCKET_UNIX_IN;
+						sws.sock = newSock;
+						sws.uptr = (void *)0;
+						memcpy(&(sws.saddr),&ss,sizeof(struct sockaddr_storage));
+						if (!_watch(sws,true,false)) {
+							_socks.pop_back();
+							ZT_PHY_CLOSE_SOCKET(newSock);
+						} else {
+							try {
+								//_handler->phyOnUnixAccept((PhySocket *)&s,(PhySocket *)&sws,&(s.uptr),&(sws.uptr));
+							} catch ( ... ) {}
+						}
+					}
+#ifndef ZT_PHY_USE_EPOLL
+					break;
+#endif
+				}
+#endif // __UNIX_LIKE__
+				break;
+
+			case ZT_PHY_SOCKET_FD:
+				if (((readable)&&(_wantsReadable(s)))||((writable)&&(_wantsWritable(s)))) {
+					try {
+						//_handler->phyOnFileDescriptorActivity((PhySocket *)&s,&(s.uptr),readable,writable);
+					} catch ( ... ) {}
+				}
+				break;
+
+			default:
+				break;
+
+		}
 	}
 };
 
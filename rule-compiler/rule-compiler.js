@@ -612,6 +612,22 @@ function _renderActions(rtree,rules,macros,caps,tags,params)
 			} else {
 				return [ rtree[k][1],rtree[k][2],'The redirect action requires a target parameter.' ];
 			}
+		} else if (action === 'priority') {
+			if (((k + 1) < rtree.length)&&(Array.isArray(rtree[k + 1][0]))&&(rtree[k + 1][0].length >= 1)) {
+				let mtree = rtree[k + 1]; ++k;
+				let qosBucket = _parseNum(mtree[0][0]);
+				if (!((qosBucket >= 0)&&(qosBucket <= 8)))
+					return [ mtree[0][1],mtree[0][2],'Missing or invalid QoS bucket (0-8) for priority.' ];
+				let err = _renderMatches(mtree.slice(1),rules,macros,caps,tags,params);
+				if (err !== null)
+					return err;
+				rules.push({
+					'type': KEYWORD_TO_API_MAP[action],
+					'qosBucket': qosBucket
+				});
+			} else {
+				return [ rtree[k][1],rtree[k][2],'The priority action requires a QoS bucket parameter.' ];
+			}
 		} else {
 			return [ rtree[k][1],rtree[k][2],'Unrecognized action or directive in rule set.' ];
 		}
@@ -33,16 +33,27 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <map>
+#include <utility>
+#include <unordered_map>
+#include <atomic>
 #include <thread>
 
 #include "node/Constants.hpp"
 #include "node/Hashtable.hpp"
+#include "node/ConcurrentHashtable.hpp"
+#include "node/Epoch.hpp"
+#include "node/SharedPtr.hpp"
+#include "node/BorrowedPtr.hpp"
+#include "node/AtomicCounter.hpp"
+#include "node/Mutex.hpp"
 #include "node/RuntimeEnvironment.hpp"
 #include "node/InetAddress.hpp"
 #include "node/Utils.hpp"
 #include "node/Identity.hpp"
 #include "node/Buffer.hpp"
 #include "node/Packet.hpp"
+#include "node/PacketPool.hpp"
 #include "node/Salsa20.hpp"
 #include "node/MAC.hpp"
 #include "node/NetworkConfig.hpp"
@@ -51,9 +62,11 @@
 #include "node/SHA512.hpp"
 #include "node/C25519.hpp"
 #include "node/Poly1305.hpp"
+#include "node/AES.hpp"
 #include "node/CertificateOfMembership.hpp"
 #include "node/Node.hpp"
 #include "node/IncomingPacket.hpp"
+#include "node/Switch.hpp"
 
 #include "osdep/OSUtils.hpp"
 #include "osdep/Phy.hpp"
@@ -94,6 +107,18 @@ static const unsigned char poly1305TV1Input[12] = { 0x48,0x65,0x6c,0x6c,0x6f,0x2
 static const unsigned char poly1305TV1Key[32] = { 0x74,0x68,0x69,0x73,0x20,0x69,0x73,0x20,0x33,0x32,0x2d,0x62,0x79,0x74,0x65,0x20,0x6b,0x65,0x79,0x20,0x66,0x6f,0x72,0x20,0x50,0x6f,0x6c,0x79,0x31,0x33,0x30,0x35 };
 static const unsigned char poly1305TV1Tag[16] = { 0xa6,0xf7,0x45,0x00,0x8f,0x81,0xc9,0x16,0xa2,0x0d,0xcc,0x74,0xee,0xf2,0xb2,0xf0 };
 
+static const unsigned char aesTV0Key[32] = { 0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x1e,0x1f };
+static const unsigned char aesTV0In[16] = { 0x00,0x11,0x22,0x33,0x44,0x55,0x66,0x77,0x88,0x99,0xaa,0xbb,0xcc,0xdd,0xee,0xff };
+static const unsigned char aesTV0Out[16] = { 0x8e,0xa2,0xb7,0xca,0x51,0x67,0x45,0xbf,0xea,0xfc,0x49,0x90,0x4b,0x49,0x60,0x89 };
+
+// RFC 8452 appendix C.2, first two AES-256-GCM-SIV vectors
+static const unsigned char aesGcmSivTVKey[32] = { 0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 };
+static const unsigned char aesGcmSivTVNonce[12] = { 0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 };
+static const unsigned char aesGcmSivTV0Tag[16] = { 0x07,0xf5,0xf4,0x16,0x9b,0xbf,0x55,0xa8,0x40,0x0c,0xd4,0x7e,0xa6,0xfd,0x40,0x0f };
+static const unsigned char aesGcmSivTV1In[8] = { 0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00 };
+static const unsigned char aesGcmSivTV1Out[8] = { 0xc2,0xef,0x32,0x8e,0x5c,0x71,0xc8,0x3b };
+static const unsigned char aesGcmSivTV1Tag[16] = { 0x84,0x31,0x22,0x13,0x0f,0x73,0x64,0xb7,0x61,0xe0,0xb9,0x74,0x27,0xe3,0xdf,0x28 };
+
 static const char *sha512TV0Input = "supercalifragilisticexpealidocious";
 static const unsigned char sha512TV0Digest[64] = { 0x18,0x2a,0x85,0x59,0x69,0xe5,0xd3,0xe6,0xcb,0xf6,0x05,0x24,0xad,0xf2,0x88,0xd1,0xbb,0xf2,0x52,0x92,0x81,0x24,0x31,0xf6,0xd2,0x52,0xf1,0xdb,0xc1,0xcb,0x44,0xdf,0x21,0x57,0x3d,0xe1,0xb0,0x6b,0x68,0x75,0x95,0x9f,0x3b,0x6f,0x87,0xb1,0x13,0x81,0xd0,0xbc,0x79,0x2c,0x43,0x3a,0x13,0x55,0x3c,0xe0,0x84,0xc2,0x92,0x55,0x31,0x1c };
 
@@ -145,6 +170,60 @@ static const C25519TestVector C25519_TEST_VECTORS[ZT_NUM_C25519_TEST_VECTORS] =
 	{{0x25,0x87,0x1e,0x6f,0xe8,0xd0,0xde,0x1d,0xd5,0xf2,0xd3,0x5b,0xff,0x9e,0x67,0x99,0x60,0xb4,0x0e,0xb7,0x98,0x1b,0x2a,0x3a,0x9c,0xec,0xc1,0xe1,0x2e,0x2b,0xc0,0x3e,0x3c,0xfb,0x64,0x91,0x72,0xc6,0x7e,0x57,0x47,0x00,0x97,0xbf,0x8e,0x0e,0xbf,0xad,0xd9,0x28,0x86,0x7c,0xfd,0x41,0x91,0xae,0x2d,0xee,0xc0,0xb2,0x32,0x7d,0x99,0x7d},{0x63,0xc1,0xf9,0x61,0x9c,0x9e,0x1a,0xd7,0xca,0xa3,0x71,0xd6,0x34,0x3d,0xa7,0x08,0x36,0x0c,0xec,0x37,0x35,0x94,0x1a,0x45,0xa9,0xfa,0xf2,0xb5,0x25,0x92,0xbf,0xd1,0x1e,0xca,0xdd,0x5a,0x23,0xad,0x9e,0x45,0xc3,0x66,0xcb,0x8f,0xda,0xa3,0xd1,0xe6,0x27,0x38,0x11,0x54,0x67,0x31,0x03,0x64,0x35,0xe0,0x68,0x0b,0x93,0xee,0x81,0x17},{0x8b,0x01,0xe9,0x99,0x54,0x54,0x73,0x15,0x0b,0xac,0x38,0x7b,0xe9,0xe3,0x17,0x4f,0x02,0x3e,0xe3,0x8e,0xda,0x41,0xa0,0x9d,0x10,0xe0,0xda,0x11,0xfe,0xec,0x2f,0x42,0xe7,0xc8,0xb3,0xde,0x2f,0x7b,0xfd,0xdf,0x7c,0x34,0x3b,0x5e,0xac,0x22,0x8c,0x99,0x3d,0xa1,0xa9,0xd9,0x81,0xb6,0x51,0xc8,0xaf,0x3e,0x75,0xed,0x45,0xcf,0xf7,0xb9},{0xaf,0xe9,0x9c,0x16,0x4a,0x8f,0x3b,0x0f,0xef,0x71,0x2f,0xaa,0x8d,0x7d,0xce,0xed,0xea,0x31,0x93,0xaf,0x2c,0x75,0xc6,0xfa,0xda,0x3e,0xa6,0xea,0x2a,0x3e,0x7b,0x72,0xb6,0xf8,0xd7,0x9a,0x88,0xcb,0x0b,0x81,0x97,0x24,0x29,0x3b,0x11,0x23,0x69,0xc2,0xff,0x98,0x39,0x25,0x99,0xae,0xe1,0x07,0x3e,0x97,0xde,0x10,0x21,0x23,0x7a,0x2d},{0xbe,0x2f,0xb9,0x4c,0x41,0x5a,0x9a,0xf6,0xfb,0xf8,0x26,0x9d,0x81,0x7f,0x39,0x91,0xaf,0x5b,0xf1,0xd7,0x93,0x0a,0xdf,0x18,0x19,0x4a,0x80,0x74,0x14,0x98,0x2b,0xf2,0x3b,0x25,0xc5,0xe8,0xfc,0x07,0x3f,0x5d,0xa1,0x39,0x27,0x4e,0x1c,0xd2,0x7a,0xfe,0x3e,0x7b,0x03,0x35,0x15,0x9e,0x35,0x2b,0xd0,0xbe,0x67,0x48,0x42,0xdd,0xa4,0xdd},{0xbd,0xcd,0xd7,0xbf,0xb1,0x0a,0xdb,0x9f,0x85,0x42,0xba,0xf4,0xc8,0xff,0xb0,0xe1,0x9a,0x18,0x6d,0x1a,0xe0,0x37,0xc1,0xa2,0xe1,0x1c,0x38,0x55,0x14,0xbf,0x64,0x67,0x84,0x47,0xb6,0x0a,0xf6,0x93,0xf1,0x10,0xab,0x09,0xf0,0x60,0x84,0xe2,0x4e,0x4b,0x5e,0xa2,0xd2,0xd1,0x19,0x22,0xd7,0xc4,0x85,0x13,0x23,0xa3,0x6a,0xb6,0x75,0x0f,0x43,0xe6,0xde,0x7b,0x67,0x2a,0x73,0x77,0x9e,0xb4,0x94,0x6c,0xc3,0x9a,0x67,0x51,0xcf,0xe9,0x47,0x46,0x0e,0x3a,0x12,0x7d,0x7c,0x66,0x73,0x6c,0xd5,0x4a,0x21,0x4d},{0x89,0x7e,0xd0,0xbf,0x2e,0x9f,0x0c,0xff,0x6e,0x56,0x25,0x9b,0x79,0x99,0x52,0x27,0xc2,0x3a,0xaa,0xf0,0x47,0x6d,0xed,0x05,0xa1,0xeb,0x9c,0x92,0x28,0x7f,0x1b,0xc8,0x1c,0x57,0x76,0xab,0x05,0xe3,0xd3,0xb7,0xa3,0xf5,0xac,0xa8,0x21,0x33,0x7c,0xb7,0xe7,0xc2,0xd0,0x25,0x6f,0xdf,0x34,0xd1,0xb0,0x34,0x41,0x46,0x30,0x9c,0x76,0x07,0x43,0xe6,0xde,0x7b,0x67,0x2a,0x73,0x77,0x9e,0xb4,0x94,0x6c,0xc3,0x9a,0x67,0x51,0xcf,0xe9,0x47,0x46,0x0e,0x3a,0x12,0x7d,0x7c,0x66,0x73,0x6c,0xd5,0x4a,0x21,0x4d}}
 };
 
+// Expected result of the C25519 cross-check below, computed with the original
+// 10-limb field code (built with ZT_C25519_NO_RADIX51)
+#define ZT_C25519_CROSS_CHECK_ROUNDS 256
+static const unsigned char C25519_CROSS_CHECK_DIGEST[64] = { 0x30,0x3a,0x8f,0x1c,0x5e,0x5b,0xd8,0xd0,0xb8,0x51,0x43,0xb0,0xe0,0x66,0x2b,0xbc,0x71,0xf3,0x2e,0x1d,0x5e,0x3b,0x46,0xde,0x2d,0xcc,0x99,0xcd,0x4f,0x7c,0xd0,0x18,0xd9,0x70,0x63,0xde,0xc1,0xcc,0xd7,0x1a,0x70,0xcf,0x44,0x34,0x55,0x79,0x29,0xf6,0x46,0xb9,0x9c,0xda,0xc1,0x19,0xa1,0x92,0x0a,0xbe,0x39,0xf6,0xbe,0x83,0xef,0xfa };
+
+// Private key halves: zero, all ones, one, the group order L, L - 1, and p = 2^255 - 19
+static const unsigned char C25519_EDGE_SCALARS[6][32] = {
+	{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+	{0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},
+	{0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+	{0xed,0xd3,0xf5,0x5c,0x1a,0x63,0x12,0x58,0xd6,0x9c,0xf7,0xa2,0xde,0xf9,0xde,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10},
+	{0xec,0xd3,0xf5,0x5c,0x1a,0x63,0x12,0x58,0xd6,0x9c,0xf7,0xa2,0xde,0xf9,0xde,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10},
+	{0xed,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f}
+};
+
+// X25519 u-coordinates: 0, 1, p - 1, p, p + 1, p + 9 (the base point unreduced), 2^255 - 1, and 9 with the unused top bit set
+static const unsigned char C25519_EDGE_U[8][32] = {
+	{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+	{0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+	{0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f},
+	{0xed,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f},
+	{0xee,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f},
+	{0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f},
+	{0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f},
+	{0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80}
+};
+
+// Ed25519 point encodings: y = p, y = p + 1 (unreduced identity) with and without the sign bit, y = 2^255 - 1, and y = 1 with x = 0 but the sign bit set
+static const unsigned char C25519_EDGE_ED[5][32] = {
+	{0xed,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f},
+	{0xee,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f},
+	{0xee,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff},
+	{0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f},
+	{0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80}
+};
+
+// Deterministic input stream for the cross-check: a SHA-512 hash chain
+static void c25519CrossCheckRandom(unsigned char state[64],void *out,unsigned int len)
+{
+	for(unsigned int i=0;i<len;i+=64) {
+		SHA512::hash(state,state,64);
+		memcpy((unsigned char *)out + i,state,((len - i) < 64) ? (len - i) : 64);
+	}
+}
+
+// Folds an output into the running digest (len <= 96)
+static void c25519CrossCheckFold(unsigned char acc[64],const void *data,unsigned int len)
+{
+	unsigned char tmp[64 + 96];
+	memcpy(tmp,acc,64);
+	memcpy(tmp + 64,data,len);
+	SHA512::hash(acc,tmp,64 + len);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 static int testCrypto()
@@ -198,8 +277,54 @@ static int testCrypto()
 	std::cout << "[crypto] Salsa20 SSE: DISABLED" << std::endl;
 #endif
 
-	std::cout << "[crypto] Benchmarking Salsa20/12... "; std::cout.flush();
-	{
+	static const char *const s20KernelNames[4] = { "baseline","SSE2 x4","AVX2 x8","AVX-512 x16" };
+	const Salsa20::Kernel s20DefaultKernel = Salsa20::kernel();
+	std::cout << "[crypto] Salsa20 kernel: " << s20KernelNames[s20DefaultKernel] << std::endl;
+	for(int k=(int)Salsa20::KERNEL_SSE2_X4;k<=(int)Salsa20::KERNEL_AVX512_X16;++k) {
+		if (!Salsa20::kernelSupported((Salsa20::Kernel)k))
+			continue;
+		std::cout << "[crypto] Testing Salsa20 " << s20KernelNames[k] << " kernel against baseline... "; std::cout.flush();
+		// Odd lengths and split calls exercise every kernel width, the tail, and counter carry-over between calls
+		static const unsigned int lens[6] = { 256,300,1024,1111,2049,5431 };
+		for(unsigned int i=0;i<sizeof(buf1);++i)
+			buf1[i] = (unsigned char)rand();
+		for(unsigned int l=0;l<6;++l) {
+			for(unsigned int rounds=12;rounds<=20;rounds+=8) {
+				for(int pass=0;pass<2;++pass) {
+					Salsa20::setKernel((pass == 0) ? Salsa20::KERNEL_BASELINE : (Salsa20::Kernel)k);
+					unsigned char *const out = (pass == 0) ? buf2 : buf3;
+					Salsa20 s(s2012TV0Key,s2012TV0Iv);
+					if (rounds == 12) {
+						s.crypt12(buf1,out,lens[l]);
+						s.crypt12(buf1 + lens[l],out + lens[l],lens[l] * 2);
+					} else {
+						s.crypt20(buf1,out,lens[l]);
+						s.crypt20(buf1 + lens[l],out + lens[l],lens[l] * 2);
+					}
+				}
+				if (memcmp(buf2,buf3,lens[l] * 3)) {
+					Salsa20::setKernel(s20DefaultKernel);
+					std::cout << "FAIL (Salsa20/" << rounds << ", " << lens[l] << " bytes)" << std::endl;
+					return -1;
+				}
+			}
+		}
+		s20.init(s2012TV0Key,s2012TV0Iv);
+		memset(buf1,0,1024);
+		s20.crypt12(buf1,buf2,1024);
+		Salsa20::setKernel(s20DefaultKernel);
+		if (memcmp(buf2,s2012TV0Ks,64)) {
+			std::cout << "FAIL (test vector 1)" << std::endl;
+			return -1;
+		}
+		std::cout << "PASS" << std::endl;
+	}
+	Salsa20::setKernel(s20DefaultKernel);
+
+	for(int k=(int)Salsa20::KERNEL_BASELINE;k<=(int)Salsa20::KERNEL_AVX512_X16;++k) {
+		if (!Salsa20::setKernel((Salsa20::Kernel)k))
+			continue;
+		std::cout << "[crypto] Benchmarking Salsa20/12 (" << s20KernelNames[k] << ")... "; std::cout.flush();
 		unsigned char *bb = (unsigned char *)::malloc(1234567);
 		for(unsigned int i=0;i<1234567;++i)
 			bb[i] = (unsigned char)i;
@@ -215,6 +340,7 @@ static int testCrypto()
 		std::cout << ((bytes / 1048576.0) / ((long double)(end - start) / 1024.0)) << " MiB/second (" << Utils::hex(buf1,16,hexbuf) << ')' << std::endl;
 		::free((void *)bb);
 	}
+	Salsa20::setKernel(s20DefaultKernel);
 
 #ifdef ZT_USE_X64_ASM_SALSA2012
 	std::cout << "[crypto] Benchmarking Salsa20/12 fast x64 ASM... "; std::cout.flush();
@@ -289,8 +415,42 @@ static int testCrypto()
 	}
 	std::cout << "PASS" << std::endl;
 
-	std::cout << "[crypto] Benchmarking Poly1305... "; std::cout.flush();
-	{
+	static const char *const p1305KernelNames[3] = { "scalar","AVX2 x4","AVX-512 x8" };
+	const Poly1305::Kernel p1305DefaultKernel = Poly1305::kernel();
+	std::cout << "[crypto] Poly1305 kernel: " << p1305KernelNames[p1305DefaultKernel] << std::endl;
+	for(int k=(int)Poly1305::KERNEL_AVX2_X4;k<=(int)Poly1305::KERNEL_AVX512_X8;++k) {
+		if (!Poly1305::kernelSupported((Poly1305::Kernel)k))
+			continue;
+		std::cout << "[crypto] Testing Poly1305 " << p1305KernelNames[k] << " kernel against scalar... "; std::cout.flush();
+		// All-ones data and keys push limbs to their maximums; random ones cover everything else
+		for(unsigned int i=0;i<256;++i) {
+			const unsigned int len = (i * 61) % 4099;
+			if (i < 8) {
+				memset(buf1,0xff,len);
+				memset(buf2,(i & 1) ? 0xff : 0x00,32);
+			} else {
+				Utils::getSecureRandom(buf1,len);
+				Utils::getSecureRandom(buf2,32);
+			}
+			uint64_t tags[2][2];
+			Poly1305::setKernel(Poly1305::KERNEL_SCALAR);
+			Poly1305::compute(tags[0],buf1,len,buf2);
+			Poly1305::setKernel((Poly1305::Kernel)k);
+			Poly1305::compute(tags[1],buf1,len,buf2);
+			if (memcmp(tags[0],tags[1],16)) {
+				Poly1305::setKernel(p1305DefaultKernel);
+				std::cout << "FAIL (" << len << " bytes)" << std::endl;
+				return -1;
+			}
+		}
+		Poly1305::setKernel(p1305DefaultKernel);
+		std::cout << "PASS" << std::endl;
+	}
+
+	for(int k=(int)Poly1305::KERNEL_SCALAR;k<=(int)Poly1305::KERNEL_AVX512_X8;++k) {
+		if (!Poly1305::setKernel((Poly1305::Kernel)k))
+			continue;
+		std::cout << "[crypto] Benchmarking Poly1305 (" << p1305KernelNames[k] << ")... "; std::cout.flush();
 		unsigned char *bb = (unsigned char *)::malloc(1234567);
 		for(unsigned int i=0;i<1234567;++i)
 			bb[i] = (unsigned char)i;
@@ -301,9 +461,92 @@ static int testCrypto()
 			bytes += 1234567.0;
 		}
 		uint64_t end = OSUtils::now();
-		std::cout << ((bytes / 1048576.0) / ((long double)(end - start) / 1000.0)) << " MiB/second" << std::endl;
+		std::cout << ((bytes / 1048576.0) / ((long double)(end - start) / 1000.0)) << " MiB/second (" << Utils::hex(buf1,16,hexbuf) << ')' << std::endl;
 		::free((void *)bb);
 	}
+	Poly1305::setKernel(p1305DefaultKernel);
+
+	static const char *const aesKernelNames[2] = { "software","AES-NI" };
+	const AES::Kernel aesDefaultKernel = AES::kernel();
+	std::cout << "[crypto] AES kernel: " << aesKernelNames[aesDefaultKernel] << std::endl;
+	for(int k=(int)AES::KERNEL_SOFTWARE;k<=(int)AES::KERNEL_AESNI;++k) {
+		if (!AES::setKernel((AES::Kernel)k))
+			continue;
+		std::cout << "[crypto] Testing AES-256 and AES-256-GCM-SIV (" << aesKernelNames[k] << ")... "; std::cout.flush();
+		AES aes(aesTV0Key);
+		aes.encrypt(aesTV0In,buf1);
+		if (memcmp(buf1,aesTV0Out,16)) {
+			AES::setKernel(aesDefaultKernel);
+			std::cout << "FAIL (AES-256 test vector)" << std::endl;
+			return -1;
+		}
+		AES gcmSiv(aesGcmSivTVKey);
+		gcmSiv.gcmSivEncrypt(aesGcmSivTVNonce,(const void *)0,0,(const void *)0,(void *)0,0,buf1);
+		gcmSiv.gcmSivEncrypt(aesGcmSivTVNonce,(const void *)0,0,aesGcmSivTV1In,buf2,8,buf3);
+		if ((memcmp(buf1,aesGcmSivTV0Tag,16))||(memcmp(buf2,aesGcmSivTV1Out,8))||(memcmp(buf3,aesGcmSivTV1Tag,16))) {
+			AES::setKernel(aesDefaultKernel);
+			std::cout << "FAIL (AES-256-GCM-SIV test vectors)" << std::endl;
+			return -1;
+		}
+		if ((!gcmSiv.gcmSivDecrypt(aesGcmSivTVNonce,(const void *)0,0,buf2,buf2,8,buf3))||(memcmp(buf2,aesGcmSivTV1In,8))) {
+			AES::setKernel(aesDefaultKernel);
+			std::cout << "FAIL (AES-256-GCM-SIV decrypt)" << std::endl;
+			return -1;
+		}
+		buf3[15] ^= 0x01;
+		if (gcmSiv.gcmSivDecrypt(aesGcmSivTVNonce,(const void *)0,0,aesGcmSivTV1Out,buf2,8,buf3)) {
+			AES::setKernel(aesDefaultKernel);
+			std::cout << "FAIL (AES-256-GCM-SIV accepted bad tag)" << std::endl;
+			return -1;
+		}
+		std::cout << "PASS" << std::endl;
+	}
+	AES::setKernel(aesDefaultKernel);
+
+	if (AES::kernelSupported(AES::KERNEL_AESNI)) {
+		std::cout << "[crypto] Testing AES-256-GCM-SIV AES-NI kernel against software... "; std::cout.flush();
+		for(unsigned int i=0;i<256;++i) {
+			const unsigned int len = (i * 37) % 1511;
+			const unsigned int aadLen = (i * 13) % 97;
+			uint8_t key[32],nonce[12],aad[97],tags[2][16];
+			Utils::getSecureRandom(key,sizeof(key));
+			Utils::getSecureRandom(nonce,sizeof(nonce));
+			Utils::getSecureRandom(aad,sizeof(aad));
+			Utils::getSecureRandom(buf1,len);
+			AES::setKernel(AES::KERNEL_SOFTWARE);
+			AES(key).gcmSivEncrypt(nonce,aad,aadLen,buf1,buf2,len,tags[0]);
+			AES::setKernel(AES::KERNEL_AESNI);
+			AES(key).gcmSivEncrypt(nonce,aad,aadLen,buf1,buf3,len,tags[1]);
+			if ((memcmp(buf2,buf3,len))||(memcmp(tags[0],tags[1],16))||(!AES(key).gcmSivDecrypt(nonce,aad,aadLen,buf3,buf3,len,tags[1]))||(memcmp(buf1,buf3,len))) {
+				AES::setKernel(aesDefaultKernel);
+				std::cout << "FAIL (" << len << " bytes, " << aadLen << " bytes AAD)" << std::endl;
+				return -1;
+			}
+		}
+		AES::setKernel(aesDefaultKernel);
+		std::cout << "PASS" << std::endl;
+	}
+
+	for(int k=(int)AES::KERNEL_SOFTWARE;k<=(int)AES::KERNEL_AESNI;++k) {
+		if (!AES::setKernel((AES::Kernel)k))
+			continue;
+		std::cout << "[crypto] Benchmarking AES-256-GCM-SIV (" << aesKernelNames[k] << ")... "; std::cout.flush();
+		unsigned char *bb = (unsigned char *)::malloc(1234567);
+		for(unsigned int i=0;i<1234567;++i)
+			bb[i] = (unsigned char)i;
+		AES aes(aesTV0Key);
+		const unsigned int iterations = (k == (int)AES::KERNEL_SOFTWARE) ? 10 : 200;
+		long double bytes = 0.0;
+		uint64_t start = OSUtils::now();
+		for(unsigned int i=0;i<iterations;++i) {
+			aes.gcmSivEncrypt(aesGcmSivTVNonce,(const void *)0,0,bb,bb,1234567,buf1);
+			bytes += 1234567.0;
+		}
+		uint64_t end = OSUtils::now();
+		std::cout << ((bytes / 1048576.0) / ((long double)(end - start) / 1000.0)) << " MiB/second (" << Utils::hex(buf1,16,hexbuf) << ')' << std::endl;
+		::free((void *)bb);
+	}
+	AES::setKernel(aesDefaultKernel);
 
 	/*
 	for(unsigned int d=8;d<=10;++d) {
@@ -345,6 +588,80 @@ static int testCrypto()
 			std::cout << "FAIL (4)" << std::endl;
 			return -1;
 		}
+		if ((!C25519::verify(p1.pub,buf1,64,C25519_TEST_VECTORS[k].agreementSignedBy1))||(!C25519::verify(p2.pub,buf1,64,C25519_TEST_VECTORS[k].agreementSignedBy2))) {
+			std::cout << "FAIL (5)" << std::endl;
+			return -1;
+		}
+		if (C25519::verify(p2.pub,buf1,64,C25519_TEST_VECTORS[k].agreementSignedBy1)) {
+			std::cout << "FAIL (6)" << std::endl;
+			return -1;
+		}
+	}
+	std::cout << "PASS" << std::endl;
+
+	std::cout << "[crypto] Cross-checking C25519 and Ed25519 against the 10-limb field code... "; std::cout.flush();
+	{
+		unsigned char rng[64],acc[64];
+		memset(rng,0,sizeof(rng));
+		memset(acc,0,sizeof(acc));
+		for(unsigned int i=0;i<ZT_C25519_CROSS_CHECK_ROUNDS;++i) {
+			C25519::Private priv;
+			if (i < 6) {
+				memcpy(priv.data,C25519_EDGE_SCALARS[i],32);
+				memcpy(priv.data + 32,C25519_EDGE_SCALARS[i],32);
+			} else {
+				c25519CrossCheckRandom(rng,priv.data,64);
+			}
+			const C25519::Pair p1(C25519::fromPrivate(priv));
+			c25519CrossCheckRandom(rng,priv.data,64);
+			const C25519::Pair p2(C25519::fromPrivate(priv));
+			c25519CrossCheckFold(acc,p1.pub.data,64);
+
+			C25519::agree(p1,p2.pub,buf1,64);
+			C25519::agree(p2,p1.pub,buf2,64);
+			if (memcmp(buf1,buf2,64)) {
+				std::cout << "FAIL (1)" << std::endl;
+				return -1;
+			}
+			c25519CrossCheckFold(acc,buf1,64);
+
+			// Agreement with an edge or unreduced u-coordinate
+			C25519::Public odd(p2.pub);
+			if ((i & 1) == 0) {
+				memcpy(odd.data,C25519_EDGE_U[(i >> 1) % 8],32);
+			} else {
+				c25519CrossCheckRandom(rng,odd.data,32);
+				odd.data[31] |= 0x80;
+			}
+			C25519::agree(p1,odd,buf1,64);
+			c25519CrossCheckFold(acc,buf1,64);
+
+			c25519CrossCheckRandom(rng,buf2,64);
+			C25519::Signature sig(C25519::sign(p1,buf2,64));
+			if (!C25519::verify(p1.pub,buf2,64,sig)) {
+				std::cout << "FAIL (2)" << std::endl;
+				return -1;
+			}
+			c25519CrossCheckFold(acc,sig.data,ZT_C25519_SIGNATURE_LEN);
+
+			// Verification against an unreduced or invalid public point, and with S + L in place of S
+			unsigned char results[2];
+			odd = p1.pub;
+			memcpy(odd.data + 32,C25519_EDGE_ED[i % 5],32);
+			results[0] = C25519::verify(odd,buf2,64,sig) ? 1 : 0;
+			unsigned int carry = 0;
+			for(unsigned int k=0;k<32;++k) {
+				carry += (unsigned int)sig.data[32 + k] + (unsigned int)C25519_EDGE_SCALARS[3][k];
+				sig.data[32 + k] = (uint8_t)carry;
+				carry >>= 8;
+			}
+			results[1] = C25519::verify(p1.pub,buf2,64,sig) ? 1 : 0;
+			c25519CrossCheckFold(acc,results,2);
+		}
+		if (memcmp(acc,C25519_CROSS_CHECK_DIGEST,64)) {
+			std::cout << "FAIL (3, got " << Utils::hex(acc,64,hexbuf) << ")" << std::endl;
+			return -1;
+		}
 	}
 	std::cout << "PASS" << std::endl;
 
@@ -377,11 +694,11 @@ static int testCrypto()
 	for(int k=0;k<8;++k)
 		bp[k] = C25519::generate();
 	uint64_t st = OSUtils::now();
-	for(unsigned int k=0;k<50;++k) {
+	for(unsigned int k=0;k<2000;++k) {
 		C25519::agree(bp[~k & 7],bp[k & 7].pub,buf1,64);
 	}
 	uint64_t et = OSUtils::now();
-	std::cout << ((double)(et - st) / 50.0) << "ms per agreement." << std::endl;
+	std::cout << (2000.0 / ((double)(et - st) / 1000.0)) << " agreements/second" << std::endl;
 
 	std::cout << "[crypto] Testing Ed25519 ECC signatures... "; std::cout.flush();
 	C25519::Pair didntSign = C25519::generate();
@@ -420,13 +737,25 @@ static int testCrypto()
 	std::cout << "PASS" << std::endl;
 
 	std::cout << "[crypto] Benchmarking Ed25519 ECC signatures... "; std::cout.flush();
+	C25519::Signature bsig;
 	st = OSUtils::now();
-	for(int k=0;k<1000;++k) {
-		C25519::Signature sig;
-		C25519::sign(didntSign.priv,didntSign.pub,buf1,sizeof(buf1),sig.data);
+	for(int k=0;k<2000;++k) {
+		C25519::sign(didntSign.priv,didntSign.pub,buf1,64,bsig.data);
+	}
+	et = OSUtils::now();
+	std::cout << (2000.0 / ((double)(et - st) / 1000.0)) << " signatures/second, "; std::cout.flush();
+	unsigned int bverified = 0;
+	st = OSUtils::now();
+	for(int k=0;k<2000;++k) {
+		if (C25519::verify(didntSign.pub,buf1,64,bsig))
+			++bverified;
 	}
 	et = OSUtils::now();
-	std::cout << ((double)(et - st) / 50.0) << "ms per signature." << std::endl;
+	if (bverified != 2000) {
+		std::cout << "FAIL (verify)" << std::endl;
+		return -1;
+	}
+	std::cout << (2000.0 / ((double)(et - st) / 1000.0)) << " verifications/second" << std::endl;
 
 	return 0;
 }
@@ -636,10 +965,319 @@ static int testPacket()
 		return -1;
 	}
 
+	{
+		PacketPool::Ptr p1(PacketPool::get(a));
+		PacketPool::Ptr p2(std::move(p1));
+		if ((p1)||(!p2)||(*p2 != a)) {
+			std::cout << "FAIL (packet pool)" << std::endl;
+			return -1;
+		}
+	}
+
+	a.armor(salsaKey,true);
+	b = a;
+	for(unsigned int fno=1,fragStart=400;fragStart<a.size();++fno,fragStart+=400) {
+		const unsigned int fragLen = std::min(a.size() - fragStart,400U);
+		Packet::Fragment frag(b,fragStart,fragLen,fno,4);
+		if (memcmp(a.fragmentInPlace(fragStart,fragLen,fno,4),frag.data(),frag.size()) != 0) {
+			std::cout << "FAIL (in-place fragment)" << std::endl;
+			return -1;
+		}
+	}
+
 	std::cout << "PASS" << std::endl;
+
+	// Every Salsa20 kernel (the baseline one selects the two-pass ASM path where
+	// there is one) must put the same bytes on the wire, and each must accept
+	// what the others produce.
+	static const char *const s20KernelNames[4] = { "baseline","SSE2 x4","AVX2 x8","AVX-512 x16" };
+	const Salsa20::Kernel s20DefaultKernel = Salsa20::kernel();
+	std::cout << "[packet] Testing armor/dearmor across Salsa20 kernels... "; std::cout.flush();
+	for(unsigned int len=0;len<=ZT_DEFAULT_MTU;len+=((len < 300) ? 1 : 97)) {
+		for(int encrypt=0;encrypt<2;++encrypt) {
+			Packet ref;
+			for(int k=(int)Salsa20::KERNEL_BASELINE;k<=(int)Salsa20::KERNEL_AVX512_X16;++k) {
+				if (!Salsa20::setKernel((Salsa20::Kernel)k))
+					continue;
+				a.reset(Address(0x1234567890ULL),Address(0x0987654321ULL),Packet::VERB_FRAME);
+				for(unsigned int i=0;i<len;++i)
+					a.append((uint8_t)(i * 7));
+				b = a;
+				a.setAt<uint64_t>(ZT_PACKET_IDX_IV,0x0123456789abcdefULL);
+				a.armor(salsaKey,encrypt != 0);
+				if (k == (int)Salsa20::KERNEL_BASELINE) {
+					ref = a;
+				} else if (a != ref) {
+					Salsa20::setKernel(s20DefaultKernel);
+					std::cout << "FAIL (" << s20KernelNames[k] << " output differs, " << len << " bytes)" << std::endl;
+					return -1;
+				}
+				a = ref;
+				b.setAt<uint64_t>(ZT_PACKET_IDX_IV,0x0123456789abcdefULL);
+				if ((!a.dearmor(salsaKey))||(memcmp((const uint8_t *)a.data() + ZT_PACKET_IDX_VERB,(const uint8_t *)b.data() + ZT_PACKET_IDX_VERB,a.size() - ZT_PACKET_IDX_VERB) != 0)) {
+					Salsa20::setKernel(s20DefaultKernel);
+					std::cout << "FAIL (" << s20KernelNames[k] << " dearmor, " << len << " bytes)" << std::endl;
+					return -1;
+				}
+				a = ref;
+				a[ZT_PACKET_IDX_VERB + (len / 2)] ^= 0x01;
+				b = a;
+				if (a.dearmor(salsaKey)) {
+					Salsa20::setKernel(s20DefaultKernel);
+					std::cout << "FAIL (" << s20KernelNames[k] << " accepted bad MAC, " << len << " bytes)" << std::endl;
+					return -1;
+				}
+				if (a != b) {
+					Salsa20::setKernel(s20DefaultKernel);
+					std::cout << "FAIL (" << s20KernelNames[k] << " decrypted despite bad MAC, " << len << " bytes)" << std::endl;
+					return -1;
+				}
+			}
+		}
+	}
+	Salsa20::setKernel(s20DefaultKernel);
+	std::cout << "PASS" << std::endl;
+
+	// Batched armor must match armor() packet for packet
+	std::cout << "[packet] Testing armorBatch... "; std::cout.flush();
+	{
+		const unsigned int count = 41;
+		std::vector<Packet> pa(count),pb(count),plain(count);
+		std::vector<Packet *> pbp(count);
+		uint8_t keys[count][32];
+		std::vector<const void *> kp(count);
+		bool enc[count];
+		for(int k=(int)Salsa20::KERNEL_BASELINE;k<=(int)Salsa20::KERNEL_AVX512_X16;++k) {
+			if (!Salsa20::setKernel((Salsa20::Kernel)k))
+				continue;
+			for(unsigned int p=0;p<count;++p) {
+				const unsigned int len = (p * p * 3) % (ZT_DEFAULT_MTU + 1);
+				plain[p].reset(Address(0x1234567890ULL + p),Address(0x0987654321ULL),Packet::VERB_FRAME);
+				for(unsigned int i=0;i<len;++i)
+					plain[p].append((uint8_t)(i + p));
+				plain[p].setAt<uint64_t>(ZT_PACKET_IDX_IV,0x0123456789abcdefULL * (p + 1));
+				for(unsigned int i=0;i<32;++i)
+					keys[p][i] = (uint8_t)(salsaKey[i] + p);
+				kp[p] = keys[p];
+				enc[p] = (p % 5) != 3;
+				pa[p] = plain[p];
+				pa[p].armor(keys[p],enc[p]);
+				pb[p] = plain[p];
+				pbp[p] = &(pb[p]);
+			}
+			Packet::armorBatch(pbp.data(),kp.data(),enc,count);
+			for(unsigned int p=0;p<count;++p) {
+				if (pa[p] != pb[p]) {
+					Salsa20::setKernel(s20DefaultKernel);
+					std::cout << "FAIL (" << s20KernelNames[k] << " armorBatch output differs, packet " << p << ")" << std::endl;
+					return -1;
+				}
+			}
+		}
+		Salsa20::setKernel(s20DefaultKernel);
+	}
+	std::cout << "PASS" << std::endl;
+
+	std::cout << "[packet] Testing armor/dearmor with AES-GCM-SIV... "; std::cout.flush();
+	{
+		const AES aes(salsaKey);
+		for(unsigned int len=0;len<=ZT_DEFAULT_MTU;len+=((len < 100) ? 1 : 61)) {
+			a.reset(Address(0x1234567890ULL),Address(0x0987654321ULL),Packet::VERB_FRAME);
+			for(unsigned int i=0;i<len;++i)
+				a.append((uint8_t)(i * 11));
+			b = a;
+			if (a.armoredSize(true,&aes) != (b.size() + ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH)) {
+				std::cout << "FAIL (armoredSize, " << len << " bytes)" << std::endl;
+				return -1;
+			}
+			a.armor(salsaKey,true,&aes);
+			if ((a.cipher() != ZT_PROTO_CIPHER_SUITE__C25519_AES_GCM_SIV)||(a.size() != (b.size() + ZT_PROTO_AES_GCM_SIV_TRAILER_LENGTH))) {
+				std::cout << "FAIL (armor, " << len << " bytes)" << std::endl;
+				return -1;
+			}
+			Packet c(a);
+			if (c.dearmor(salsaKey)) {
+				std::cout << "FAIL (accepted without AES key, " << len << " bytes)" << std::endl;
+				return -1;
+			}
+			c = a;
+			c[ZT_PACKET_IDX_DEST] ^= 0x01;
+			if (c.dearmor(salsaKey,&aes)) {
+				std::cout << "FAIL (accepted modified header, " << len << " bytes)" << std::endl;
+				return -1;
+			}
+			c = a;
+			c[ZT_PACKET_IDX_VERB + (len / 2)] ^= 0x01;
+			if (c.dearmor(salsaKey,&aes)) {
+				std::cout << "FAIL (accepted modified payload, " << len << " bytes)" << std::endl;
+				return -1;
+			}
+			if ((!a.dearmor(salsaKey,&aes))||(a.size() != b.size())||(memcmp((const uint8_t *)a.data() + ZT_PACKET_IDX_VERB,(const uint8_t *)b.data() + ZT_PACKET_IDX_VERB,a.size() - ZT_PACKET_IDX_VERB) != 0)) {
+				std::cout << "FAIL (dearmor, " << len << " bytes)" << std::endl;
+				return -1;
+			}
+		}
+
+		// MAC-only packets and packets with no room for the trailer stay on Salsa20/Poly1305
+		a.reset(Address(0x1234567890ULL),Address(0x0987654321ULL),Packet::VERB_FRAME);
+		a.setSize(ZT_PACKET_IDX_PAYLOAD + 100);
+		a.armor(salsaKey,false,&aes);
+		if ((a.cipher() != ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_NONE)||(!a.dearmor(salsaKey,&aes))) {
+			std::cout << "FAIL (MAC-only packet)" << std::endl;
+			return -1;
+		}
+		a.setSize(ZT_PROTO_MAX_PACKET_LENGTH);
+		a.armor(salsaKey,true,&aes);
+		if ((a.cipher() != ZT_PROTO_CIPHER_SUITE__C25519_POLY1305_SALSA2012)||(!a.dearmor(salsaKey,&aes))) {
+			std::cout << "FAIL (maximum size packet)" << std::endl;
+			return -1;
+		}
+	}
+	std::cout << "PASS" << std::endl;
+
+	std::cout << "[packet] Testing fragment reassembly bookkeeping... "; std::cout.flush();
+	{
+		Switch::RXQueueEntry *const rq = new Switch::RXQueueEntry();
+		uint8_t fp[3][64];
+		for(unsigned int i=0;i<3;++i)
+			memset(fp[i],(int)(i + 1),sizeof(fp[i]));
+
+		// Fragment 5 of a packet claiming 2 in total must not make the head look complete
+		rq->reset(0,1,0);
+		if ((rq->addFragment(5,2,fp[0],64))||(rq->haveFragments != 0)||(rq->addHead())) {
+			std::cout << "FAIL (fragment number beyond its own total)" << std::endl;
+			return -1;
+		}
+		if ((rq->addFragment(0,2,fp[0],64))||(rq->addFragment(1,1,fp[0],64))||(rq->addFragment(1,ZT_MAX_PACKET_FRAGMENTS + 1,fp[0],64))||(rq->haveFragments != 1)) {
+			std::cout << "FAIL (fragment number or total out of range)" << std::endl;
+			return -1;
+		}
+
+		// Fragments must agree on the total, and duplicates are ignored
+		rq->reset(0,2,0);
+		if ((rq->addFragment(1,3,fp[0],64))||(rq->totalFragments != 3)) {
+			std::cout << "FAIL (first fragment)" << std::endl;
+			return -1;
+		}
+		if ((rq->addFragment(2,2,fp[1],64))||(rq->addFragment(3,4,fp[1],64))||(rq->addFragment(1,3,fp[2],64))||(rq->haveFragments != 2)||(rq->fragDataSize != 64)) {
+			std::cout << "FAIL (inconsistent total or duplicate accepted)" << std::endl;
+			return -1;
+		}
+		if ((rq->addHead())||(!rq->addFragment(2,3,fp[1],64))) {
+			std::cout << "FAIL (completion)" << std::endl;
+			return -1;
+		}
+		if ((rq->fragStart[0] != 0)||(rq->fragLen[0] != 64)||(rq->fragStart[1] != 64)||(rq->fragLen[1] != 64)||(memcmp(rq->fragData,fp[0],64))||(memcmp(rq->fragData + 64,fp[1],64))) {
+			std::cout << "FAIL (fragment layout)" << std::endl;
+			return -1;
+		}
+
+		// A reused entry starts with no fragment offsets left over from its last packet
+		rq->reset(0,3,0);
+		for(unsigned int i=0;i<(ZT_MAX_PACKET_FRAGMENTS - 1);++i) {
+			if ((rq->fragStart[i] != 0)||(rq->fragLen[i] != 0)) {
+				std::cout << "FAIL (reset)" << std::endl;
+				return -1;
+			}
+		}
+
+		delete rq;
+	}
+	std::cout << "PASS" << std::endl;
+
+	{
+		std::cout << "[packet] Benchmarking armor of 16 128-byte payloads, one at a time vs. batched... "; std::cout.flush();
+		Packet small[ZT_PACKET_ARMOR_BATCH_MAX];
+		Packet *sp[ZT_PACKET_ARMOR_BATCH_MAX];
+		const void *sk[ZT_PACKET_ARMOR_BATCH_MAX];
+		bool se[ZT_PACKET_ARMOR_BATCH_MAX];
+		for(unsigned int p=0;p<ZT_PACKET_ARMOR_BATCH_MAX;++p) {
+			small[p].reset(Address(0x1234567890ULL),Address(0x0987654321ULL),Packet::VERB_FRAME);
+			small[p].setSize(ZT_PACKET_IDX_PAYLOAD + 128);
+			sp[p] = &(small[p]);
+			sk[p] = salsaKey;
+			se[p] = true;
+		}
+		uint64_t start = OSUtils::now();
+		for(unsigned int i=0;i<100000;++i) {
+			for(unsigned int p=0;p<ZT_PACKET_ARMOR_BATCH_MAX;++p)
+				small[p].armor(salsaKey,true);
+		}
+		uint64_t end = OSUtils::now();
+		std::cout << ((long double)(ZT_PACKET_ARMOR_BATCH_MAX * 100000) / ((long double)(end - start) / 1000.0)) << " vs. "; std::cout.flush();
+		start = OSUtils::now();
+		for(unsigned int i=0;i<100000;++i)
+			Packet::armorBatch(sp,sk,se,ZT_PACKET_ARMOR_BATCH_MAX);
+		end = OSUtils::now();
+		std::cout << ((long double)(ZT_PACKET_ARMOR_BATCH_MAX * 100000) / ((long double)(end - start) / 1000.0)) << " packets/second" << std::endl;
+	}
+
+	for(int k=(int)Salsa20::KERNEL_BASELINE;k<=(int)Salsa20::KERNEL_AVX512_X16;++k) {
+		if (!Salsa20::setKernel((Salsa20::Kernel)k))
+			continue;
+		std::cout << "[packet] Benchmarking armor+dearmor of " << ZT_DEFAULT_MTU << "-byte payloads (" << s20KernelNames[k] << ")... "; std::cout.flush();
+		a.reset(Address(0x1234567890ULL),Address(0x0987654321ULL),Packet::VERB_FRAME);
+		a.setSize(ZT_PACKET_IDX_PAYLOAD + ZT_DEFAULT_MTU);
+		long double bytes = 0.0;
+		unsigned int bad = 0;
+		const uint64_t start = OSUtils::now();
+		for(unsigned int i=0;i<200000;++i) {
+			a.armor(salsaKey,true);
+			if (!a.dearmor(salsaKey))
+				++bad;
+			bytes += (long double)a.size();
+		}
+		const uint64_t end = OSUtils::now();
+		if (bad) {
+			Salsa20::setKernel(s20DefaultKernel);
+			std::cout << "FAIL (" << bad << " MAC failures)" << std::endl;
+			return -1;
+		}
+		std::cout << ((bytes / 1048576.0) / ((long double)(end - start) / 1000.0)) << " MiB/second" << std::endl;
+	}
+	Salsa20::setKernel(s20DefaultKernel);
+
+	if (AES::kernel() != AES::KERNEL_SOFTWARE) {
+		std::cout << "[packet] Benchmarking armor+dearmor of " << ZT_DEFAULT_MTU << "-byte payloads (AES-GCM-SIV)... "; std::cout.flush();
+		const AES aes(salsaKey);
+		a.reset(Address(0x1234567890ULL),Address(0x0987654321ULL),Packet::VERB_FRAME);
+		a.setSize(ZT_PACKET_IDX_PAYLOAD + ZT_DEFAULT_MTU);
+		long double bytes = 0.0;
+		unsigned int bad = 0;
+		const uint64_t start = OSUtils::now();
+		for(unsigned int i=0;i<200000;++i) {
+			a.armor(salsaKey,true,&aes);
+			if (!a.dearmor(salsaKey,&aes))
+				++bad;
+			bytes += (long double)a.size();
+		}
+		const uint64_t end = OSUtils::now();
+		if (bad) {
+			std::cout << "FAIL (" << bad << " MAC failures)" << std::endl;
+			return -1;
+		}
+		std::cout << ((bytes / 1048576.0) / ((long double)(end - start) / 1000.0)) << " MiB/second" << std::endl;
+	}
+
 	return 0;
 }
 
+// Allocator that tracks how much memory STL containers request, for comparison with Hashtable::memoryUsage()
+static unsigned long htBenchAllocated = 0;
+template<typename T>
+struct HTBenchAllocator
+{
+	typedef T value_type;
+	HTBenchAllocator() {}
+	template<typename U> HTBenchAllocator(const HTBenchAllocator<U> &) {}
+	inline T *allocate(std::size_t n) { htBenchAllocated += (unsigned long)(n * sizeof(T)); return reinterpret_cast<T *>(::malloc(n * sizeof(T))); }
+	inline void deallocate(T *p,std::size_t n) { htBenchAllocated -= (unsigned long)(n * sizeof(T)); ::free(p); }
+};
+template<typename T,typename U>
+static inline bool operator==(const HTBenchAllocator<T> &,const HTBenchAllocator<U> &) { return true; }
+template<typename T,typename U>
+static inline bool operator!=(const HTBenchAllocator<T> &,const HTBenchAllocator<U> &) { return false; }
+
 static int testOther()
 {
 	char buf[1024];
@@ -669,7 +1307,6 @@ static int testOther()
 	std::cout << " " << InetAddress("").toString(buf);
 	std::cout << std::endl;
 
-#if 0
 	std::cout << "[other] Testing Hashtable... "; std::cout.flush();
 	{
 		Hashtable<uint64_t,std::string> ht;
@@ -833,7 +1470,50 @@ static int testOther()
 		}
 	}
 	std::cout << "PASS" << std::endl;
-#endif
+
+	for(unsigned long n=1000;n<=1000000;n*=100) {
+		std::vector<uint64_t> keys;
+		for(unsigned long i=0;i<n;++i)
+			keys.push_back(((uint64_t)rand() << 32) ^ (uint64_t)rand() ^ ((uint64_t)i << 48));
+		uint64_t junk = 0;
+
+		std::cout << "[other] Benchmarking Hashtable with " << n << " entries... "; std::cout.flush();
+		{
+			Hashtable<uint64_t,uint64_t> ht;
+			for(unsigned long i=0;i<n;++i)
+				ht.set(keys[i],i);
+			const int64_t start = OSUtils::now();
+			for(unsigned int r=0;r<(20000000 / n);++r) {
+				for(unsigned long i=0;i<n;++i) {
+					const uint64_t *v = ht.get(keys[(i * 7919) % n]);
+					junk += (v) ? *v : 0;
+					v = ht.get(keys[i] + 1); // almost certainly a miss
+					junk += (v) ? *v : 0;
+				}
+			}
+			const int64_t end = OSUtils::now();
+			std::cout << (unsigned long)((double)(2 * (20000000 / n) * n) / ((double)(end - start) / 1000.0)) << " lookups/second, " << ((double)ht.memoryUsage() / (double)n) << " bytes/entry" << std::endl;
+		}
+
+		std::cout << "[other] Benchmarking std::unordered_map (node-based, like the previous Hashtable) with " << n << " entries... "; std::cout.flush();
+		{
+			htBenchAllocated = 0;
+			std::unordered_map< uint64_t,uint64_t,std::hash<uint64_t>,std::equal_to<uint64_t>,HTBenchAllocator< std::pair<const uint64_t,uint64_t> > > um;
+			for(unsigned long i=0;i<n;++i)
+				um[keys[i]] = i;
+			const int64_t start = OSUtils::now();
+			for(unsigned int r=0;r<(20000000 / n);++r) {
+				for(unsigned long i=0;i<n;++i) {
+					std::unordered_map< uint64_t,uint64_t,std::hash<uint64_t>,std::equal_to<uint64_t>,HTBenchAllocator< std::pair<const uint64_t,uint64_t> > >::const_iterator v(um.find(keys[(i * 7919) % n]));
+					junk += (v != um.end()) ? v->second : 0;
+					v = um.find(keys[i] + 1);
+					junk += (v != um.end()) ? v->second : 0;
+				}
+			}
+			const int64_t end = OSUtils::now();
+			std::cout << (unsigned long)((double)(2 * (20000000 / n) * n) / ((double)(end - start) / 1000.0)) << " lookups/second, " << ((double)htBenchAllocated / (double)n) << " bytes/entry (" << junk << ")" << std::endl;
+		}
+	}
 
 	std::cout << "[other] Testing/fuzzing Dictionary... "; std::cout.flush();
 	for(int k=0;k<1000;++k) {
@@ -890,6 +1570,265 @@ static int testOther()
 	return 0;
 }
 
+// Reference counted object for concurrent table tests; counts live instances to catch leaks and double frees
+static std::atomic<long> chtLiveObjects(0);
+class CHTTestObject
+{
+	friend class SharedPtr<CHTTestObject>;
+public:
+	CHTTestObject(uint64_t k) : k(k) { ++chtLiveObjects; }
+	~CHTTestObject() { --chtLiveObjects; }
+	const uint64_t k;
+private:
+	AtomicCounter __refCount;
+};
+
+#define ZT_TEST_CHT_KEYS 10000
+#define ZT_TEST_CHT_BENCH_MS 300
+
+// How chtReader() looks things up
+#define ZT_TEST_CHT_MODE_SHARED 0   // ConcurrentHashtable, copy out a SharedPtr
+#define ZT_TEST_CHT_MODE_LOCKED 1   // Mutex + Hashtable, copy out a SharedPtr
+#define ZT_TEST_CHT_MODE_BORROWED 2 // ConcurrentHashtable under an epoch guard, BorrowedPtr only
+
+struct CHTTestState
+{
+	CHTTestState() : cht(epoch),stop(false),hotKey(0),lookups(0),errors(0) {}
+	Epoch epoch;
+	ConcurrentHashtable< uint64_t,SharedPtr<CHTTestObject> > cht;
+	Hashtable< uint64_t,SharedPtr<CHTTestObject> > ht;
+	Mutex ht_m;
+	std::atomic<bool> stop;
+	uint64_t hotKey; // if non-zero every reader looks up only this key
+	std::atomic<unsigned long> lookups;
+	std::atomic<unsigned long> errors;
+};
+
+static void chtReader(CHTTestState *st,int mode,unsigned int seed)
+{
+	unsigned long n = 0,e = 0;
+	uint64_t k = seed;
+	while (!st->stop.load()) {
+		for(unsigned int i=0;i<1024;++i) {
+			k = (k * 6364136223846793005ULL) + 1442695040888963407ULL;
+			const uint64_t key = (st->hotKey) ? st->hotKey : ((k >> 33) % ZT_TEST_CHT_KEYS) + 1;
+			if (mode == ZT_TEST_CHT_MODE_BORROWED) {
+				const Epoch::Guard _g(st->epoch);
+				const SharedPtr<CHTTestObject> *const ap = st->cht.get(key);
+				const BorrowedPtr<CHTTestObject> p((ap) ? BorrowedPtr<CHTTestObject>(*ap) : BorrowedPtr<CHTTestObject>());
+				if ((p)&&(p->k != key))
+					++e;
+			} else {
+				SharedPtr<CHTTestObject> p;
+				if (mode == ZT_TEST_CHT_MODE_LOCKED) {
+					Mutex::Lock _l(st->ht_m);
+					st->ht.get(key,p);
+				} else {
+					st->cht.get(key,p);
+				}
+				if ((p)&&(p->k != key))
+					++e;
+			}
+		}
+		n += 1024;
+	}
+	st->lookups += n;
+	st->errors += e;
+}
+
+struct EpochTestState
+{
+	EpochTestState() : entered(0),stop(false) {}
+	Epoch epoch;
+	std::atomic<unsigned int> entered;
+	std::atomic<bool> stop;
+};
+
+static void epochReader(EpochTestState *st)
+{
+	const Epoch::Guard _g(st->epoch);
+	++st->entered;
+	while (!st->stop.load())
+		std::this_thread::yield();
+}
+
+static int testConcurrency()
+{
+	std::cout << "[concurrency] Testing ConcurrentHashtable against std::map... "; std::cout.flush();
+	{
+		Epoch epoch;
+		ConcurrentHashtable<uint64_t,uint64_t> cht(epoch);
+		std::map<uint64_t,uint64_t> ref;
+		for(unsigned int i=0;i<250000;++i) {
+			const uint64_t k = (uint64_t)(rand() % 20000) + 1;
+			const uint64_t v = (uint64_t)rand();
+			switch(rand() % 4) {
+				case 0:
+					cht.set(k,v);
+					ref[k] = v;
+					break;
+				case 1:
+					if (cht.setIfAbsent(k,v) != ref.insert(std::pair<uint64_t,uint64_t>(k,v)).first->second) {
+						std::cout << "FAIL (setIfAbsent)" << std::endl;
+						return -1;
+					}
+					break;
+				case 2:
+					if (cht.erase(k) != (ref.erase(k) != 0)) {
+						std::cout << "FAIL (erase)" << std::endl;
+						return -1;
+					}
+					break;
+				default: {
+					uint64_t cv = 0;
+					const bool found = cht.get(k,cv);
+					std::map<uint64_t,uint64_t>::const_iterator r(ref.find(k));
+					if ((found != (r != ref.end()))||((found)&&(cv != r->second))) {
+						std::cout << "FAIL (get)" << std::endl;
+						return -1;
+					}
+				}	break;
+			}
+		}
+		const std::vector< std::pair<uint64_t,uint64_t> > ent(cht.entries());
+		if ((cht.size() != ref.size())||(ent.size() != ref.size())) {
+			std::cout << "FAIL (size " << cht.size() << " != " << ref.size() << ")" << std::endl;
+			return -1;
+		}
+		for(std::vector< std::pair<uint64_t,uint64_t> >::const_iterator e(ent.begin());e!=ent.end();++e) {
+			if (ref[e->first] != e->second) {
+				std::cout << "FAIL (entries)" << std::endl;
+				return -1;
+			}
+		}
+	}
+	std::cout << "PASS" << std::endl;
+
+	std::cout << "[concurrency] Testing SharedPtr moves and BorrowedPtr... "; std::cout.flush();
+	{
+		SharedPtr<CHTTestObject> a(new CHTTestObject(1));
+		SharedPtr<CHTTestObject> b(std::move(a));
+		const BorrowedPtr<CHTTestObject> bp(b);
+		if ((a)||(!b)||(b.references() != 1)||(bp != b)||(bp->k != 1)) {
+			std::cout << "FAIL (move construct)" << std::endl;
+			return -1;
+		}
+		SharedPtr<CHTTestObject> c(bp.promote());
+		if ((c.references() != 2)||(c != b)) {
+			std::cout << "FAIL (promote)" << std::endl;
+			return -1;
+		}
+		c = SharedPtr<CHTTestObject>(new CHTTestObject(2));
+		b = std::move(c);
+		if ((c)||(b->k != 2)||(b.references() != 1)||(chtLiveObjects.load() != 1)) {
+			std::cout << "FAIL (move assign)" << std::endl;
+			return -1;
+		}
+	}
+	if (chtLiveObjects.load() != 0) {
+		std::cout << "FAIL (" << chtLiveObjects.load() << " objects leaked)" << std::endl;
+		return -1;
+	}
+	std::cout << "PASS" << std::endl;
+
+	std::cout << "[concurrency] Testing Epoch with more readers than slots... "; std::cout.flush();
+	{
+		EpochTestState st;
+		std::vector<std::thread> readers;
+		for(unsigned int t=0;t<(ZT_EPOCH_READER_SLOTS + 8);++t)
+			readers.push_back(std::thread(epochReader,&st));
+		while (st.entered.load() < (ZT_EPOCH_READER_SLOTS + 8))
+			std::this_thread::yield();
+		st.epoch.retire(new CHTTestObject(1));
+		st.epoch.reclaim();
+		const unsigned long held = st.epoch.pending();
+		st.stop = true;
+		for(std::vector<std::thread>::iterator t(readers.begin());t!=readers.end();++t)
+			t->join();
+		st.epoch.reclaim();
+		if ((held != 1)||(st.epoch.pending() != 0)||(chtLiveObjects.load() != 0)) {
+			std::cout << "FAIL (held " << held << ", pending " << st.epoch.pending() << ")" << std::endl;
+			return -1;
+		}
+	}
+	std::cout << "PASS" << std::endl;
+
+	unsigned int maxThreads = std::thread::hardware_concurrency();
+	if (maxThreads < 2)
+		maxThreads = 2;
+	else if (maxThreads > 16)
+		maxThreads = 16;
+
+	std::cout << "[concurrency] Testing ConcurrentHashtable with concurrent readers and writer... "; std::cout.flush();
+	{
+		CHTTestState st;
+		for(uint64_t k=1;k<=ZT_TEST_CHT_KEYS;++k)
+			st.cht.set(k,SharedPtr<CHTTestObject>(new CHTTestObject(k)));
+		std::vector<std::thread> readers;
+		for(unsigned int t=0;t<maxThreads;++t)
+			readers.push_back(std::thread(chtReader,&st,(t & 1) ? ZT_TEST_CHT_MODE_BORROWED : ZT_TEST_CHT_MODE_SHARED,(unsigned int)rand()));
+		unsigned long writes = 0;
+		const int64_t end = OSUtils::now() + ZT_TEST_CHT_BENCH_MS;
+		while (OSUtils::now() < end) {
+			// Churn keys and grow and shrink the table so readers race with erases and rehashes
+			for(uint64_t k=1;k<=ZT_TEST_CHT_KEYS;k+=3)
+				st.cht.erase(k);
+			for(uint64_t k=ZT_TEST_CHT_KEYS+1;k<=(ZT_TEST_CHT_KEYS*3);++k)
+				st.cht.set(k,SharedPtr<CHTTestObject>(new CHTTestObject(k)));
+			for(uint64_t k=ZT_TEST_CHT_KEYS+1;k<=(ZT_TEST_CHT_KEYS*3);++k)
+				st.cht.erase(k);
+			for(uint64_t k=1;k<=ZT_TEST_CHT_KEYS;k+=3)
+				st.cht.set(k,SharedPtr<CHTTestObject>(new CHTTestObject(k)));
+			writes += (ZT_TEST_CHT_KEYS * 4) + (ZT_TEST_CHT_KEYS / 3) * 2;
+		}
+		st.stop = true;
+		for(std::vector<std::thread>::iterator t(readers.begin());t!=readers.end();++t)
+			t->join();
+		if ((st.errors.load())||(st.cht.size() != ZT_TEST_CHT_KEYS)) {
+			std::cout << "FAIL (" << st.errors.load() << " bad lookups, " << st.cht.size() << " entries)" << std::endl;
+			return -1;
+		}
+		std::cout << st.lookups.load() << " lookups during " << writes << " writes, " << st.epoch.pending() << " objects awaiting reclamation... ";
+	}
+	if (chtLiveObjects.load() != 0) {
+		std::cout << "FAIL (" << chtLiveObjects.load() << " objects leaked)" << std::endl;
+		return -1;
+	}
+	std::cout << "PASS" << std::endl;
+
+	// SharedPtr modes do the same lookup as Topology::getPeer(tPtr,zta), borrowed mode the
+	// same as the guarded overload used by Switch. The hot key runs have every thread hitting
+	// one peer, so the reference count's cache line bounces between cores unless borrowed.
+	static const char *const modeNames[3] = { "ConcurrentHashtable + SharedPtr","Mutex + Hashtable + SharedPtr","ConcurrentHashtable + BorrowedPtr" };
+	for(unsigned int bench=0;bench<6;++bench) {
+		const int mode = (int)(bench % 3);
+		const bool hot = (bench >= 3);
+		std::cout << "[concurrency] Benchmarking peer lookups (" << modeNames[mode] << ((hot) ? ", one hot key" : "") << "):";
+		for(unsigned int threads=1;threads<=maxThreads;threads*=2) {
+			CHTTestState st;
+			if (hot)
+				st.hotKey = ZT_TEST_CHT_KEYS / 2;
+			for(uint64_t k=1;k<=ZT_TEST_CHT_KEYS;++k) {
+				st.cht.set(k,SharedPtr<CHTTestObject>(new CHTTestObject(k)));
+				st.ht.set(k,SharedPtr<CHTTestObject>(new CHTTestObject(k)));
+			}
+			std::vector<std::thread> readers;
+			const int64_t start = OSUtils::now();
+			for(unsigned int t=0;t<threads;++t)
+				readers.push_back(std::thread(chtReader,&st,mode,(unsigned int)rand()));
+			Thread::sleep(ZT_TEST_CHT_BENCH_MS);
+			st.stop = true;
+			for(std::vector<std::thread>::iterator t(readers.begin());t!=readers.end();++t)
+				t->join();
+			const int64_t end = OSUtils::now();
+			std::cout << " " << threads << "T " << (unsigned long)((double)st.lookups.load() / ((double)(end - start) / 1000.0)) << "/s"; std::cout.flush();
+		}
+		std::cout << std::endl;
+	}
+
+	return 0;
+}
+
 #define ZT_TEST_PHY_NUM_UDP_PACKETS 10000
 #define ZT_TEST_PHY_UDP_PACKET_SIZE 1000
 #define ZT_TEST_PHY_NUM_VALID_TCP_CONNECTS 10
@@ -1011,6 +1950,25 @@ static int testPhy()
 	}
 	std::cout << "got " << phyTestUdpPacketCount << " packets, OK" << std::endl;
 
+	std::cout << "[phy] Testing batched UDP send/receive... "; std::cout.flush();
+	phyTestUdpPacketCount = 0;
+	phyTestUdpPacketsSent = 0;
+	timeoutAt = OSUtils::now() + ZT_TEST_PHY_TIMEOUT_MS;
+	while ((OSUtils::now() < timeoutAt)&&(phyTestUdpPacketCount < ZT_TEST_PHY_NUM_UDP_PACKETS)) {
+		for(int k=0;((k<16)&&(phyTestUdpPacketsSent < ZT_TEST_PHY_NUM_UDP_PACKETS));++k) {
+			if (!testPhyInstance->udpSendBatched(udpListenSock,(const struct sockaddr *)&bindaddr,udpTestPayload,sizeof(udpTestPayload))) {
+				std::cout << "FAILED." << std::endl;
+				return -1;
+			} else ++phyTestUdpPacketsSent;
+		}
+		testPhyInstance->poll(100);
+	}
+	if (phyTestUdpPacketCount < ZT_TEST_PHY_NUM_UDP_PACKETS) {
+		std::cout << "got " << phyTestUdpPacketCount << " packets, FAILED." << std::endl;
+		return -1;
+	}
+	std::cout << "got " << phyTestUdpPacketCount << " packets, OK" << std::endl;
+
 	std::cout << "[phy] Testing TCP... "; std::cout.flush();
 	timeoutAt = OSUtils::now() + ZT_TEST_PHY_TIMEOUT_MS;
 	while ((OSUtils::now() < timeoutAt)&&(phyTestTcpByteCount < (ZT_TEST_PHY_NUM_VALID_TCP_CONNECTS * ZT_TEST_PHY_TCP_MESSAGE_SIZE))) {
@@ -1097,6 +2055,7 @@ int main(int argc,char **argv)
 
 	///*
 	r |= testOther();
+	r |= testConcurrency();
 	r |= testCrypto();
 	r |= testPacket();
 	r |= testIdentity();
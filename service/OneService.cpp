@@ -37,6 +37,7 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
 
 #include "../version.h"
 #include "../include/ZeroTierOne.h"
@@ -104,6 +105,10 @@ using json = nlohmann::json;
 #ifdef __WINDOWS__
 #include "../osdep/WindowsEthernetTap.hpp"
 #endif
+#if defined(__LINUX__) && !defined(ZT_SDK)
+#include "../osdep/LinuxEthernetTap.hpp"
+#include "../osdep/LinuxXdpSocket.hpp"
+#endif
 
 #ifndef ZT_SOFTWARE_UPDATE_DEFAULT
 #define ZT_SOFTWARE_UPDATE_DEFAULT "disable"
@@ -120,6 +125,9 @@ using json = nlohmann::json;
 // How often to check for new multicast subscriptions on a tap device
 #define ZT_TAP_CHECK_MULTICAST_INTERVAL 5000
 
+// How often to let AF_XDP reply directly to addresses with live paths in the core
+#define ZT_XDP_TRUST_REFRESH_INTERVAL 1000
+
 // TCP fallback relay (run by ZeroTier, Inc. -- this will eventually go away)
 #ifndef ZT_SDK
 #define ZT_TCP_FALLBACK_RELAY "204.80.128.1/443"
@@ -140,6 +148,15 @@ using json = nlohmann::json;
 // TCP activity timeout
 #define ZT_TCP_ACTIVITY_TIMEOUT 60000
 
+// Maximum number of wire packet worker threads (packetWorkerThreads in local.conf)
+#define ZT_ONE_MAX_PACKET_WORKER_THREADS 64
+
+// Maximum number of packets queued for each wire packet worker thread
+#define ZT_ONE_MAX_PACKET_WORKER_QUEUE 4096
+
+// Maximum number of SO_REUSEPORT UDP sockets and event loops per bound address (udpShards in local.conf)
+#define ZT_ONE_MAX_UDP_SHARDS 64
+
 #if ZT_VAULT_SUPPORT
 size_t curlResponseWrite(void *ptr, size_t size, size_t nmemb, std::string *data)
 {
@@ -240,6 +257,14 @@ static void _networkToJson(nlohmann::json &nj,const ZT_VirtualNetworkConfig *nc,
 		mca.push_back(m);
 	}
 	nj["multicastSubscriptions"] = mca;
+
+	nlohmann::json qos;
+	qos["enabled"] = (bool)(nc->qos.enabled != 0);
+	qos["queuedPackets"] = nc->qos.queuedPackets;
+	qos["activeFlows"] = nc->qos.activeFlows;
+	qos["overflowDrops"] = nc->qos.overflowDrops;
+	qos["codelDrops"] = nc->qos.codelDrops;
+	nj["qos"] = qos;
 }
 
 static void _peerToJson(nlohmann::json &pj,const ZT_Peer *peer)
@@ -346,6 +371,9 @@ static void SnodeVirtualNetworkFrameFunction(ZT_Node *node,void *uptr,void *tptr
 static int SnodePathCheckFunction(ZT_Node *node,void *uptr,void *tptr,uint64_t ztaddr,int64_t localSocket,const struct sockaddr_storage *remoteAddr);
 static int SnodePathLookupFunction(ZT_Node *node,void *uptr,void *tptr,uint64_t ztaddr,int family,struct sockaddr_storage *result);
 static void StapFrameHandler(void *uptr,void *tptr,uint64_t nwid,const MAC &from,const MAC &to,unsigned int etherType,unsigned int vlanId,const void *data,unsigned int len);
+#if defined(__LINUX__) && !defined(ZT_SDK)
+static void SxdpDatagramHandler(void *uptr,LinuxXdpSocket *xdp,const struct sockaddr_storage *from,void *data,unsigned int len);
+#endif
 
 static int ShttpOnMessageBegin(http_parser *parser);
 static int ShttpOnUrl(http_parser *parser,const char *ptr,size_t length);
@@ -423,6 +451,26 @@ struct OneServiceIncomingPacket
 	uint8_t data[ZT_MAX_MTU];
 };
 
+class OneServiceImpl;
+
+// An extra Phy event loop with its own thread and Binder that receives on
+// SO_REUSEPORT UDP sockets bound alongside those of the main Phy
+struct OneServiceUdpShard
+{
+	OneServiceUdpShard(OneServiceImpl *parent) : phy(parent,false,true),binder(true),portCount(0),refresh(false) {}
+
+	Phy<OneServiceImpl *> phy;
+	Binder binder;
+	std::thread thread;
+
+	// Copied from the main thread on each binding refresh
+	Mutex lock;
+	unsigned int ports[3];
+	unsigned int portCount;
+	std::vector<InetAddress> explicitBind;
+	std::atomic<bool> refresh;
+};
+
 class OneServiceImpl : public OneService
 {
 public:
@@ -538,6 +586,30 @@ public:
 	volatile bool _run;
 	Mutex _run_m;
 
+	// Optional worker threads for processWirePacket(), each with its own queue.
+	// Packets are sharded by physical source address so that all packets (and
+	// fragments) on one path are handled in order by the same worker.
+	unsigned int _incomingPacketConcurrency;
+	std::vector< BlockingQueue<OneServiceIncomingPacket *> * > _incomingPacketQueues;
+	std::vector<OneServiceIncomingPacket *> _incomingPacketMemoryPool;
+	Mutex _incomingPacketMemoryPoolLock;
+	std::vector<std::thread> _incomingPacketWorker;
+
+	// Number of SO_REUSEPORT UDP sockets per bound address, one per event loop
+	// (the main Phy plus each shard); 1 means only the main Phy
+	unsigned int _udpShardCount;
+	std::vector<OneServiceUdpShard *> _udpShards;
+
+	// Receive and send UDP through io_uring where the kernel supports it
+	bool _useIoUring;
+
+#if defined(__LINUX__) && !defined(ZT_SDK)
+	// AF_XDP fast path for the primary port on one interface (xdpInterface in local.conf)
+	std::string _xdpInterface;
+	unsigned int _xdpQueues;
+	LinuxXdpSocket *_xdp;
+#endif
+
 	MQConfig *_mqc;
 
 	// end member variables ----------------------------------------------------
@@ -575,6 +647,13 @@ public:
 		,_vaultPath("cubbyhole/zerotier")
 #endif
 		,_run(true)
+		,_incomingPacketConcurrency(0)
+		,_udpShardCount(1)
+		,_useIoUring(false)
+#if defined(__LINUX__) && !defined(ZT_SDK)
+		,_xdpQueues(1)
+		,_xdp((LinuxXdpSocket *)0)
+#endif
 		,_mqc(NULL)
 	{
 		_ports[0] = 0;
@@ -605,6 +684,7 @@ public:
 
 	virtual ReasonForTermination run()
 	{
+		_phy.setPollThread(); // this thread runs _phy.poll(), and no others have started yet
 		try {
 			{
 				const std::string authTokenPath(_homePath + ZT_PATH_SEPARATOR_S "authtoken.secret");
@@ -644,6 +724,58 @@ public:
 			readLocalSettings();
 			applyLocalConfig();
 
+			for(unsigned int i=0;i<_incomingPacketConcurrency;++i)
+				_incomingPacketQueues.push_back(new BlockingQueue<OneServiceIncomingPacket *>());
+			for(unsigned int i=0;i<_incomingPacketConcurrency;++i) {
+				_incomingPacketWorker.push_back(std::thread([this,i]() {
+					BlockingQueue<OneServiceIncomingPacket *> &q = *(_incomingPacketQueues[i]);
+					OneServiceIncomingPacket *pkt = nullptr;
+					for(;;) {
+						if (!q.get(pkt))
+							break;
+						if (!pkt)
+							break;
+
+						const ZT_ResultCode rc = _node->processWirePacket(nullptr,pkt->now,pkt->sock,&(pkt->from),pkt->data,pkt->size,&_nextBackgroundTaskDeadline);
+						{
+							Mutex::Lock l(_incomingPacketMemoryPoolLock);
+							_incomingPacketMemoryPool.push_back(pkt);
+						}
+						if (ZT_ResultCode_isFatal(rc)) {
+							char tmp[256];
+							OSUtils::ztsnprintf(tmp,sizeof(tmp),"fatal error code from processWirePacket: %d",(int)rc);
+							Mutex::Lock _l(_termReason_m);
+							_termReason = ONE_UNRECOVERABLE_ERROR;
+							_fatalErrorMessage = tmp;
+							this->terminate();
+							q.stop(); // don't leave phyOnDatagram() blocked on a full queue
+							break;
+						}
+					}
+				}));
+			}
+
+			if (_udpShardCount > 1) {
+				_binder.setUdpReusePort(true);
+				for(unsigned int i=1;i<_udpShardCount;++i) {
+					OneServiceUdpShard *const shard = new OneServiceUdpShard(this);
+					shard->binder.setUdpReusePort(true);
+					shard->phy.setUseIoUring(_useIoUring);
+					_udpShards.push_back(shard);
+					shard->thread = std::thread([this,shard]() {
+						shard->phy.setPollThread();
+						while (_run) {
+							if (shard->refresh.exchange(false)) {
+								Mutex::Lock _l(shard->lock);
+								shard->binder.refresh(shard->phy,shard->ports,shard->portCount,shard->explicitBind,*this);
+							}
+							shard->phy.poll(ZT_BINDER_REFRESH_PERIOD);
+						}
+						shard->binder.closeAll(shard->phy);
+					});
+				}
+			}
+
 			// Make sure we can use the primary port, and hunt for one if configured to do so
 			const int portTrials = (_primaryPort == 0) ? 256 : 1; // if port is 0, pick random
 			for(int k=0;k<portTrials;++k) {
@@ -730,6 +862,16 @@ public:
 			}
 #endif
 
+#if defined(__LINUX__) && !defined(ZT_SDK)
+			if (_xdpInterface.length() > 0) {
+				try {
+					_xdp = new LinuxXdpSocket(_xdpInterface.c_str(),_ports[0],_xdpQueues,SxdpDatagramHandler,(void *)this);
+				} catch (std::exception &exc) {
+					fprintf(stderr,"WARNING: unable to use AF_XDP on %s, using normal UDP sockets: %s" ZT_EOL_S,_xdpInterface.c_str(),exc.what());
+				}
+			}
+#endif
+
 			// Delete legacy iddb.d if present (cleanup)
 			OSUtils::rmDashRf((_homePath + ZT_PATH_SEPARATOR_S "iddb.d").c_str());
 
@@ -762,6 +904,7 @@ public:
 			int64_t clockShouldBe = OSUtils::now();
 			_lastRestart = clockShouldBe;
 			int64_t lastTapMulticastGroupCheck = 0;
+			int64_t lastXdpTrustRefresh = 0;
 			int64_t lastBindRefresh = 0;
 			int64_t lastUpdateCheck = clockShouldBe;
 			int64_t lastMultipathModeUpdate = 0;
@@ -819,6 +962,14 @@ public:
 							p[pc++] = _ports[i];
 					}
 					_binder.refresh(_phy,p,pc,explicitBind,*this);
+					for(std::vector<OneServiceUdpShard *>::iterator s(_udpShards.begin());s!=_udpShards.end();++s) {
+						Mutex::Lock _l((*s)->lock);
+						memcpy((*s)->ports,p,sizeof(p));
+						(*s)->portCount = pc;
+						(*s)->explicitBind = explicitBind;
+						(*s)->refresh = true;
+						(*s)->phy.whack();
+					}
 					{
 						Mutex::Lock _l(_nets_m);
 						for(std::map<uint64_t,NetworkState>::iterator n(_nets.begin());n!=_nets.end();++n) {
@@ -866,6 +1017,24 @@ public:
 					}
 				}
 
+#if defined(__LINUX__) && !defined(ZT_SDK)
+				// Paths only exist in the core once a peer has sent something that authenticated,
+				// so these are the only next hops AF_XDP may use for sending
+				if ((_xdp)&&((now - lastXdpTrustRefresh) >= ZT_XDP_TRUST_REFRESH_INTERVAL)) {
+					lastXdpTrustRefresh = now;
+					ZT_PeerList *pl = _node->peers();
+					if (pl) {
+						for(unsigned long i=0;i<pl->peerCount;++i) {
+							for(unsigned int j=0;j<pl->peers[i].pathCount;++j) {
+								if (!pl->peers[i].paths[j].expired)
+									_xdp->trust(&(pl->peers[i].paths[j].address));
+							}
+						}
+						_node->freeQueryResult((void *)pl);
+					}
+				}
+#endif
+
 				// Sync information about physical network interfaces
 				if ((now - lastLocalInterfaceAddressCheck) >= (_multipathMode ? ZT_LOCAL_INTERFACE_CHECK_INTERVAL / 8 : ZT_LOCAL_INTERFACE_CHECK_INTERVAL)) {
 					lastLocalInterfaceAddressCheck = now;
@@ -911,6 +1080,36 @@ public:
 				_phy.close((*_tcpConnections.begin())->sock);
 		} catch ( ... ) {}
 
+		// Shards stop first since they may still be handing packets to workers
+		_run_m.lock();
+		_run = false;
+		_run_m.unlock();
+		for(std::vector<OneServiceUdpShard *>::iterator s(_udpShards.begin());s!=_udpShards.end();++s) {
+			(*s)->phy.whack();
+			if ((*s)->thread.joinable())
+				(*s)->thread.join();
+		}
+#if defined(__LINUX__) && !defined(ZT_SDK)
+		delete _xdp;
+		_xdp = (LinuxXdpSocket *)0;
+#endif
+
+		// A NULL tells each worker to exit once it has drained its queue
+		for(std::vector< BlockingQueue<OneServiceIncomingPacket *> * >::iterator q(_incomingPacketQueues.begin());q!=_incomingPacketQueues.end();++q)
+			(*q)->post(nullptr);
+		for(std::vector<std::thread>::iterator t(_incomingPacketWorker.begin());t!=_incomingPacketWorker.end();++t)
+			t->join();
+		_incomingPacketWorker.clear();
+		for(std::vector< BlockingQueue<OneServiceIncomingPacket *> * >::iterator q(_incomingPacketQueues.begin());q!=_incomingPacketQueues.end();++q)
+			delete *q;
+		_incomingPacketQueues.clear();
+		for(std::vector<OneServiceIncomingPacket *>::iterator p(_incomingPacketMemoryPool.begin());p!=_incomingPacketMemoryPool.end();++p)
+			delete *p;
+		_incomingPacketMemoryPool.clear();
+		for(std::vector<OneServiceUdpShard *>::iterator s(_udpShards.begin());s!=_udpShards.end();++s)
+			delete *s;
+		_udpShards.clear();
+
 		{
 			Mutex::Lock _l(_nets_m);
 			_nets.clear();
@@ -1079,6 +1278,8 @@ public:
 		_run = false;
 		_run_m.unlock();
 		_phy.whack();
+		for(std::vector<OneServiceUdpShard *>::iterator s(_udpShards.begin());s!=_udpShards.end();++s)
+			(*s)->phy.whack();
 	}
 
 	virtual bool getNetworkSettings(const uint64_t nwid,NetworkSettings &settings) const
@@ -1213,6 +1414,8 @@ public:
 					res["publicIdentity"] = status.publicIdentity;
 					res["online"] = (bool)(status.online != 0);
 					res["tcpFallbackActive"] = (_tcpFallbackTunnel != (TcpConnection *)0);
+					res["rxQueueEvicted"] = status.rxQueueEvicted;
+					res["rxQueueExpired"] = status.rxQueueExpired;
 					res["versionMajor"] = ZEROTIER_ONE_VERSION_MAJOR;
 					res["versionMinor"] = ZEROTIER_ONE_VERSION_MINOR;
 					res["versionRev"] = ZEROTIER_ONE_VERSION_REVISION;
@@ -1585,6 +1788,26 @@ public:
 			_allowTcpFallbackRelay = false;
 		}
 		_portMappingEnabled = OSUtils::jsonBool(settings["portMappingEnabled"],true);
+		if (_incomingPacketWorker.empty()) // thread count can only change on restart
+			_incomingPacketConcurrency = std::min((unsigned int)OSUtils::jsonInt(settings["packetWorkerThreads"],0),(unsigned int)ZT_ONE_MAX_PACKET_WORKER_THREADS);
+		// Applies to sockets bound after this point
+		_useIoUring = OSUtils::jsonBool(settings["ioUring"],false);
+		_phy.setUseIoUring(_useIoUring);
+#if defined(__LINUX__) && defined(SO_REUSEPORT)
+		// Only Linux balances incoming datagrams across SO_REUSEPORT sockets
+		if (_udpShards.empty()) // can only change on restart
+			_udpShardCount = std::max(1U,std::min((unsigned int)OSUtils::jsonInt(settings["udpShards"],1),(unsigned int)ZT_ONE_MAX_UDP_SHARDS));
+#endif
+
+#if defined(__LINUX__) && !defined(ZT_SDK)
+		// Applies to taps created after this point, e.g. on network join or restart
+		LinuxEthernetTap::setQueueCount((unsigned int)OSUtils::jsonInt(settings["tapQueueCount"],1));
+		LinuxEthernetTap::setOffload(OSUtils::jsonBool(settings["tapOffload"],false));
+		if (!_xdp) { // can only change on restart
+			_xdpInterface = OSUtils::jsonString(settings["xdpInterface"],"");
+			_xdpQueues = (unsigned int)OSUtils::jsonInt(settings["xdpQueues"],1);
+		}
+#endif
 
 #ifndef ZT_SDK
 		const std::string up(OSUtils::jsonString(settings["softwareUpdate"],ZT_SOFTWARE_UPDATE_DEFAULT));
@@ -1832,11 +2055,40 @@ public:
 	// =========================================================================
 
 	inline void phyOnDatagram(PhySocket *sock,void **uptr,const struct sockaddr *localAddr,const struct sockaddr *from,void *data,unsigned long len)
+	{
+		_onWirePacket(reinterpret_cast<int64_t>(sock),from,data,len);
+	}
+
+	// Common path for datagrams from Phy sockets and AF_XDP
+	inline void _onWirePacket(const int64_t localSocket,const struct sockaddr *from,void *data,unsigned long len)
 	{
 		const uint64_t now = OSUtils::now();
 		if ((len >= 16)&&(reinterpret_cast<const InetAddress *>(from)->ipScope() == InetAddress::IP_SCOPE_GLOBAL))
 			_lastDirectReceiveFromGlobal = now;
-		const ZT_ResultCode rc = _node->processWirePacket(nullptr,now,reinterpret_cast<int64_t>(sock),reinterpret_cast<const struct sockaddr_storage *>(from),data,len,&_nextBackgroundTaskDeadline);
+
+		if ((!_incomingPacketQueues.empty())&&(len <= sizeof(OneServiceIncomingPacket::data))) {
+			OneServiceIncomingPacket *pkt;
+			_incomingPacketMemoryPoolLock.lock();
+			if (_incomingPacketMemoryPool.empty()) {
+				pkt = new OneServiceIncomingPacket;
+			} else {
+				pkt = _incomingPacketMemoryPool.back();
+				_incomingPacketMemoryPool.pop_back();
+			}
+			_incomingPacketMemoryPoolLock.unlock();
+
+			pkt->now = now;
+			pkt->sock = localSocket;
+			memcpy(&(pkt->from),from,sizeof(struct sockaddr_storage));
+			pkt->size = (unsigned int)len;
+			memcpy(pkt->data,data,len);
+
+			// Blocks (leaving packets in the kernel's socket buffer) if this worker falls far behind
+			_incomingPacketQueues[reinterpret_cast<const InetAddress *>(from)->hashCode() % _incomingPacketQueues.size()]->postLimit(pkt,ZT_ONE_MAX_PACKET_WORKER_QUEUE);
+			return;
+		}
+
+		const ZT_ResultCode rc = _node->processWirePacket(nullptr,now,localSocket,reinterpret_cast<const struct sockaddr_storage *>(from),data,len,&_nextBackgroundTaskDeadline);
 		if (ZT_ResultCode_isFatal(rc)) {
 			char tmp[256];
 			OSUtils::ztsnprintf(tmp,sizeof(tmp),"fatal error code from processWirePacket: %d",(int)rc);
@@ -2592,11 +2844,26 @@ public:
 		// working we can instantly "fail forward" to it and stop using TCP
 		// proxy fallback, which is slow.
 
-		if ((localSocket != -1)&&(localSocket != 0)&&(_binder.isUdpSocketValid((PhySocket *)((uintptr_t)localSocket)))) {
-			if ((ttl)&&(addr->ss_family == AF_INET)) _phy.setIp4UdpTtl((PhySocket *)((uintptr_t)localSocket),ttl);
-			const bool r = _phy.udpSend((PhySocket *)((uintptr_t)localSocket),(const struct sockaddr *)addr,data,len);
-			if ((ttl)&&(addr->ss_family == AF_INET)) _phy.setIp4UdpTtl((PhySocket *)((uintptr_t)localSocket),255);
-			return ((r) ? 0 : -1);
+#if defined(__LINUX__) && !defined(ZT_SDK)
+		if ((_xdp)&&(localSocket == reinterpret_cast<int64_t>(_xdp))) {
+			// Falls back to the normal sockets if AF_XDP doesn't know the next hop yet
+			if ((ttl == 0)&&(_xdp->send(addr,data,len)))
+				return 0;
+			return ((_binder.udpSendAll(_phy,addr,data,len,ttl)) ? 0 : -1);
+		}
+#endif
+
+		Phy<OneServiceImpl *> *const phy = ((localSocket != -1)&&(localSocket != 0)) ? _udpSocketPhy((PhySocket *)((uintptr_t)localSocket)) : (Phy<OneServiceImpl *> *)0;
+		if (phy) {
+			if ((ttl)&&(addr->ss_family == AF_INET)) {
+				// TTL is a socket option, so these can't wait in the send batch
+				phy->setIp4UdpTtl((PhySocket *)((uintptr_t)localSocket),ttl);
+				const bool r = phy->udpSend((PhySocket *)((uintptr_t)localSocket),(const struct sockaddr *)addr,data,len);
+				phy->setIp4UdpTtl((PhySocket *)((uintptr_t)localSocket),255);
+				return ((r) ? 0 : -1);
+			}
+			// Sends from the owning Phy's thread are queued and flushed once per poll() with sendmmsg()
+			return ((phy->udpSendBatched((PhySocket *)((uintptr_t)localSocket),(const struct sockaddr *)addr,data,len)) ? 0 : -1);
 		} else {
 			return ((_binder.udpSendAll(_phy,addr,data,len,ttl)) ? 0 : -1);
 		}
@@ -2794,6 +3061,18 @@ public:
 		return true;
 	}
 
+	// Phy that owns a UDP socket bound by _binder or a shard's Binder, or NULL if it is no longer bound
+	inline Phy<OneServiceImpl *> *_udpSocketPhy(PhySocket *const sock)
+	{
+		if (_binder.isUdpSocketValid(sock))
+			return &_phy;
+		for(std::vector<OneServiceUdpShard *>::iterator s(_udpShards.begin());s!=_udpShards.end();++s) {
+			if ((*s)->binder.isUdpSocketValid(sock))
+				return &((*s)->phy);
+		}
+		return (Phy<OneServiceImpl *> *)0;
+	}
+
 	bool _trialBind(unsigned int port)
 	{
 		struct sockaddr_in in4;
@@ -2849,6 +3128,11 @@ static int SnodePathLookupFunction(ZT_Node *node,void *uptr,void *tptr,uint64_t
 static void StapFrameHandler(void *uptr,void *tptr,uint64_t nwid,const MAC &from,const MAC &to,unsigned int etherType,unsigned int vlanId,const void *data,unsigned int len)
 { reinterpret_cast<OneServiceImpl *>(uptr)->tapFrameHandler(nwid,from,to,etherType,vlanId,data,len); }
 
+#if defined(__LINUX__) && !defined(ZT_SDK)
+static void SxdpDatagramHandler(void *uptr,LinuxXdpSocket *xdp,const struct sockaddr_storage *from,void *data,unsigned int len)
+{ reinterpret_cast<OneServiceImpl *>(uptr)->_onWirePacket(reinterpret_cast<int64_t>(xdp),reinterpret_cast<const struct sockaddr *>(from),data,len); }
+#endif
+
 static int ShttpOnMessageBegin(http_parser *parser)
 {
 	TcpConnection *tc = reinterpret_cast<TcpConnection *>(parser->data);